@@ -6,6 +6,7 @@
 #include <new>
 
 #include "calculation_store.h"
+#include "calculation_tree_cache.h"
 #include "edit_expression_controller.h"
 #include "history_controller.h"
 
@@ -58,6 +59,10 @@ class App : public Shared::MathApp {
   Snapshot *snapshot() const {
     return static_cast<Snapshot *>(Shared::SharedApp::snapshot());
   }
+  CalculationTreeCache *treeCache() { return &m_treeCache; }
+  void storageDidChangeForRecord(Ion::Storage::Record) override {
+    m_treeCache.reset();
+  }
 
  private:
   App(Snapshot *snapshot);
@@ -66,6 +71,7 @@ class App : public Shared::MathApp {
 
   HistoryController m_historyController;
   EditExpressionController m_editExpressionController;
+  CalculationTreeCache m_treeCache;
 };
 
 }  // namespace Calculation
@@ -57,20 +57,74 @@ const char *Calculation::approximateOutputText(
          strlen(approximateOutputTextWithMaxNumberOfDigits) + 1;
 }
 
-Expression Calculation::input() {
-  Expression e = Expression::Parse(m_inputText, nullptr);
+static CalculationTreeCache *TreeCache() {
+  App *app = App::app();
+  return app ? app->treeCache() : nullptr;
+}
+
+Expression Calculation::parseText(const char *text,
+                                  CalculationTreeCache::Tree tree) const {
+  CalculationTreeCache *cache = TreeCache();
+  CalculationTreeCache::Key key(text, tree);
+  Expression e = cache ? cache->expression(key) : Expression();
+  if (e.isUninitialized()) {
+    e = Expression::Parse(text, nullptr);
+    if (cache) {
+      cache->store(key, e);
+    }
+  }
   assert(!e.isUninitialized());
   return e;
 }
 
+Layout Calculation::createLayout(CalculationTreeCache::Tree tree,
+                                 Preferences::PrintFloatMode floatDisplayMode,
+                                 int numberOfSignificantDigits) {
+  const char *text;
+  CalculationTreeCache::Tree expressionTree;
+  switch (tree) {
+    case CalculationTreeCache::Tree::InputLayout:
+      text = m_inputText;
+      expressionTree = CalculationTreeCache::Tree::InputExpression;
+      break;
+    case CalculationTreeCache::Tree::ExactOutputLayout:
+      text = exactOutputText();
+      expressionTree = CalculationTreeCache::Tree::ExactOutputExpression;
+      break;
+    default:
+      assert(tree == CalculationTreeCache::Tree::ApproximateOutputLayout);
+      text = approximateOutputText(NumberOfSignificantDigits::UserDefined);
+      expressionTree = CalculationTreeCache::Tree::ApproximateOutputExpression;
+  }
+  CalculationTreeCache *cache = TreeCache();
+  // The layout also depends on the display settings it is created with
+  assert(numberOfSignificantDigits <= UINT8_MAX);
+  const uint8_t settings[] = {static_cast<uint8_t>(floatDisplayMode),
+                              static_cast<uint8_t>(numberOfSignificantDigits)};
+  CalculationTreeCache::Key key(text, tree, settings, sizeof(settings));
+  Layout l = cache ? cache->layout(key) : Layout();
+  if (l.isUninitialized()) {
+    Expression e = parseText(text, expressionTree);
+    l = e.createLayout(floatDisplayMode, numberOfSignificantDigits,
+                       App::app()->localContext());
+    if (cache) {
+      cache->store(key, l);
+    }
+  }
+  return l;
+}
+
+Expression Calculation::input() {
+  return parseText(m_inputText, CalculationTreeCache::Tree::InputExpression);
+}
+
 Expression Calculation::exactOutput() {
   /* Because the angle unit might have changed, we do not simplify again. We
    * thereby avoid turning cos(Pi/4) into sqrt(2)/2 and displaying
    * 'sqrt(2)/2 = 0.999906' (which is totally wrong) instead of
    * 'cos(pi/4) = 0.999906' (which is true in degree). */
-  Expression e = Expression::Parse(exactOutputText(), nullptr);
-  assert(!e.isUninitialized());
-  return e;
+  return parseText(exactOutputText(),
+                   CalculationTreeCache::Tree::ExactOutputExpression);
 }
 
 Expression Calculation::approximateOutput(
@@ -106,21 +160,16 @@ Expression Calculation::approximateOutput(
    *
    */
   // clang-format on
-  Expression e = Expression::Parse(
-      approximateOutputText(numberOfSignificantDigits), nullptr);
-  assert(!e.isUninitialized());
-  return e;
+  return parseText(approximateOutputText(numberOfSignificantDigits),
+                   CalculationTreeCache::Tree::ApproximateOutputExpression);
 }
 
 Layout Calculation::createInputLayout() {
   ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
-    Expression e = input();
-    if (!e.isUninitialized()) {
-      return e.createLayout(Preferences::PrintFloatMode::Decimal,
-                            PrintFloat::k_maxNumberOfSignificantDigits,
-                            App::app()->localContext());
-    }
+    return createLayout(CalculationTreeCache::Tree::InputLayout,
+                        Preferences::PrintFloatMode::Decimal,
+                        PrintFloat::k_maxNumberOfSignificantDigits);
   }
   return Layout();
 }
@@ -128,11 +177,11 @@ Layout Calculation::createInputLayout() {
 Layout Calculation::createExactOutputLayout(bool *couldNotCreateExactLayout) {
   ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
-    Expression e = exactOutput();
-    if (!e.isUninitialized()) {
-      return e.createLayout(Preferences::PrintFloatMode::Decimal,
-                            PrintFloat::k_maxNumberOfSignificantDigits,
-                            App::app()->localContext());
+    Layout l = createLayout(CalculationTreeCache::Tree::ExactOutputLayout,
+                            Preferences::PrintFloatMode::Decimal,
+                            PrintFloat::k_maxNumberOfSignificantDigits);
+    if (!l.isUninitialized()) {
+      return l;
     }
   }
   *couldNotCreateExactLayout = true;
@@ -143,10 +192,11 @@ Layout Calculation::createApproximateOutputLayout(
     bool *couldNotCreateApproximateLayout) {
   ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
-    Expression e = approximateOutput(NumberOfSignificantDigits::UserDefined);
-    if (!e.isUninitialized()) {
-      return e.createLayout(displayMode(), numberOfSignificantDigits(),
-                            App::app()->localContext());
+    Layout l =
+        createLayout(CalculationTreeCache::Tree::ApproximateOutputLayout,
+                     displayMode(), numberOfSignificantDigits());
+    if (!l.isUninitialized()) {
+      return l;
     }
   }
   *couldNotCreateApproximateLayout = true;
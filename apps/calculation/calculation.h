@@ -6,6 +6,8 @@
 #include <poincare/context.h>
 #include <poincare/expression.h>
 
+#include "calculation_tree_cache.h"
+
 #if __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
@@ -116,6 +118,12 @@ class Calculation {
     return d != DisplayOutput::ApproximateOnly;
   }
   void forceDisplayOutput(DisplayOutput d) { m_displayOutput = d; }
+  Poincare::Expression parseText(const char* text,
+                                 CalculationTreeCache::Tree tree) const;
+  Poincare::Layout createLayout(
+      CalculationTreeCache::Tree tree,
+      Poincare::Preferences::PrintFloatMode floatDisplayMode,
+      int numberOfSignificantDigits);
 
   /* Buffers holding text expressions have to be longer than the text written
    * by user (of maximum length TextField::MaxBufferSize()) because when we
@@ -0,0 +1,123 @@
+#include "calculation_tree_cache.h"
+
+#include <assert.h>
+#include <ion/crc.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Calculation {
+
+static uint32_t EatBytes(uint32_t crc, const void *bytes, size_t size) {
+  const uint8_t *data = static_cast<const uint8_t *>(bytes);
+  for (size_t i = 0; i < size; i++) {
+    crc = Ion::crc32EatByte(crc, data[i]);
+  }
+  return crc;
+}
+
+CalculationTreeCache::Key::Key(const char *text, Tree tree,
+                               const uint8_t *settings, size_t settingsSize)
+    : m_text(text),
+      m_settings(settings),
+      m_textLength(strlen(text)),
+      m_settingsSize(settingsSize),
+      m_tree(tree) {
+  uint32_t crc = EatBytes(~0u, text, m_textLength);
+  crc = Ion::crc32EatByte(crc, static_cast<uint8_t>(tree));
+  m_checksum = EatBytes(crc, settings, settingsSize);
+}
+
+bool CalculationTreeCache::Key::isEqualTo(const char *bytes) const {
+  return memcmp(bytes, m_text, m_textLength) == 0 &&
+         bytes[m_textLength] == static_cast<char>(m_tree) &&
+         (m_settingsSize == 0 ||
+          memcmp(bytes + m_textLength + 1, m_settings, m_settingsSize) == 0);
+}
+
+void CalculationTreeCache::Key::copyTo(char *bytes) const {
+  memcpy(bytes, m_text, m_textLength);
+  bytes[m_textLength] = static_cast<char>(m_tree);
+  if (m_settingsSize > 0) {
+    memcpy(bytes + m_textLength + 1, m_settings, m_settingsSize);
+  }
+}
+
+void CalculationTreeCache::store(const Key &key, TreeHandle tree) {
+  if (tree.isUninitialized()) {
+    return;
+  }
+  size_t keySize = key.size();
+  size_t treeSize = tree.size();
+  size_t size = keySize + treeSize;
+  const void *address;
+  if (size > k_bufferSize || find(key, &address) > 0) {
+    return;
+  }
+  while (m_numberOfEntries == k_numberOfEntries ||
+         m_usedSize + size > k_bufferSize) {
+    evictLeastRecentlyUsedEntry();
+  }
+  key.copyTo(m_buffer + m_usedSize);
+  memcpy(m_buffer + m_usedSize + keySize, tree.addressInPool(), treeSize);
+  m_entries[m_numberOfEntries] = {.checksum = key.checksum(),
+                                  .lastUse = m_useCounter++,
+                                  .keySize = static_cast<uint16_t>(keySize),
+                                  .treeSize = static_cast<uint16_t>(treeSize)};
+  m_numberOfEntries++;
+  m_usedSize += size;
+}
+
+void CalculationTreeCache::reset() {
+  m_numberOfEntries = 0;
+  m_usedSize = 0;
+  m_useCounter = 0;
+}
+
+size_t CalculationTreeCache::find(const Key &key, const void **address) {
+  const char *entryAddress = m_buffer;
+  for (int i = 0; i < m_numberOfEntries; i++) {
+    const Entry &entry = m_entries[i];
+    if (entry.checksum == key.checksum() && entry.keySize == key.size() &&
+        key.isEqualTo(entryAddress)) {
+      m_entries[i].lastUse = m_useCounter++;
+      *address = entryAddress + entry.keySize;
+      return entry.treeSize;
+    }
+    entryAddress += entry.size();
+  }
+  *address = nullptr;
+  return 0;
+}
+
+const char *CalculationTreeCache::addressOfEntry(int index) const {
+  const char *address = m_buffer;
+  for (int i = 0; i < index; i++) {
+    address += m_entries[i].size();
+  }
+  return address;
+}
+
+void CalculationTreeCache::removeEntry(int index) {
+  assert(0 <= index && index < m_numberOfEntries);
+  char *address = const_cast<char *>(addressOfEntry(index));
+  size_t size = m_entries[index].size();
+  memmove(address, address + size, m_buffer + m_usedSize - address - size);
+  m_usedSize -= size;
+  m_numberOfEntries--;
+  memmove(m_entries + index, m_entries + index + 1,
+          (m_numberOfEntries - index) * sizeof(Entry));
+}
+
+void CalculationTreeCache::evictLeastRecentlyUsedEntry() {
+  assert(m_numberOfEntries > 0);
+  int leastRecentlyUsed = 0;
+  for (int i = 1; i < m_numberOfEntries; i++) {
+    if (m_entries[i].lastUse < m_entries[leastRecentlyUsed].lastUse) {
+      leastRecentlyUsed = i;
+    }
+  }
+  removeEntry(leastRecentlyUsed);
+}
+
+}  // namespace Calculation
@@ -0,0 +1,95 @@
+#ifndef CALCULATION_CALCULATION_TREE_CACHE_H
+#define CALCULATION_CALCULATION_TREE_CACHE_H
+
+#include <poincare/expression.h>
+#include <poincare/layout.h>
+#include <stdint.h>
+
+namespace Calculation {
+
+/* The history only stores calculations as texts, which are parsed again each
+ * time a cell is reloaded. This cache keeps copies of the recently parsed
+ * expressions and created layouts in a buffer outside of the pool. Trees are
+ * keyed by the text they come from and by what was done with it. The key is
+ * stored in the buffer next to its tree, so that entries are only found by
+ * their checksum once their whole key matches. The least recently used
+ * entries are evicted first. */
+
+class CalculationTreeCache {
+ public:
+  enum class Tree : uint8_t {
+    InputExpression,
+    ExactOutputExpression,
+    ApproximateOutputExpression,
+    InputLayout,
+    ExactOutputLayout,
+    ApproximateOutputLayout
+  };
+
+  class Key {
+   public:
+    Key(const char* text, Tree tree, const uint8_t* settings = nullptr,
+        size_t settingsSize = 0);
+    uint32_t checksum() const { return m_checksum; }
+    size_t size() const { return m_textLength + 1 + m_settingsSize; }
+    bool isEqualTo(const char* bytes) const;
+    void copyTo(char* bytes) const;
+
+   private:
+    const char* m_text;
+    const uint8_t* m_settings;
+    size_t m_textLength;
+    size_t m_settingsSize;
+    uint32_t m_checksum;
+    Tree m_tree;
+  };
+
+  CalculationTreeCache() { reset(); }
+
+  // Return an uninitialized tree if the key is not cached
+  Poincare::Expression expression(const Key& key) {
+    const void* address;
+    size_t size = find(key, &address);
+    return Poincare::Expression::ExpressionFromAddress(address, size);
+  }
+  Poincare::Layout layout(const Key& key) {
+    const void* address;
+    size_t size = find(key, &address);
+    return Poincare::Layout::LayoutFromAddress(address, size);
+  }
+  void store(const Key& key, Poincare::TreeHandle tree);
+  void reset();
+
+ private:
+  /* The cache lives in the App, which is allocated in the buffer shared by
+   * all apps. The calculation app is much smaller than the largest apps, so
+   * the cache does not increase the RAM needed by this buffer. */
+  constexpr static int k_numberOfEntries = 24;
+  constexpr static size_t k_bufferSize = 4096;
+
+  struct Entry {
+    uint32_t checksum;
+    uint32_t lastUse;
+    uint16_t keySize;
+    uint16_t treeSize;
+    size_t size() const { return keySize + treeSize; }
+  };
+
+  // Return the size of the tree
+  size_t find(const Key& key, const void** address);
+  const char* addressOfEntry(int index) const;
+  void removeEntry(int index);
+  void evictLeastRecentlyUsedEntry();
+
+  /* Keys and trees are packed in the buffer in the order of the entries, each
+   * key followed by its tree. */
+  Entry m_entries[k_numberOfEntries];
+  char m_buffer[k_bufferSize];
+  int m_numberOfEntries;
+  size_t m_usedSize;
+  uint32_t m_useCounter;
+};
+
+}  // namespace Calculation
+
+#endif
@@ -1,4 +1,5 @@
 #include "../calculation_store.h"
+#include "../calculation_tree_cache.h"
 
 #include <apps/calculation/additional_results/additional_results_type.h>
 #include <apps/shared/expression_display_permissions.h>
@@ -139,6 +140,65 @@ void assertAnsIs(const char *input, const char *expectedAnsInputText,
   quiz_assert(strcmp(lastCalculation->inputText(), expectedAnsInputText) == 0);
 }
 
+QUIZ_CASE(calculation_tree_cache) {
+  CalculationTreeCache cache;
+  typedef CalculationTreeCache::Tree Tree;
+  typedef CalculationTreeCache::Key Key;
+  Key keys[3] = {Key("1+2", Tree::InputExpression),
+                 Key("1+2", Tree::InputLayout), Key("3", Tree::InputExpression)};
+  quiz_assert(keys[0].checksum() != keys[1].checksum() &&
+              keys[0].checksum() != keys[2].checksum());
+  quiz_assert(cache.expression(keys[0]).isUninitialized());
+
+  Expression e = Expression::Parse("1+2", nullptr);
+  cache.store(keys[0], e);
+  Expression cached = cache.expression(keys[0]);
+  quiz_assert(!cached.isUninitialized() && cached.isIdenticalTo(e) &&
+              cached.identifier() != e.identifier());
+
+  Layout l = e.createLayout(Preferences::PrintFloatMode::Decimal, 7, nullptr);
+  cache.store(keys[1], l);
+  quiz_assert(cache.layout(keys[1]).isIdenticalTo(l));
+
+  // Keys with the same checksum are told apart
+  Key collision("8188+15468", Tree::InputExpression);
+  Key otherCollision("69200+71+1", Tree::InputExpression);
+  quiz_assert(collision.checksum() == otherCollision.checksum());
+  cache.store(collision, Expression::Parse("8188+15468", nullptr));
+  quiz_assert(cache.expression(otherCollision).isUninitialized());
+  cache.store(otherCollision, Expression::Parse("69200+71+1", nullptr));
+  quiz_assert(cache.expression(collision).isIdenticalTo(
+      Expression::Parse("8188+15468", nullptr)));
+  quiz_assert(cache.expression(otherCollision).isIdenticalTo(
+      Expression::Parse("69200+71+1", nullptr)));
+
+  // Settings are part of the key
+  const uint8_t settings[] = {1, 7};
+  const uint8_t otherSettings[] = {1, 8};
+  cache.store(Key("1+2", Tree::InputLayout, settings, sizeof(settings)), l);
+  quiz_assert(
+      !cache.layout(Key("1+2", Tree::InputLayout, settings, sizeof(settings)))
+           .isUninitialized());
+  quiz_assert(cache
+                  .layout(Key("1+2", Tree::InputLayout, otherSettings,
+                              sizeof(otherSettings)))
+                  .isUninitialized());
+
+  /* Fill the cache with more trees than it can hold. The layout, used more
+   * recently, outlives the first expression. */
+  Expression filler = Expression::Parse("12345+67890", nullptr);
+  for (int i = 0; i < 30; i++) {
+    cache.layout(keys[1]);
+    char text[] = {static_cast<char>('a' + i), 0};
+    cache.store(Key(text, Tree::ExactOutputExpression), filler);
+  }
+  quiz_assert(cache.expression(keys[0]).isUninitialized());
+  quiz_assert(!cache.layout(keys[1]).isUninitialized());
+
+  cache.reset();
+  quiz_assert(cache.layout(keys[1]).isUninitialized());
+}
+
 QUIZ_CASE(calculation_ans) {
   Shared::GlobalContext globalContext;
   CalculationStore store(calculationBuffer, calculationBufferSize);
@@ -241,6 +301,59 @@ void assertCalculationIs(const char *input, DisplayOutput display,
   store->deleteAll();
 }
 
+/* Simulate the user pressing Back while the symbol a is being looked up, a
+ * given number of times. */
+class InterruptingContext : public ContextWithParent {
+ public:
+  InterruptingContext(Context *parentContext, int numberOfInterruptions)
+      : ContextWithParent(parentContext),
+        m_numberOfInterruptions(numberOfInterruptions) {}
+
+ private:
+  const Expression protectedExpressionForSymbolAbstract(
+      const SymbolAbstract &symbol, bool clone,
+      ContextWithParent *lastDescendantContext) override {
+    if (m_numberOfInterruptions > 0 && strcmp(symbol.name(), "a") == 0) {
+      m_numberOfInterruptions--;
+      Ion::CircuitBreaker::loadCheckpoint(
+          Ion::CircuitBreaker::CheckpointType::Back);
+    }
+    return ContextWithParent::protectedExpressionForSymbolAbstract(
+        symbol, clone, lastDescendantContext);
+  }
+
+  int m_numberOfInterruptions;
+};
+
+QUIZ_CASE(calculation_interrupted) {
+  Shared::GlobalContext globalContext;
+  CalculationStore store(calculationBuffer, calculationBufferSize);
+  assertCalculationIs("3→a", DisplayOutput::ApproximateOnly, EqualSign::Unknown,
+                      "3", nullptr, nullptr, &globalContext, &store);
+
+  // A single Back during the computation discards the calculation
+  InterruptingContext interrupted(&globalContext, 1);
+  store.push("a+1", &interrupted);
+  quiz_assert(store.numberOfCalculations() == 0);
+
+  // Nor is the assignment performed
+  InterruptingContext interruptedStore(&globalContext, 1);
+  store.push("a+3→b", &interruptedStore);
+  quiz_assert(store.numberOfCalculations() == 0);
+  quiz_assert(Ion::Storage::FileSystem::sharedFileSystem->recordNamed("b.exp")
+                  .isNull());
+
+  // The next computation is not affected
+  store.push("a+1", &globalContext);
+  quiz_assert(store.numberOfCalculations() == 1);
+  quiz_assert(strcmp(store.calculationAtIndex(0)->approximateOutputText(
+                         NumberOfSignificantDigits::UserDefined),
+                     "4") == 0);
+
+  store.deleteAll();
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("a.exp").destroy();
+}
+
 QUIZ_CASE(calculation_significant_digits) {
   Shared::GlobalContext globalContext;
   CalculationStore store(calculationBuffer, calculationBufferSize);
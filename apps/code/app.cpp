@@ -64,7 +64,6 @@ void App::Snapshot::setOpt(const char *name, const char *value) {
 
 App::App(Snapshot *snapshot)
     : Shared::SharedApp(snapshot, &m_codeStackViewController),
-      m_pythonUser(nullptr),
       m_consoleController(nullptr, this
 #if EPSILON_GETOPT
                           ,
@@ -131,25 +130,10 @@ bool App::textInputDidReceiveEvent(EditableField *textInput,
 }
 
 void App::initPythonWithUser(const void *pythonUser) {
-  if (!m_pythonUser) {
-    /* Tree pool will be used as an extension of the heap. */
-    assert(Poincare::TreePool::sharedPool->numberOfNodes() == 0);
-    Poincare::TreePool::sharedPool.deinit();
-
-    char *heap = pythonHeap();
-    MicroPython::init(heap, heap + k_pythonHeapSize);
-  }
-  m_pythonUser = pythonUser;
-}
-
-void App::deinitPython() {
-  if (m_pythonUser) {
-    MicroPython::deinit();
-    m_pythonUser = nullptr;
-    /* Re-construct the tree pool, which might have been ovewritten by the heap.
-     */
-    Poincare::TreePool::sharedPool.init();
-  }
+  /* Scripts run by the console can also use the free storage, as the console
+   * only creates small records while Python is running. */
+  m_pythonSession.initWithUser(pythonUser, pythonHeap(), k_pythonHeapSize,
+                               pythonUser == &m_consoleController);
 }
 
 }  // namespace Code
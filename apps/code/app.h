@@ -6,6 +6,7 @@
 
 #include "console_controller.h"
 #include "menu_controller.h"
+#include "python_session.h"
 #include "python_toolbox_controller.h"
 #include "python_variable_box_controller.h"
 #include "script_store.h"
@@ -57,12 +58,12 @@ class App : public Shared::SharedApp {
 
   /* Code::App */
   // Python delegate
-  bool pythonIsInited() { return m_pythonUser != nullptr; }
+  bool pythonIsInited() { return m_pythonSession.isInited(); }
   bool isPythonUser(const void *pythonUser) {
-    return m_pythonUser == pythonUser;
+    return m_pythonSession.isUser(pythonUser);
   }
   void initPythonWithUser(const void *pythonUser);
-  void deinitPython();
+  void deinitPython() { m_pythonSession.deinit(); }
 
   constexpr static size_t k_pythonHeapSize = 65536;  // 64KiB
 
@@ -71,10 +72,8 @@ class App : public Shared::SharedApp {
 
   /* Python delegate:
    * MicroPython requires a heap. To avoid dynamic allocation, we keep a working
-   * buffer here and we give to controllers that load Python environment. We
-   * also memoize the last Python user to avoid re-initiating MicroPython when
-   * unneeded. */
-  const void *m_pythonUser;
+   * buffer here and we give to controllers that load Python environment. */
+  PythonSession m_pythonSession;
   ConsoleController m_consoleController;
   Escher::ButtonRowController m_listFooter;
   MenuController m_menuController;
@@ -6,6 +6,7 @@
 #include <assert.h>
 #include <escher/metric.h>
 #include <ion/storage/file_system.h>
+#include <ion/timing.h>
 #include <python/port/helpers.h>
 
 #include <algorithm>
@@ -40,6 +41,8 @@ ConsoleController::ConsoleController(Responder *parentResponder,
       m_selectableListView(this, this, this, this),
       m_editCell(this, this),
       m_sandboxController(this),
+      m_lastPrintOutputRefresh(0),
+      m_printOutputIsPending(false),
       m_inputRunLoopActive(false)
 #if EPSILON_GETOPT
       ,
@@ -82,6 +85,7 @@ void ConsoleController::autoImport() {
 
 void ConsoleController::runAndPrintForCommand(const char *command) {
   const char *storedCommand = m_consoleStore.pushCommand(command);
+  m_printOutputIsPending = true;
   assert(m_outputAccumulationBuffer[0] == '\0');
 
   // Draw the console before running the code
@@ -400,10 +404,17 @@ bool ConsoleController::isDisplayingViewController() {
 }
 
 void ConsoleController::refreshPrintOutput() {
+  /* Only redraw the lines stored since the last refresh. printText limits the
+   * refreshes to one every k_printOutputRefreshPeriod. */
+  if (!m_printOutputIsPending) {
+    return;
+  }
   if (!isDisplayingViewController()) {
     reloadData();
     AppsContainer::sharedAppsContainer()->redrawWindow();
   }
+  m_lastPrintOutputRefresh = Ion::Timing::millis();
+  m_printOutputIsPending = false;
 }
 
 void ConsoleController::reloadData() {
@@ -432,7 +443,10 @@ void ConsoleController::printText(const char *text, size_t length) {
     assert(textCutIndex == length - 1);
     appendTextToOutputAccumulationBuffer(text, length - 1);
     flushOutputAccumulationBufferToStore();
-    micropython_port_vm_hook_refresh_print();
+    if (Ion::Timing::millis() - m_lastPrintOutputRefresh >=
+        k_printOutputRefreshPeriod) {
+      micropython_port_vm_hook_refresh_print();
+    }
   }
 }
 
@@ -481,6 +495,7 @@ void ConsoleController::autoImportScript(Script script, bool force) {
 
 void ConsoleController::flushOutputAccumulationBufferToStore() {
   m_consoleStore.pushResult(m_outputAccumulationBuffer);
+  m_printOutputIsPending = true;
   emptyOutputAccumulationBuffer();
 }
 
@@ -511,11 +526,9 @@ void ConsoleController::appendTextToOutputAccumulationBuffer(const char *text,
   }
 }
 
-// TODO: is it really needed? Maybe discard to optimize?
 void ConsoleController::emptyOutputAccumulationBuffer() {
-  for (int i = 0; i < k_outputAccumulationBufferSize; i++) {
-    m_outputAccumulationBuffer[i] = 0;
-  }
+  // Appended texts are always null-terminated
+  m_outputAccumulationBuffer[0] = 0;
 }
 
 size_t ConsoleController::firstNewLineCharIndex(const char *text,
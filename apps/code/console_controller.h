@@ -99,6 +99,9 @@ class ConsoleController : public Escher::ViewController,
       Escher::Metric::MinimalNumberOfScrollableRowsToFillDisplayHeight(
           KDFont::GlyphHeight(KDFont::Size::Small));
   constexpr static int k_outputAccumulationBufferSize = 1000;
+  /* Printed lines are stored at once but only shown once in a while, since
+   * reloading the console is much slower than printing a line. */
+  constexpr static uint64_t k_printOutputRefreshPeriod = 50;  // ms
   static_assert(ConsoleStore::k_historySize > k_outputAccumulationBufferSize,
                 "Accumulation buffer of console is larger than history");
   static_assert(k_outputAccumulationBufferSize <
@@ -131,6 +134,9 @@ class ConsoleController : public Escher::ViewController,
    * ConsoleLine in the ConsoleStore and empty m_outputAccumulationBuffer. */
   ScriptStore m_scriptStore;
   SandboxController m_sandboxController;
+  uint64_t m_lastPrintOutputRefresh;
+  // The console store has lines which are not shown yet
+  bool m_printOutputIsPending;
   bool m_inputRunLoopActive;
   bool m_autoImportScripts;
 #if EPSILON_GETOPT
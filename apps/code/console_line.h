@@ -2,12 +2,13 @@
 #define CODE_CONSOLE_LINE_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 namespace Code {
 
 class ConsoleLine {
  public:
-  enum class Type {
+  enum class Type : uint8_t {
     CurrentSessionCommand = 0,
     CurrentSessionResult = 1,
     PreviousSessionCommand = 2,
@@ -30,9 +31,6 @@ class ConsoleLine {
     return m_type == Type::CurrentSessionResult ||
            m_type == Type::PreviousSessionResult;
   }
-  static inline size_t sizeOfConsoleLine(size_t textLength) {
-    return 1 + textLength + 1;  // Marker, text, null termination
-  }
 
  private:
   Type m_type;
@@ -2,57 +2,53 @@
 #define CODE_CONSOLE_STORE_H
 
 #include <assert.h>
+#include <ion/ring_buffer.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "console_line.h"
 
 namespace Code {
 
+/* The console history is a ring of lines, whose texts are stored in a ring
+ * buffer of chars. When there is no room left for a new line, the oldest lines
+ * are dropped, which only moves the start of the rings. Each line is indexed,
+ * so that a row of the console is accessed in constant time.
+ * The text of a line is contiguous and null-terminated: when it does not fit
+ * before the end of the buffer, it is stored from the start of the buffer. */
+
 class ConsoleStore {
  public:
-  constexpr static size_t k_historySize = 1024;
-  ConsoleStore() : m_history{0} {}
-  void clear() {
-    assert(k_historySize > 0);
-    m_history[0] = 0;
-  }
+  constexpr static size_t k_historySize = 4096;
+  constexpr static int k_maxNumberOfLines = 256;
+  static_assert(k_historySize <= UINT16_MAX, "Line start is too small");
+
+  void clear() { m_lines.reset(); }
   void startNewSession();
-  ConsoleLine lineAtIndex(int i) const;
-  int numberOfLines() const;
+  ConsoleLine lineAtIndex(int i) const {
+    const Line* line = m_lines.elementAtIndex(i);
+    return ConsoleLine(line->type, m_history + line->start);
+  }
+  int numberOfLines() const { return m_lines.length(); }
   const char* pushCommand(const char* text);
   void pushResult(const char* text);
   void deleteLastLineIfEmpty();
   int deleteCommandAndResultsAtIndex(int index);
 
  private:
-  constexpr static char CurrentSessionCommandMarker = 0x01;
-  constexpr static char CurrentSessionResultMarker = 0x02;
-  constexpr static char PreviousSessionCommandMarker = 0x03;
-  constexpr static char PreviousSessionResultMarker = 0x04;
-  static char makePrevious(char marker) {
-    if (marker == CurrentSessionCommandMarker ||
-        marker == CurrentSessionResultMarker) {
-      return marker + 0x02;
-    }
-    return marker;
-  }
-  const char* push(const char marker, const char* text);
-  ConsoleLine::Type lineTypeForMarker(char marker) const;
-  size_t indexOfNullMarker() const;
-  void deleteLineAtIndex(int index);
-  void deleteFirstLine();
-  /* When there is no room left to store a new ConsoleLine, we have to delete
-   * old ConsoleLines. deleteFirstLine() deletes the first ConsoleLine of
-   * m_history and shifts the rest of the ConsoleLines towards the beginning of
-   * m_history. */
-  void deleteLastLine();
+  struct Line {
+    uint16_t start;
+    uint16_t size;  // Text and null termination
+    ConsoleLine::Type type;
+  };
+
+  const char* push(ConsoleLine::Type type, const char* text);
+  // Return the start of a free area of size bytes, dropping old lines if needed
+  size_t makeRoom(size_t size);
+  void deleteLines(int index, int numberOfLines);
+
+  Ion::RingBuffer<Line, k_maxNumberOfLines> m_lines;
   char m_history[k_historySize];
-  /* The m_history variable sequentially stores an array of ConsoleLine objects.
-   * Each ConsoleLine is stored as follow:
-   *  - First, a char that says whether the ConsoleLine is a Command or a Result
-   *  - Then, the text content of the ConsoleLine
-   *  - Last but not least, a null byte.
-   * The buffer ends whenever the marker char is null. */
 };
 
 }  // namespace Code
@@ -24,6 +24,9 @@ void EditorController::setScript(Script script, int scriptIndex) {
   m_script = script;
   m_scriptIndex = scriptIndex;
 
+  // Compiled scripts should not take the space the script could be edited in
+  ScriptStore::DeleteCompiledScriptsIfStorageIsLow();
+
   /* We edit the script directly in the storage buffer. We thus put all the
    * storage available space at the end of the current edited script and we set
    * its size.
@@ -349,6 +349,10 @@ void MenuController::configureScript() {
 
 void MenuController::editScriptAtIndex(int scriptIndex) {
   assert(scriptIndex >= 0 && scriptIndex < ScriptStore::NumberOfScripts());
+  /* The console heap may have been extended into the free storage, which the
+   * editor puts at the end of the script. The console is reloaded after the
+   * edition anyway. */
+  reloadConsole();
   Script script = ScriptStore::ScriptAtIndex(scriptIndex);
   m_editorController.setScript(script, scriptIndex);
   stackViewController()->push(&m_editorController);
@@ -0,0 +1,48 @@
+#include "python_session.h"
+
+#include <assert.h>
+#include <ion/storage/file_system.h>
+#include <poincare/tree_pool.h>
+#include <python/port/port.h>
+
+namespace Code {
+
+void PythonSession::initWithUser(const void* user, char* heap,
+                                 size_t heapSize, bool extendHeap) {
+  if (m_user && m_user != user && (m_heapIsExtended || extendHeap)) {
+    deinit();
+  }
+  if (!m_user) {
+    /* Tree pool will be used as an extension of the heap. */
+    assert(Poincare::TreePool::sharedPool->numberOfNodes() == 0);
+    Poincare::TreePool::sharedPool.deinit();
+
+    char* heapExtension = nullptr;
+    size_t heapExtensionSize = 0;
+    if (extendHeap) {
+      heapExtension = static_cast<char*>(
+          Ion::Storage::FileSystem::sharedFileSystem->lendAvailableSpace(
+              k_storageSizeKeptFromHeap, &heapExtensionSize));
+    }
+    MicroPython::init(heap, heap + heapSize, heapExtension,
+                      heapExtension + heapExtensionSize);
+    m_heapIsExtended = extendHeap;
+  }
+  m_user = user;
+}
+
+void PythonSession::deinit() {
+  if (m_user) {
+    MicroPython::deinit();
+    if (m_heapIsExtended) {
+      Ion::Storage::FileSystem::sharedFileSystem->reclaimLentSpace();
+      m_heapIsExtended = false;
+    }
+    m_user = nullptr;
+    /* Re-construct the tree pool, which might have been ovewritten by the heap.
+     */
+    Poincare::TreePool::sharedPool.init();
+  }
+}
+
+}  // namespace Code
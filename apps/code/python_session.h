@@ -0,0 +1,37 @@
+#ifndef CODE_PYTHON_SESSION_H
+#define CODE_PYTHON_SESSION_H
+
+#include <stddef.h>
+
+namespace Code {
+
+/* MicroPython is initialized for one user at a time: the console, which runs
+ * scripts, or the editor, which highlights them. The last user is memoized to
+ * avoid re-initiating MicroPython when unneeded.
+ * The heap of the console can be extended into the free storage. Records
+ * cannot grow into the lent storage, so it is reclaimed, and the session
+ * restarted, before another user takes over. */
+
+class PythonSession {
+ public:
+  /* Free storage kept for records when the heap is extended into the storage,
+   * which leaves room for the compiled scripts cache. */
+  constexpr static size_t k_storageSizeKeptFromHeap = 8192;
+
+  PythonSession() : m_user(nullptr), m_heapIsExtended(false) {}
+
+  bool isInited() const { return m_user != nullptr; }
+  bool isUser(const void* user) const { return m_user == user; }
+  bool heapIsExtended() const { return m_heapIsExtended; }
+  void initWithUser(const void* user, char* heap, size_t heapSize,
+                    bool extendHeap);
+  void deinit();
+
+ private:
+  const void* m_user;
+  bool m_heapIsExtended;
+};
+
+}  // namespace Code
+
+#endif
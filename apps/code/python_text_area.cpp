@@ -37,12 +37,13 @@ constexpr KDColor BackgroundColor = KDColorWhite;
 constexpr KDColor HighlightColor = Palette::Select;
 constexpr KDColor DefaultColor = KDColorBlack;
 
-static inline KDColor TokenColor(mp_token_kind_t tokenKind) {
+static inline SyntaxHighlightingCache::Style TokenStyle(
+    mp_token_kind_t tokenKind) {
   if (tokenKind == MP_TOKEN_STRING) {
-    return StringColor;
+    return SyntaxHighlightingCache::Style::String;
   }
   if (tokenKind == MP_TOKEN_INTEGER || tokenKind == MP_TOKEN_FLOAT_OR_IMAG) {
-    return NumberColor;
+    return SyntaxHighlightingCache::Style::Number;
   }
   static_assert(MP_TOKEN_ELLIPSIS + 1 == MP_TOKEN_KW_FALSE &&
                     MP_TOKEN_KW_FALSE + 1 == MP_TOKEN_KW_NONE &&
@@ -81,10 +82,10 @@ static inline KDColor TokenColor(mp_token_kind_t tokenKind) {
                     MP_TOKEN_KW_WITH + 1 == MP_TOKEN_KW_YIELD &&
                     MP_TOKEN_KW_YIELD + 1 == MP_TOKEN_OP_ASSIGN &&
                     MP_TOKEN_OP_ASSIGN + 1 == MP_TOKEN_OP_TILDE,
-                "MP_TOKEN order changed, so Code::PythonTextArea::TokenColor "
+                "MP_TOKEN order changed, so Code::PythonTextArea::TokenStyle "
                 "might need to change too.");
   if (tokenKind >= MP_TOKEN_KW_FALSE && tokenKind <= MP_TOKEN_KW_YIELD) {
-    return KeywordColor;
+    return SyntaxHighlightingCache::Style::Keyword;
   }
   static_assert(
       MP_TOKEN_OP_TILDE + 1 == MP_TOKEN_OP_LESS &&
@@ -131,15 +132,34 @@ static inline KDColor TokenColor(mp_token_kind_t tokenKind) {
           MP_TOKEN_DEL_PERIOD + 1 == MP_TOKEN_DEL_SEMICOLON &&
           MP_TOKEN_DEL_SEMICOLON + 1 == MP_TOKEN_DEL_EQUAL &&
           MP_TOKEN_DEL_EQUAL + 1 == MP_TOKEN_DEL_MINUS_MORE,
-      "MP_TOKEN order changed, so Code::PythonTextArea::TokenColor might need "
+      "MP_TOKEN order changed, so Code::PythonTextArea::TokenStyle might need "
       "to change too.");
 
   if ((tokenKind >= MP_TOKEN_OP_TILDE &&
        tokenKind <= MP_TOKEN_DEL_DBL_STAR_EQUAL) ||
       tokenKind == MP_TOKEN_DEL_EQUAL || tokenKind == MP_TOKEN_DEL_MINUS_MORE) {
-    return OperatorColor;
+    return SyntaxHighlightingCache::Style::Operator;
+  }
+  return SyntaxHighlightingCache::Style::Default;
+}
+
+static KDColor StyleColor(SyntaxHighlightingCache::Style style) {
+  switch (style) {
+    case SyntaxHighlightingCache::Style::Comment:
+      return CommentColor;
+    case SyntaxHighlightingCache::Style::Number:
+      return NumberColor;
+    case SyntaxHighlightingCache::Style::Keyword:
+      return KeywordColor;
+    case SyntaxHighlightingCache::Style::Operator:
+      return OperatorColor;
+    case SyntaxHighlightingCache::Style::Space:
+    case SyntaxHighlightingCache::Style::String:
+      return StringColor;
+    default:
+      assert(style == SyntaxHighlightingCache::Style::Default);
+      return DefaultColor;
   }
-  return DefaultColor;
 }
 
 static inline size_t TokenLength(mp_lexer_t *lex, const char *tokenPosition) {
@@ -260,15 +280,10 @@ void PythonTextArea::ContentView::clearRect(KDContext *ctx, KDRect rect) const {
 #define LOG_DRAW(...)
 #endif
 
-void PythonTextArea::ContentView::drawLine(KDContext *ctx, int line,
-                                           const char *text, size_t byteLength,
-                                           int fromColumn, int toColumn,
-                                           const char *selectionStart,
-                                           const char *selectionEnd) const {
-  LOG_DRAW("Drawing \"%.*s\"\n", byteLength, text);
-
-  assert(m_pythonDelegate->isPythonUser(this));
-
+/* Call addSpan on consecutive spans covering the line, with the style they
+ * should be drawn with. */
+template <typename F>
+static void LexLine(const char *text, size_t byteLength, F addSpan) {
   /* We're using the MicroPython lexer to do syntax highlighting on a per-line
    * basis. This can work, however the MicroPython lexer won't accept a line
    * starting with a whitespace. So we're discarding leading whitespaces
@@ -276,19 +291,13 @@ void PythonTextArea::ContentView::drawLine(KDContext *ctx, int line,
   const char *firstNonSpace = UTF8Helper::NotCodePointSearch(text, ' ');
   if (firstNonSpace != text) {
     // Color the discarded leading whitespaces
-    const char *spacesStart =
-        UTF8Helper::CodePointAtGlyphOffset(text, fromColumn);
-    drawStringAt(ctx, line, fromColumn, spacesStart,
-                 std::min(text + byteLength, firstNonSpace) - spacesStart,
-                 StringColor, BackgroundColor, selectionStart, selectionEnd,
-                 HighlightColor);
+    addSpan(text, std::min(text + byteLength, firstNonSpace) - text,
+            SyntaxHighlightingCache::Style::Space);
   }
   if (UTF8Helper::CodePointIs(firstNonSpace, UCodePointNull)) {
     return;
   }
 
-  const char *autocompleteStart = m_autocomplete ? m_cursorLocation : nullptr;
-
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
     mp_lexer_t *lex = mp_lexer_new_from_str_len(
@@ -302,11 +311,8 @@ void PythonTextArea::ContentView::drawLine(KDContext *ctx, int line,
       tokenFrom = firstNonSpace + lex->tok_column - 1;
       if (tokenFrom != tokenEnd) {
         // We passed over white spaces, we need to color them
-        drawStringAt(
-            ctx, line, UTF8Helper::GlyphOffsetAtCodePoint(text, tokenEnd),
-            tokenEnd, std::min(text + byteLength, tokenFrom) - tokenEnd,
-            StringColor, BackgroundColor, selectionStart, selectionEnd,
-            HighlightColor);
+        addSpan(tokenEnd, std::min(text + byteLength, tokenFrom) - tokenEnd,
+                SyntaxHighlightingCache::Style::Space);
       }
       tokenLength = TokenLength(lex, tokenFrom);
       tokenEnd = tokenFrom + tokenLength;
@@ -328,14 +334,8 @@ void PythonTextArea::ContentView::drawLine(KDContext *ctx, int line,
         }
       }
 
-      // If the token is being autocompleted, use DefaultColor
-      KDColor color =
-          (tokenFrom <= autocompleteStart && autocompleteStart < tokenEnd)
-              ? DefaultColor
-              : TokenColor(lex->tok_kind);
-
-      if (color != DefaultColor && (lex->tok_kind == MP_TOKEN_INTEGER ||
-                                    lex->tok_kind == MP_TOKEN_FLOAT_OR_IMAG)) {
+      SyntaxHighlightingCache::Style style = TokenStyle(lex->tok_kind);
+      if (style == SyntaxHighlightingCache::Style::Number) {
         /* Check if the token can actually be parsed because lexer might label
          * tokens that cannot be parsed as integer or float */
         nlr_buf_t nlrNumberColorParse;
@@ -350,16 +350,13 @@ void PythonTextArea::ContentView::drawLine(KDContext *ctx, int line,
           nlr_pop();
         } else {
           // Parsing raised an exception, use DefaultColor.
-          color = DefaultColor;
+          style = SyntaxHighlightingCache::Style::Default;
         }
       }
 
       LOG_DRAW("Draw \"%.*s\" for token %d\n", tokenLength, tokenFrom,
                lex->tok_kind);
-      drawStringAt(ctx, line,
-                   UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-                   tokenFrom, tokenLength, color, BackgroundColor,
-                   selectionStart, selectionEnd, HighlightColor);
+      addSpan(tokenFrom, tokenLength, style);
 
       if (skipCombining) {
         mp_lexer_to_next(lex);
@@ -370,22 +367,66 @@ void PythonTextArea::ContentView::drawLine(KDContext *ctx, int line,
 
     tokenFrom += tokenLength;
 
-    // Even if the token is being autocompleted, use CommentColor
     if (tokenFrom < text + byteLength) {
       LOG_DRAW("Draw comment \"%.*s\" from %d\n",
                byteLength - (tokenFrom - text), firstNonSpace, tokenFrom);
-      drawStringAt(
-          ctx, line, UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-          tokenFrom, text + byteLength - tokenFrom, CommentColor,
-          BackgroundColor, selectionStart, selectionEnd, HighlightColor);
+      addSpan(tokenFrom, text + byteLength - tokenFrom,
+              SyntaxHighlightingCache::Style::Comment);
     }
 
     mp_lexer_free(lex);
     nlr_pop();
   } else {  // Uncaught exception
     MicroPython::ExecutionEnvironment::HandleExceptionSilently();
-    drawStringAt(ctx, line, fromColumn, text, byteLength, DefaultColor,
-                 BackgroundColor, selectionStart, selectionEnd, HighlightColor);
+    addSpan(text, byteLength, SyntaxHighlightingCache::Style::Default);
+  }
+}
+
+void PythonTextArea::ContentView::drawLine(KDContext *ctx, int line,
+                                           const char *text, size_t byteLength,
+                                           int fromColumn, int toColumn,
+                                           const char *selectionStart,
+                                           const char *selectionEnd) const {
+  LOG_DRAW("Drawing \"%.*s\"\n", byteLength, text);
+
+  assert(m_pythonDelegate->isPythonUser(this));
+
+  const char *autocompleteStart = m_autocomplete ? m_cursorLocation : nullptr;
+
+  auto drawSpan = [&](const char *spanStart, size_t spanLength,
+                      SyntaxHighlightingCache::Style style) {
+    KDColor color = StyleColor(style);
+    /* If the token is being autocompleted, use DefaultColor. Even if it is
+     * being autocompleted, use CommentColor for a comment. */
+    if (style != SyntaxHighlightingCache::Style::Space &&
+        style != SyntaxHighlightingCache::Style::Comment &&
+        spanStart <= autocompleteStart &&
+        autocompleteStart < spanStart + spanLength) {
+      color = DefaultColor;
+    }
+    drawStringAt(ctx, line,
+                 UTF8Helper::GlyphOffsetAtCodePoint(text, spanStart),
+                 spanStart, spanLength, color, BackgroundColor,
+                 selectionStart, selectionEnd, HighlightColor);
+  };
+
+  uint32_t key = SyntaxHighlightingCache::Key(text, byteLength);
+  const SyntaxHighlightingCache::Line *cachedLine =
+      m_syntaxHighlightingCache.find(key, byteLength);
+  if (cachedLine != nullptr) {
+    for (int i = 0; i < cachedLine->numberOfSpans(); i++) {
+      const SyntaxHighlightingCache::Span &span = cachedLine->spanAtIndex(i);
+      drawSpan(text + span.start, span.length, span.style);
+    }
+  } else {
+    SyntaxHighlightingCache::Line lexedLine;
+    LexLine(text, byteLength,
+            [&](const char *spanStart, size_t spanLength,
+                SyntaxHighlightingCache::Style style) {
+              drawSpan(spanStart, spanLength, style);
+              lexedLine.addSpan(spanStart - text, spanLength, style);
+            });
+    m_syntaxHighlightingCache.store(key, byteLength, lexedLine);
   }
 
   // Redraw the autocompleted word in the right color
@@ -3,6 +3,8 @@
 
 #include <escher/text_area.h>
 
+#include "syntax_highlighting_cache.h"
+
 namespace Code {
 
 class App;
@@ -72,6 +74,7 @@ class PythonTextArea : public Escher::TextArea {
 
    private:
     App* m_pythonDelegate;
+    mutable SyntaxHighlightingCache m_syntaxHighlightingCache;
     bool m_autocomplete;
     const char* m_autocompletionEnd;
   };
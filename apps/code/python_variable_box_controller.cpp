@@ -17,6 +17,7 @@
 
 extern "C" {
 #include "py/lexer.h"
+#include "py/misc.h"
 #include "py/nlr.h"
 #include "py/objmodule.h"
 }
@@ -222,6 +223,7 @@ void PythonVariableBoxController::loadFunctionsAndVariables(
 
   // Reset the node counts
   empty();
+  m_symbolIndex.removeOutdatedScripts();
 
   if (textToAutocomplete != nullptr && textToAutocompleteLength < 0) {
     textToAutocompleteLength = strlen(textToAutocomplete);
@@ -295,6 +297,7 @@ const char *PythonVariableBoxController::autocompletionAlternativeAtIndex(
 
 void PythonVariableBoxController::loadVariablesImportedFromScripts() {
   empty();
+  m_symbolIndex.removeOutdatedScripts();
   const int scriptsCount = ScriptStore::NumberOfScripts();
   for (int i = 0; i < scriptsCount; i++) {
     Script script = ScriptStore::ScriptAtIndex(i);
@@ -753,183 +756,356 @@ void PythonVariableBoxController::
     // We already fetched these script variables
     return;
   }
+  /* Mark that we already fetched these script variables, before fetching the
+   * scripts it imports which might import it back. */
+  script.setFetchedForVariableBox(true);
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
-    const char *scriptName = script.fullName();
     const char *scriptContent = script.content();
-    mp_lexer_t *lex = mp_lexer_new_from_str_len(0, scriptContent,
-                                                strlen(scriptContent), false);
-    mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
-    mp_parse_node_t pn = parseTree.root;
-
-    if (MP_PARSE_NODE_IS_STRUCT(pn)) {
-      mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)pn;
-      uint structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(pns);
-      if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
-        // The script is only a single function or variable definition
-        addImportStructFromScript(pns, structKind, scriptName,
-                                  textToAutocomplete, textToAutocompleteLength);
-      } else if (addNodesFromImportMaybe(pns, textToAutocomplete,
-                                         textToAutocompleteLength,
-                                         importFromModules)) {
-        // The script is is only an import, handled in addNodesFromImportMaybe
-      } else if (structKind == PN_file_input_2) {
-        /* At this point, if the script node is not of type "file_input_2", it
-         * will not have main structures of the wanted type.
-         * We look for structures at first level (not inside nested scopes) that
-         * are either function definitions, variables statements or imports. */
-        size_t n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
-        for (size_t i = 0; i < n; i++) {
-          mp_parse_node_t child = pns->nodes[i];
-          if (MP_PARSE_NODE_IS_STRUCT(child)) {
-            mp_parse_node_struct_t *child_pns =
-                (mp_parse_node_struct_t *)(child);
-            structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(child_pns);
-            if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
-              if (addImportStructFromScript(child_pns, structKind, scriptName,
-                                            textToAutocomplete,
-                                            textToAutocompleteLength)) {
-                break;
-              }
-            } else {
-              addNodesFromImportMaybe(child_pns, textToAutocomplete,
-                                      textToAutocompleteLength,
-                                      importFromModules);
-            }
-          }
-        }
+    uint32_t checksum = ScriptSymbolIndex::Checksum(scriptContent);
+    ScriptSymbolIndex::Symbols symbols;
+    if (!m_symbolIndex.find(script, checksum, &symbols)) {
+      // Parse the script once, its symbols are then found in the index
+      mp_lexer_t *lex = mp_lexer_new_from_str_len(0, scriptContent,
+                                                  strlen(scriptContent), false);
+      mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+      int numberOfSymbols = recordScriptSymbols(parseTree.root, nullptr);
+      ScriptSymbolIndex::Symbol *recordedSymbols =
+          m_new(ScriptSymbolIndex::Symbol, numberOfSymbols);
+      recordScriptSymbols(parseTree.root, recordedSymbols);
+      mp_parse_tree_clear(&parseTree);
+      if (!m_symbolIndex.store(script, checksum, recordedSymbols,
+                               numberOfSymbols)) {
+        // The index is full, use the symbols recorded in the Python heap
+        symbols = {.symbols = recordedSymbols,
+                   .numberOfSymbols = numberOfSymbols,
+                   .sortedDefinitions = nullptr,
+                   .numberOfDefinitions = 0};
+      } else {
+        bool found = m_symbolIndex.find(script, checksum, &symbols);
+        assert(found);
+        (void)found;
       }
     }
-    mp_parse_tree_clear(&parseTree);
+    addNodesFromSymbols(symbols, script.fullName(), textToAutocomplete,
+                        textToAutocompleteLength, importFromModules);
     nlr_pop();
   }
-  // Mark that we already fetched these script variables
-  script.setFetchedForVariableBox(true);
 }
 
-bool PythonVariableBoxController::addNodesFromImportMaybe(
-    mp_parse_node_struct_t *parseNode, const char *textToAutocomplete,
-    int textToAutocompleteLength, bool importFromModules) {
+static const char *structName(mp_parse_node_struct_t *structNode) {
+  // Find the id child node, which stores the struct's name
+  size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(structNode);
+  if (childNodesCount < 1) {
+    return nullptr;
+  }
+  mp_parse_node_t child = structNode->nodes[0];
+  if (MP_PARSE_NODE_IS_LEAF(child) &&
+      MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID) {
+    uintptr_t arg = MP_PARSE_NODE_LEAF_ARG(child);
+    return qstr_str(arg);
+  }
+  return nullptr;
+}
+
+// Symbols are only counted if there is no array to record them
+static int recordSymbol(ScriptSymbolIndex::Symbol *symbols, int index,
+                        const char *name,
+                        ScriptSymbolIndex::Symbol::Kind kind) {
+  if (symbols != nullptr) {
+    symbols[index] = {.name = name, .kind = kind};
+  }
+  return index + 1;
+}
+
+int PythonVariableBoxController::recordScriptSymbols(
+    mp_parse_node_t scriptNode, ScriptSymbolIndex::Symbol *symbols) {
+  if (!MP_PARSE_NODE_IS_STRUCT(scriptNode)) {
+    return 0;
+  }
+  mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)scriptNode;
+  if ((uint)MP_PARSE_NODE_STRUCT_KIND(pns) != PN_file_input_2) {
+    // The script is only a single statement
+    return recordStatementSymbols(pns, symbols, 0);
+  }
+  /* We look for structures at first level (not inside nested scopes) that are
+   * either function definitions, variables statements or imports. */
+  int numberOfSymbols = 0;
+  size_t n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
+  for (size_t i = 0; i < n; i++) {
+    mp_parse_node_t child = pns->nodes[i];
+    if (MP_PARSE_NODE_IS_STRUCT(child)) {
+      numberOfSymbols =
+          recordStatementSymbols((mp_parse_node_struct_t *)child, symbols,
+                                 numberOfSymbols);
+    }
+  }
+  return numberOfSymbols;
+}
+
+int PythonVariableBoxController::recordStatementSymbols(
+    mp_parse_node_struct_t *parseNode, ScriptSymbolIndex::Symbol *symbols,
+    int index) {
+  uint structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(parseNode);
+  if (structKind != PN_funcdef && structKind != PN_expr_stmt) {
+    return recordImportSymbols(parseNode, symbols, index);
+  }
+  const char *name = structName(parseNode);
+  if (name == nullptr) {
+    return index;
+  }
+  return recordSymbol(symbols, index, name,
+                      structKind == PN_funcdef
+                          ? ScriptSymbolIndex::Symbol::Kind::Function
+                          : ScriptSymbolIndex::Symbol::Kind::Variable);
+}
+
+int PythonVariableBoxController::recordImportSymbols(
+    mp_parse_node_struct_t *parseNode, ScriptSymbolIndex::Symbol *symbols,
+    int index) {
   // Determine if the node is an import structure
   uint structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(parseNode);
   bool structKindIsImportWithoutFrom = structKind == PN_import_name;
   if (!structKindIsImportWithoutFrom && structKind != PN_import_from &&
       structKind != PN_import_as_names && structKind != PN_import_as_name) {
     // This was not an import structure
-    return false;
+    return index;
   }
-
-  /* loadAllSourceContent will be True if the struct imports all the content
-   * from a script / module (for instance, "import math"), instead of single
-   * items (for instance, "from math import sin"). */
-  bool loadAllSourceContent = structKindIsImportWithoutFrom;
-
+  index = recordSymbol(symbols, index, nullptr,
+                       structKindIsImportWithoutFrom
+                           ? ScriptSymbolIndex::Symbol::Kind::ImportNameBegin
+                           : ScriptSymbolIndex::Symbol::Kind::ImportFromBegin);
   size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(parseNode);
   for (size_t i = 0; i < childNodesCount; i++) {
     mp_parse_node_t child = parseNode->nodes[i];
     if (MP_PARSE_NODE_IS_LEAF(child) &&
         MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID) {
       // Parsing something like "import xyz"
-      const char *id = qstr_str(MP_PARSE_NODE_LEAF_ARG(child));
-
-      /* xyz might be:
-       *  - a module name -> in which case we want no importation source on the
-       *    node. The node will not be added if it is already in the builtins.
-       *  - a script name -> we want to have xyz.py as the importation source
-       *  - a non-existing identifier -> we want no source */
-      const char *sourceId = nullptr;
-      if (importationSourceIsModule(id)) {
-        if (!importFromModules) {
-          return true;
-        }
-      } else {
-        /*  If a module and a script have the same name, the micropython
-         *  importation algorithm first looks for a module then for a script. We
-         *  should thus check that the id is not a module name before retrieving
-         *  a script name to put it as source. */
-        if (!importationSourceIsScript(id, &sourceId) &&
-            !importFromModules) {  // Warning : must be done in this order
-          /* We call importationSourceIsScript to load the script name in
-           * sourceId. We also use it to make sure, if importFromModules is
-           * false, that we are not importing variables from something else than
-           * scripts. */
-          return true;
-        }
-      }
-      /* FIXME : When parsing something like "from math import sin", sin is here
-       * added without description, nor sources although it could have been
-       * fetched with a "from math import *". We try here to at least find a
-       * source name for a suited subtitle */
-      const char *source =
-          (sourceId != nullptr)
-              ? sourceId
-              : I18n::translate(I18n::Message::ImportedModulesAndScripts);
-      if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength,
-                           ScriptNode::Type::WithoutParentheses,
-                           k_importedOrigin, id, -1, source)) {
-        break;
-      }
+      index = recordSymbol(symbols, index,
+                           qstr_str(MP_PARSE_NODE_LEAF_ARG(child)),
+                           ScriptSymbolIndex::Symbol::Kind::ImportedName);
     } else if (MP_PARSE_NODE_IS_STRUCT(child)) {
       // Parsing something like "from math import sin"
-      addNodesFromImportMaybe((mp_parse_node_struct_t *)child,
-                              textToAutocomplete, textToAutocompleteLength,
-                              importFromModules);
+      index = recordImportSymbols((mp_parse_node_struct_t *)child, symbols,
+                                  index);
     } else if (MP_PARSE_NODE_IS_TOKEN(child) &&
                MP_PARSE_NODE_IS_TOKEN_KIND(child, MP_TOKEN_OP_STAR)) {
-      /* Parsing something like "from math import *"
-       * -> Load all the module content */
-      loadAllSourceContent = true;
+      // Parsing something like "from math import *"
+      index = recordSymbol(symbols, index, nullptr,
+                           ScriptSymbolIndex::Symbol::Kind::ImportAll);
     }
   }
+  // The End symbol is named after the source whose content can be imported
+  const char *importationSourceName =
+      childNodesCount > 0 ? importationSourceNameFromNode(parseNode->nodes[0])
+                          : nullptr;
+  return recordSymbol(symbols, index, importationSourceName,
+                      ScriptSymbolIndex::Symbol::Kind::ImportEnd);
+}
 
-  // Fetch a script / module content if needed
-  if (loadAllSourceContent) {
-    assert(childNodesCount > 0);
-    const char *importationSourceName =
-        importationSourceNameFromNode(parseNode->nodes[0]);
-    if (importationSourceName == nullptr) {
-      // For instance, the name is a "dotted name" but not matplotlib.pyplot
-      return true;
-    }
-    int numberOfModuleChildren = 0;
-    const ToolboxMessageTree *moduleChildren = nullptr;
-    if (importationSourceIsModule(importationSourceName, &moduleChildren,
-                                  &numberOfModuleChildren)) {
-      if (!importFromModules) {
-        return true;
+void PythonVariableBoxController::addNodesFromImportMaybe(
+    mp_parse_node_struct_t *parseNode, const char *textToAutocomplete,
+    int textToAutocompleteLength) {
+  int numberOfSymbols = recordImportSymbols(parseNode, nullptr, 0);
+  if (numberOfSymbols == 0) {
+    // This was not an import structure
+    return;
+  }
+  ScriptSymbolIndex::Symbol *symbols =
+      m_new(ScriptSymbolIndex::Symbol, numberOfSymbols);
+  recordImportSymbols(parseNode, symbols, 0);
+  int index = 0;
+  addNodesFromImportSymbols(symbols, &index, true, textToAutocomplete,
+                            textToAutocompleteLength, true);
+  assert(index == numberOfSymbols - 1);
+  m_del(ScriptSymbolIndex::Symbol, symbols, numberOfSymbols);
+}
+
+void PythonVariableBoxController::addNodesFromSymbols(
+    const ScriptSymbolIndex::Symbols &symbols, const char *scriptName,
+    const char *textToAutocomplete, int textToAutocompleteLength,
+    bool importFromModules) {
+  const ScriptSymbolIndex::Symbol *s = symbols.symbols;
+  /* When autocompleting, only the definitions starting with the text to
+   * autocomplete are visited. They are contiguous among the sorted
+   * definitions and are visited in the order of the script. */
+  bool filterDefinitions =
+      textToAutocomplete != nullptr && symbols.sortedDefinitions != nullptr;
+  uint8_t matchingDefinitions[UINT8_MAX];
+  int numberOfMatchingDefinitions = 0;
+  if (filterDefinitions) {
+    const uint8_t *sortedEnd =
+        symbols.sortedDefinitions + symbols.numberOfDefinitions;
+    const uint8_t *first = std::lower_bound(
+        symbols.sortedDefinitions, sortedEnd, textToAutocomplete,
+        [s, textToAutocompleteLength](uint8_t index, const char *text) {
+          return strncmp(s[index].name, text, textToAutocompleteLength) < 0;
+        });
+    const uint8_t *last = std::upper_bound(
+        first, sortedEnd, textToAutocomplete,
+        [s, textToAutocompleteLength](const char *text, uint8_t index) {
+          return strncmp(text, s[index].name, textToAutocompleteLength) < 0;
+        });
+    numberOfMatchingDefinitions = last - first;
+    assert(numberOfMatchingDefinitions <= UINT8_MAX);
+    memcpy(matchingDefinitions, first, numberOfMatchingDefinitions);
+    std::sort(matchingDefinitions,
+              matchingDefinitions + numberOfMatchingDefinitions);
+  }
+  int nextMatchingDefinition = 0;
+  for (int i = 0; i < symbols.numberOfSymbols; i++) {
+    ScriptSymbolIndex::Symbol::Kind kind = s[i].kind;
+    if (kind == ScriptSymbolIndex::Symbol::Kind::Function ||
+        kind == ScriptSymbolIndex::Symbol::Kind::Variable) {
+      if (filterDefinitions) {
+        if (nextMatchingDefinition == numberOfMatchingDefinitions ||
+            matchingDefinitions[nextMatchingDefinition] != i) {
+          continue;
+        }
+        nextMatchingDefinition++;
       }
-      if (moduleChildren != nullptr) {
-        /* The importation source is a module that we display in the toolbox:
-         * get the nodes from the toolbox
-         * We skip the 3 first nodes, which are "import ...", "from ... import
-         * *" and "....function". */
-        constexpr int numberOfNodesToSkip = 3;
-        assert(numberOfModuleChildren > numberOfNodesToSkip);
-        for (int i = numberOfNodesToSkip; i < numberOfModuleChildren; i++) {
-          const char *name = I18n::translate((moduleChildren + i)->label());
-          if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength,
-                               ScriptNode::Type::WithoutParentheses,
-                               k_importedOrigin, name, -1,
-                               importationSourceName,
-                               I18n::translate((moduleChildren + i)->text()))) {
+      if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength,
+                           kind == ScriptSymbolIndex::Symbol::Kind::Function
+                               ? ScriptNode::Type::WithParentheses
+                               : ScriptNode::Type::WithoutParentheses,
+                           k_importedOrigin, s[i].name, -1, scriptName)) {
+        return;
+      }
+    } else {
+      addNodesFromImportSymbols(s, &i, true, textToAutocomplete,
+                                textToAutocompleteLength, importFromModules);
+    }
+  }
+}
+
+void PythonVariableBoxController::addNodesFromImportSymbols(
+    const ScriptSymbolIndex::Symbol *symbols, int *index, bool addNodes,
+    const char *textToAutocomplete, int textToAutocompleteLength,
+    bool importFromModules) {
+  int i = *index;
+  assert(symbols[i].kind == ScriptSymbolIndex::Symbol::Kind::ImportNameBegin ||
+         symbols[i].kind == ScriptSymbolIndex::Symbol::Kind::ImportFromBegin);
+  /* loadAllSourceContent will be True if the struct imports all the content
+   * from a script / module (for instance, "import math"), instead of single
+   * items (for instance, "from math import sin"). */
+  bool loadAllSourceContent =
+      symbols[i].kind == ScriptSymbolIndex::Symbol::Kind::ImportNameBegin;
+  /* Once addNodes is false, the remaining symbols of the import are skipped
+   * until its End symbol. If the import was abandoned, its source content is
+   * not loaded either. */
+  bool abandoned = !addNodes;
+  for (i++; symbols[i].kind != ScriptSymbolIndex::Symbol::Kind::ImportEnd;
+       i++) {
+    switch (symbols[i].kind) {
+      case ScriptSymbolIndex::Symbol::Kind::ImportedName: {
+        if (!addNodes) {
+          break;
+        }
+        const char *id = symbols[i].name;
+        /* id might be:
+         *  - a module name -> in which case we want no importation source on
+         *    the node. The node will not be added if it is already in the
+         *    builtins.
+         *  - a script name -> we want to have id.py as the importation source
+         *  - a non-existing identifier -> we want no source */
+        const char *sourceId = nullptr;
+        if (importationSourceIsModule(id)) {
+          if (!importFromModules) {
+            addNodes = false;
+            abandoned = true;
+            break;
+          }
+        } else {
+          /*  If a module and a script have the same name, the micropython
+           *  importation algorithm first looks for a module then for a script.
+           *  We should thus check that the id is not a module name before
+           *  retrieving a script name to put it as source. */
+          if (!importationSourceIsScript(id, &sourceId) &&
+              !importFromModules) {  // Warning : must be done in this order
+            /* We call importationSourceIsScript to load the script name in
+             * sourceId. We also use it to make sure, if importFromModules is
+             * false, that we are not importing variables from something else
+             * than scripts. */
+            addNodes = false;
+            abandoned = true;
             break;
           }
         }
-      } else {
-        // TODO get module variables that are not in the toolbox
+        /* FIXME : When parsing something like "from math import sin", sin is
+         * here added without description, nor sources although it could have
+         * been fetched with a "from math import *". We try here to at least
+         * find a source name for a suited subtitle */
+        const char *source =
+            (sourceId != nullptr)
+                ? sourceId
+                : I18n::translate(I18n::Message::ImportedModulesAndScripts);
+        if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength,
+                             ScriptNode::Type::WithoutParentheses,
+                             k_importedOrigin, id, -1, source)) {
+          addNodes = false;
+        }
+        break;
       }
-    } else {
-      // Try fetching the nodes from a script
-      Script importedScript;
-      const char *scriptFullName;
-      if (importationSourceIsScript(importationSourceName, &scriptFullName,
-                                    &importedScript)) {
-        loadGlobalAndImportedVariablesInScriptAsImported(
-            importedScript, textToAutocomplete, textToAutocompleteLength);
+      case ScriptSymbolIndex::Symbol::Kind::ImportNameBegin:
+      case ScriptSymbolIndex::Symbol::Kind::ImportFromBegin:
+        addNodesFromImportSymbols(symbols, &i, addNodes, textToAutocomplete,
+                                  textToAutocompleteLength, importFromModules);
+        break;
+      default:
+        assert(symbols[i].kind == ScriptSymbolIndex::Symbol::Kind::ImportAll);
+        if (addNodes) {
+          // Load all the module content
+          loadAllSourceContent = true;
+        }
+    }
+  }
+  *index = i;
+
+  // Fetch a script / module content if needed
+  if (abandoned || !loadAllSourceContent) {
+    return;
+  }
+  const char *importationSourceName = symbols[i].name;
+  if (importationSourceName == nullptr) {
+    // For instance, the name is a "dotted name" but not matplotlib.pyplot
+    return;
+  }
+  int numberOfModuleChildren = 0;
+  const ToolboxMessageTree *moduleChildren = nullptr;
+  if (importationSourceIsModule(importationSourceName, &moduleChildren,
+                                &numberOfModuleChildren)) {
+    if (!importFromModules) {
+      return;
+    }
+    if (moduleChildren != nullptr) {
+      /* The importation source is a module that we display in the toolbox:
+       * get the nodes from the toolbox
+       * We skip the 3 first nodes, which are "import ...", "from ... import
+       * *" and "....function". */
+      constexpr int numberOfNodesToSkip = 3;
+      assert(numberOfModuleChildren > numberOfNodesToSkip);
+      for (int j = numberOfNodesToSkip; j < numberOfModuleChildren; j++) {
+        const char *name = I18n::translate((moduleChildren + j)->label());
+        if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength,
+                             ScriptNode::Type::WithoutParentheses,
+                             k_importedOrigin, name, -1, importationSourceName,
+                             I18n::translate((moduleChildren + j)->text()))) {
+          break;
+        }
       }
+    } else {
+      // TODO get module variables that are not in the toolbox
+    }
+  } else {
+    // Try fetching the nodes from a script
+    Script importedScript;
+    const char *scriptFullName;
+    if (importationSourceIsScript(importationSourceName, &scriptFullName,
+                                  &importedScript)) {
+      loadGlobalAndImportedVariablesInScriptAsImported(
+          importedScript, textToAutocomplete, textToAutocompleteLength);
     }
   }
-  return true;
 }
 
 const char *PythonVariableBoxController::importationSourceNameFromNode(
@@ -998,37 +1174,6 @@ bool PythonVariableBoxController::importationSourceIsScript(
   return true;
 }
 
-const char *structName(mp_parse_node_struct_t *structNode) {
-  // Find the id child node, which stores the struct's name
-  size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(structNode);
-  if (childNodesCount < 1) {
-    return nullptr;
-  }
-  mp_parse_node_t child = structNode->nodes[0];
-  if (MP_PARSE_NODE_IS_LEAF(child) &&
-      MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID) {
-    uintptr_t arg = MP_PARSE_NODE_LEAF_ARG(child);
-    return qstr_str(arg);
-  }
-  return nullptr;
-}
-
-bool PythonVariableBoxController::addImportStructFromScript(
-    mp_parse_node_struct_t *pns, uint structKind, const char *scriptName,
-    const char *textToAutocomplete, int textToAutocompleteLength) {
-  assert(structKind == PN_funcdef || structKind == PN_expr_stmt);
-  // Find the id child node, which stores the struct's name
-  const char *name = structName(pns);
-  if (name == nullptr) {
-    return false;
-  }
-  return addNodeIfMatches(textToAutocomplete, textToAutocompleteLength,
-                          structKind == PN_funcdef
-                              ? ScriptNode::Type::WithParentheses
-                              : ScriptNode::Type::WithoutParentheses,
-                          k_importedOrigin, name, -1, scriptName);
-}
-
 // The returned boolean means we should escape the process
 bool PythonVariableBoxController::addNodeIfMatches(
     const char *textToAutocomplete, int textToAutocompleteLength,
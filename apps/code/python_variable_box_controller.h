@@ -9,6 +9,7 @@
 
 #include "script_node.h"
 #include "script_store.h"
+#include "script_symbol_index.h"
 #include "subtitle_cell.h"
 
 namespace Code {
@@ -139,11 +140,29 @@ class PythonVariableBoxController
   void loadGlobalAndImportedVariablesInScriptAsImported(
       Script script, const char* textToAutocomplete,
       int textToAutocompleteLength, bool importFromModules = true);
-  // Returns true if this was an import structure
-  bool addNodesFromImportMaybe(mp_parse_node_struct_t* parseNode,
+  /* Symbols are recorded from the parse tree of a script, then the nodes are
+   * added from them. Recording functions only count the symbols if there is
+   * no array to record them, and return the index after the last symbol. */
+  int recordScriptSymbols(mp_parse_node_t scriptNode,
+                          ScriptSymbolIndex::Symbol* symbols);
+  int recordStatementSymbols(mp_parse_node_struct_t* parseNode,
+                             ScriptSymbolIndex::Symbol* symbols, int index);
+  int recordImportSymbols(mp_parse_node_struct_t* parseNode,
+                          ScriptSymbolIndex::Symbol* symbols, int index);
+  void addNodesFromImportMaybe(mp_parse_node_struct_t* parseNode,
                                const char* textToAutocomplete,
-                               int textToAutocompleteLength,
-                               bool importFromModules = true);
+                               int textToAutocompleteLength);
+  void addNodesFromSymbols(const ScriptSymbolIndex::Symbols& symbols,
+                           const char* scriptName,
+                           const char* textToAutocomplete,
+                           int textToAutocompleteLength,
+                           bool importFromModules);
+  // Move index to the End symbol of the import starting at index
+  void addNodesFromImportSymbols(const ScriptSymbolIndex::Symbol* symbols,
+                                 int* index, bool addNodes,
+                                 const char* textToAutocomplete,
+                                 int textToAutocompleteLength,
+                                 bool importFromModules);
   const char* importationSourceNameFromNode(mp_parse_node_t& node);
   bool importationSourceIsModule(
       const char* sourceName,
@@ -152,10 +171,6 @@ class PythonVariableBoxController
   bool importationSourceIsScript(const char* sourceName,
                                  const char** scriptFullName,
                                  Script* retreivedScript = nullptr);
-  bool addImportStructFromScript(mp_parse_node_struct_t* pns, uint structKind,
-                                 const char* scriptName,
-                                 const char* textToAutocomplete,
-                                 int textToAutocompleteLength);
   /* Add a node if it completes the text to autocomplete and if it is not
    * already contained in the variable box. The returned boolean means we
    * should escape the node scanning process (due to the lexicographical order
@@ -175,6 +190,7 @@ class PythonVariableBoxController
   uint8_t m_originsCount;                   // Number of origins
   size_t m_rowsPerOrigins[k_maxOrigins];    // Nodes per origins
   const char* m_originsName[k_maxOrigins];  // Text of origins
+  ScriptSymbolIndex m_symbolIndex;
   // This is used to send only the completing text when we are autocompleting
   int m_shortenResultCharCount;
   bool m_displaySubtitles;
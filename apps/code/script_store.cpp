@@ -1,8 +1,11 @@
 #include "script_store.h"
 
+#include <string.h>
+
 namespace Code {
 
 constexpr char ScriptStore::k_scriptExtension[];
+constexpr char ScriptStore::k_compiledScriptExtension[];
 
 bool ScriptStore::ScriptNameIsFree(const char* baseName) {
   return ScriptBaseNamed(baseName).isNull();
@@ -19,6 +22,8 @@ void ScriptStore::DeleteAllScripts() {
   for (int i = NumberOfScripts() - 1; i >= 0; i--) {
     ScriptAtIndex(i).destroy();
   }
+  Ion::Storage::FileSystem::sharedFileSystem->destroyRecordsWithExtension(
+      k_compiledScriptExtension);
 }
 
 bool ScriptStore::IsFull() {
@@ -26,6 +31,14 @@ bool ScriptStore::IsFull() {
          k_fullFreeSpaceSizeLimit;
 }
 
+void ScriptStore::DeleteCompiledScriptsIfStorageIsLow() {
+  Ion::Storage::FileSystem* fileSystem =
+      Ion::Storage::FileSystem::sharedFileSystem;
+  if (fileSystem->availableSize() < k_compiledScriptsFreeSpaceLimit) {
+    fileSystem->destroyRecordsWithExtension(k_compiledScriptExtension);
+  }
+}
+
 const char* ScriptStore::contentOfScript(const char* name,
                                          bool markAsFetched) const {
   Script script = ScriptNamed(name);
@@ -38,6 +51,44 @@ const char* ScriptStore::contentOfScript(const char* name,
   return script.content();
 }
 
+const void* ScriptStore::compiledScript(const char* name, uint32_t checksum,
+                                        size_t* size) const {
+  Ion::Storage::Record record =
+      Ion::Storage::FileSystem::sharedFileSystem->recordNamed(
+          CompiledScriptRecordName(name));
+  if (record.isNull()) {
+    return nullptr;
+  }
+  // The compiled code is preceded by the checksum of its script
+  Ion::Storage::Record::Data data = record.value();
+  if (data.size <= sizeof(checksum) ||
+      memcmp(data.buffer, &checksum, sizeof(checksum)) != 0) {
+    return nullptr;
+  }
+  *size = data.size - sizeof(checksum);
+  return static_cast<const char*>(data.buffer) + sizeof(checksum);
+}
+
+void ScriptStore::storeCompiledScript(const char* name, uint32_t checksum,
+                                      const void* data, size_t size) const {
+  Ion::Storage::FileSystem* fileSystem =
+      Ion::Storage::FileSystem::sharedFileSystem;
+  Ion::Storage::Record::Name recordName = CompiledScriptRecordName(name);
+  fileSystem->recordNamed(recordName).destroy();
+  DeleteOrphanCompiledScripts();
+  size_t recordSize = sizeof(Ion::Storage::FileSystem::record_size_t) +
+                      Ion::Storage::Record::SizeOfName(recordName) +
+                      sizeof(checksum) + size;
+  if (recordSize + k_compiledScriptsFreeSpaceLimit >
+      fileSystem->availableSize()) {
+    return;
+  }
+  const void* dataChunks[] = {&checksum, data};
+  size_t sizeChunks[] = {sizeof(checksum), size};
+  fileSystem->createRecordWithDataChunks(recordName, dataChunks, sizeChunks,
+                                         2);
+}
+
 void ScriptStore::ClearVariableBoxFetchInformation() {
   // TODO optimize fetches
   const int scriptsCount = NumberOfScripts();
@@ -54,4 +105,29 @@ void ScriptStore::ClearConsoleFetchInformation() {
   }
 }
 
+Ion::Storage::Record::Name ScriptStore::CompiledScriptRecordName(
+    const char* scriptName) {
+  Ion::Storage::Record::Name name =
+      Ion::Storage::Record::CreateRecordNameFromFullName(scriptName);
+  name.extension = k_compiledScriptExtension;
+  return name;
+}
+
+void ScriptStore::DeleteOrphanCompiledScripts() {
+  // Compiled scripts of deleted or renamed scripts are never read again
+  Ion::Storage::FileSystem* fileSystem =
+      Ion::Storage::FileSystem::sharedFileSystem;
+  int numberOfCompiledScripts =
+      fileSystem->numberOfRecordsWithExtension(k_compiledScriptExtension);
+  for (int i = numberOfCompiledScripts - 1; i >= 0; i--) {
+    Ion::Storage::Record compiledScript =
+        fileSystem->recordWithExtensionAtIndex(k_compiledScriptExtension, i);
+    Ion::Storage::Record::Name name = compiledScript.name();
+    name.extension = k_scriptExtension;
+    if (fileSystem->recordNamed(name).isNull()) {
+      compiledScript.destroy();
+    }
+  }
+}
+
 }  // namespace Code
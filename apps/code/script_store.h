@@ -16,6 +16,7 @@ class ScriptStore : public MicroPython::ScriptProvider {
  public:
   constexpr static char k_scriptExtension[] = "py";
   constexpr static size_t k_scriptExtensionLength = 2;
+  constexpr static char k_compiledScriptExtension[] = "mpy";
 
   // Storage information
   static bool ScriptNameIsFree(const char* baseName);
@@ -45,10 +46,17 @@ class ScriptStore : public MicroPython::ScriptProvider {
   }
   static void DeleteAllScripts();
   static bool IsFull();
+  /* Compiled scripts can always be rebuilt, they are dropped to give their
+   * space back to the scripts when the storage is running low. */
+  static void DeleteCompiledScriptsIfStorageIsLow();
 
   /* MicroPython::ScriptProvider */
   const char* contentOfScript(const char* name,
                               bool markAsFetched) const override;
+  const void* compiledScript(const char* name, uint32_t checksum,
+                             size_t* size) const override;
+  void storeCompiledScript(const char* name, uint32_t checksum,
+                           const void* data, size_t size) const override;
 
   static void ClearVariableBoxFetchInformation();
   static void ClearConsoleFetchInformation();
@@ -65,6 +73,14 @@ class ScriptStore : public MicroPython::ScriptProvider {
       Script::k_defaultScriptNameMaxSize + k_scriptExtensionLength + 1 + 20 +
       10;
 
+  /* Compiled scripts are only stored if they leave at least
+   * k_compiledScriptsFreeSpaceLimit bytes available in the storage. */
+  constexpr static size_t k_compiledScriptsFreeSpaceLimit = 4096;
+
+  static Ion::Storage::Record::Name CompiledScriptRecordName(
+      const char* scriptName);
+  static void DeleteOrphanCompiledScripts();
+
   static Ion::Storage::Record::ErrorStatus AddScriptFromTemplate(
       const ScriptTemplate* scriptTemplate) {
     return Script::Create(scriptTemplate->name(), scriptTemplate->content());
@@ -0,0 +1,127 @@
+#include "script_symbol_index.h"
+
+#include <assert.h>
+#include <ion/crc.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "script.h"
+
+namespace Code {
+
+uint32_t ScriptSymbolIndex::Checksum(const char* scriptContent) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t*>(scriptContent),
+                        strlen(scriptContent));
+}
+
+bool ScriptSymbolIndex::find(Ion::Storage::Record script, uint32_t checksum,
+                             Symbols* result) const {
+  for (int i = 0; i < m_numberOfEntries; i++) {
+    const Entry* entry = m_entries + i;
+    if (entry->script == script && entry->checksum == checksum) {
+      *result = {.symbols = m_symbols + entry->firstSymbol,
+                 .numberOfSymbols = entry->numberOfSymbols,
+                 .sortedDefinitions = m_sortedDefinitions + entry->firstSymbol,
+                 .numberOfDefinitions = entry->numberOfDefinitions};
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ScriptSymbolIndex::store(Ion::Storage::Record script, uint32_t checksum,
+                              const Symbol* symbols, int numberOfSymbols) {
+  size_t namesSize = 0;
+  for (int i = 0; i < numberOfSymbols; i++) {
+    if (symbols[i].name != nullptr) {
+      namesSize += strlen(symbols[i].name) + 1;
+    }
+  }
+  if (m_numberOfEntries == k_maxNumberOfScripts ||
+      m_numberOfSymbols + numberOfSymbols > k_maxNumberOfSymbols ||
+      m_namesSize + namesSize > k_namesBufferSize) {
+    m_didOverflow = true;
+    return false;
+  }
+  Entry* entry = m_entries + m_numberOfEntries;
+  *entry = {.script = script,
+            .checksum = checksum,
+            .firstName = static_cast<uint16_t>(m_namesSize),
+            .namesSize = static_cast<uint16_t>(namesSize),
+            .firstSymbol = static_cast<uint8_t>(m_numberOfSymbols),
+            .numberOfSymbols = static_cast<uint8_t>(numberOfSymbols),
+            .numberOfDefinitions = 0};
+  Symbol* storedSymbols = m_symbols + m_numberOfSymbols;
+  uint8_t* sortedDefinitions = m_sortedDefinitions + m_numberOfSymbols;
+  for (int i = 0; i < numberOfSymbols; i++) {
+    storedSymbols[i] = symbols[i];
+    if (symbols[i].name != nullptr) {
+      storedSymbols[i].name = m_names + m_namesSize;
+      m_namesSize +=
+          strlcpy(m_names + m_namesSize, symbols[i].name,
+                  k_namesBufferSize - m_namesSize) +
+          1;
+    }
+    if (IsDefinition(symbols[i])) {
+      sortedDefinitions[entry->numberOfDefinitions++] = i;
+    }
+  }
+  std::sort(sortedDefinitions, sortedDefinitions + entry->numberOfDefinitions,
+            [storedSymbols](uint8_t a, uint8_t b) {
+              return strcmp(storedSymbols[a].name, storedSymbols[b].name) < 0;
+            });
+  m_numberOfSymbols += numberOfSymbols;
+  m_numberOfEntries++;
+  return true;
+}
+
+void ScriptSymbolIndex::removeOutdatedScripts() {
+  if (m_didOverflow) {
+    reset();
+    return;
+  }
+  for (int i = m_numberOfEntries - 1; i >= 0; i--) {
+    Script script(m_entries[i].script);
+    if (!Ion::Storage::FileSystem::sharedFileSystem->hasRecord(script) ||
+        Checksum(script.content()) != m_entries[i].checksum) {
+      removeEntry(i);
+    }
+  }
+}
+
+void ScriptSymbolIndex::reset() {
+  m_numberOfEntries = 0;
+  m_numberOfSymbols = 0;
+  m_namesSize = 0;
+  m_didOverflow = false;
+}
+
+void ScriptSymbolIndex::removeEntry(int index) {
+  assert(0 <= index && index < m_numberOfEntries);
+  Entry removed = m_entries[index];
+  // Entries are packed in the order of the buffers
+  int symbolsEnd = removed.firstSymbol + removed.numberOfSymbols;
+  int namesEnd = removed.firstName + removed.namesSize;
+  for (int i = symbolsEnd; i < m_numberOfSymbols; i++) {
+    if (m_symbols[i].name != nullptr) {
+      m_symbols[i].name -= removed.namesSize;
+    }
+  }
+  memmove(m_names + removed.firstName, m_names + namesEnd,
+          m_namesSize - namesEnd);
+  memmove(m_symbols + removed.firstSymbol, m_symbols + symbolsEnd,
+          (m_numberOfSymbols - symbolsEnd) * sizeof(Symbol));
+  memmove(m_sortedDefinitions + removed.firstSymbol,
+          m_sortedDefinitions + symbolsEnd, m_numberOfSymbols - symbolsEnd);
+  m_namesSize -= removed.namesSize;
+  m_numberOfSymbols -= removed.numberOfSymbols;
+  m_numberOfEntries--;
+  for (int i = index; i < m_numberOfEntries; i++) {
+    m_entries[i] = m_entries[i + 1];
+    m_entries[i].firstSymbol -= removed.numberOfSymbols;
+    m_entries[i].firstName -= removed.namesSize;
+  }
+}
+
+}  // namespace Code
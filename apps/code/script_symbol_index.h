@@ -0,0 +1,102 @@
+#ifndef CODE_SCRIPT_SYMBOL_INDEX_H
+#define CODE_SCRIPT_SYMBOL_INDEX_H
+
+#include <ion/storage/record.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Code {
+
+/* The variable box fetches the functions, variables and imports declared at
+ * the top level of the scripts imported by the edited script or by the
+ * console, which used to require parsing these scripts each time it was
+ * opened. This index keeps these symbols for the scripts that were already
+ * parsed, keyed by a checksum of their content. Symbol names are copied in the
+ * index so that it outlives the Python heap, and definitions are sorted by
+ * name so that only the ones completing a prefix are visited.
+ *
+ * Symbols are listed in the order of the script. An import statement is
+ * listed as a Begin symbol, its imported names, possibly nested import
+ * statements, an ImportAll symbol if it imports everything, and an End symbol
+ * named after the source whose content is imported. */
+
+class ScriptSymbolIndex {
+ public:
+  struct Symbol {
+    enum class Kind : uint8_t {
+      Function,
+      Variable,
+      ImportNameBegin,
+      ImportFromBegin,
+      ImportedName,
+      ImportAll,
+      ImportEnd
+    };
+    const char* name;
+    Kind kind;
+  };
+
+  struct Symbols {
+    const Symbol* symbols;
+    int numberOfSymbols;
+    /* Indexes in symbols of the definitions sorted by name, or nullptr if the
+     * definitions are not sorted */
+    const uint8_t* sortedDefinitions;
+    int numberOfDefinitions;
+  };
+
+  static uint32_t Checksum(const char* scriptContent);
+
+  ScriptSymbolIndex() { reset(); }
+
+  // Return false if the script is not indexed with this checksum
+  bool find(Ion::Storage::Record script, uint32_t checksum,
+            Symbols* result) const;
+  // Return false if the symbols do not fit in the index
+  bool store(Ion::Storage::Record script, uint32_t checksum,
+             const Symbol* symbols, int numberOfSymbols);
+  /* Drop the scripts which were edited or deleted since they were indexed, or
+   * everything if a store failed, to make room for the current scripts. The
+   * symbol names move, so no pointer to them must be kept across this call. */
+  void removeOutdatedScripts();
+  void reset();
+
+ private:
+  constexpr static int k_maxNumberOfScripts = 8;
+  constexpr static int k_maxNumberOfSymbols = 96;
+  constexpr static size_t k_namesBufferSize = 768;
+  static_assert(k_maxNumberOfSymbols <= UINT8_MAX &&
+                    k_namesBufferSize <= UINT16_MAX,
+                "Entry members are too small");
+
+  struct Entry {
+    Ion::Storage::Record script;
+    uint32_t checksum;
+    uint16_t firstName;
+    uint16_t namesSize;
+    uint8_t firstSymbol;
+    uint8_t numberOfSymbols;
+    uint8_t numberOfDefinitions;
+  };
+
+  static bool IsDefinition(const Symbol& symbol) {
+    return symbol.kind == Symbol::Kind::Function ||
+           symbol.kind == Symbol::Kind::Variable;
+  }
+  void removeEntry(int index);
+
+  Entry m_entries[k_maxNumberOfScripts];
+  Symbol m_symbols[k_maxNumberOfSymbols];
+  /* The sorted definitions of an entry are stored from its first symbol, as
+   * indexes relative to it. */
+  uint8_t m_sortedDefinitions[k_maxNumberOfSymbols];
+  char m_names[k_namesBufferSize];
+  int m_numberOfEntries;
+  int m_numberOfSymbols;
+  size_t m_namesSize;
+  bool m_didOverflow;
+};
+
+}  // namespace Code
+
+#endif
@@ -0,0 +1,70 @@
+#include "syntax_highlighting_cache.h"
+
+#include <assert.h>
+#include <ion/crc.h>
+
+namespace Code {
+
+void SyntaxHighlightingCache::Line::addSpan(size_t start, size_t length,
+                                            Style style) {
+  if (length == 0) {
+    return;
+  }
+  if (m_numberOfSpans == k_maxNumberOfSpans || start + length > k_maxLength) {
+    m_isComplete = false;
+    return;
+  }
+  m_spans[m_numberOfSpans++] = {.start = static_cast<uint8_t>(start),
+                                .length = static_cast<uint8_t>(length),
+                                .style = style};
+}
+
+const SyntaxHighlightingCache::Span&
+SyntaxHighlightingCache::Line::spanAtIndex(int index) const {
+  assert(0 <= index && index < m_numberOfSpans);
+  return m_spans[index];
+}
+
+uint32_t SyntaxHighlightingCache::Key(const char* text, size_t length) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t*>(text), length);
+}
+
+const SyntaxHighlightingCache::Line* SyntaxHighlightingCache::find(
+    uint32_t key, size_t byteLength) {
+  for (int i = 0; i < m_numberOfEntries; i++) {
+    if (m_entries[i].key == key && m_entries[i].byteLength == byteLength) {
+      m_entries[i].lastUse = m_useCounter++;
+      return &m_entries[i].line;
+    }
+  }
+  return nullptr;
+}
+
+void SyntaxHighlightingCache::store(uint32_t key, size_t byteLength,
+                                    const Line& line) {
+  if (!line.isComplete() || find(key, byteLength) != nullptr) {
+    return;
+  }
+  int index = m_numberOfEntries;
+  if (m_numberOfEntries == k_numberOfEntries) {
+    index = 0;
+    for (int i = 1; i < m_numberOfEntries; i++) {
+      if (m_entries[i].lastUse < m_entries[index].lastUse) {
+        index = i;
+      }
+    }
+  } else {
+    m_numberOfEntries++;
+  }
+  m_entries[index] = {.key = key,
+                      .lastUse = m_useCounter++,
+                      .byteLength = byteLength,
+                      .line = line};
+}
+
+void SyntaxHighlightingCache::reset() {
+  m_numberOfEntries = 0;
+  m_useCounter = 0;
+}
+
+}  // namespace Code
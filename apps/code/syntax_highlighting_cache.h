@@ -0,0 +1,79 @@
+#ifndef CODE_SYNTAX_HIGHLIGHTING_CACHE_H
+#define CODE_SYNTAX_HIGHLIGHTING_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Code {
+
+/* The editor redraws its lines on each keystroke, scroll and cursor blink, and
+ * lexing a line is much slower than drawing it. This cache keeps the colored
+ * spans of the recently drawn lines, keyed by a checksum and the length of
+ * their text, so that only the lines whose text changed are lexed again. The
+ * length is part of the key so that a checksum collision can never replay
+ * spans past the end of a shorter line. The least recently used lines are
+ * evicted first. */
+
+class SyntaxHighlightingCache {
+ public:
+  enum class Style : uint8_t {
+    Space,
+    Default,
+    Comment,
+    Number,
+    Keyword,
+    Operator,
+    String
+  };
+
+  struct Span {
+    uint8_t start;
+    uint8_t length;
+    Style style;
+  };
+
+  class Line {
+   public:
+    constexpr static int k_maxNumberOfSpans = 24;
+    constexpr static size_t k_maxLength = UINT8_MAX;
+
+    Line() : m_numberOfSpans(0), m_isComplete(true) {}
+    // Spans that do not fit make the line incomplete, hence not cached
+    void addSpan(size_t start, size_t length, Style style);
+    bool isComplete() const { return m_isComplete; }
+    int numberOfSpans() const { return m_numberOfSpans; }
+    const Span& spanAtIndex(int index) const;
+
+   private:
+    Span m_spans[k_maxNumberOfSpans];
+    uint8_t m_numberOfSpans;
+    bool m_isComplete;
+  };
+
+  static uint32_t Key(const char* text, size_t length);
+
+  SyntaxHighlightingCache() { reset(); }
+  // Return nullptr if no line of this key and length is cached
+  const Line* find(uint32_t key, size_t byteLength);
+  void store(uint32_t key, size_t byteLength, const Line& line);
+  void reset();
+
+ private:
+  // Roughly the number of lines displayed by the editor
+  constexpr static int k_numberOfEntries = 16;
+
+  struct Entry {
+    uint32_t key;
+    uint32_t lastUse;
+    size_t byteLength;
+    Line line;
+  };
+
+  Entry m_entries[k_numberOfEntries];
+  int m_numberOfEntries;
+  uint32_t m_useCounter;
+};
+
+}  // namespace Code
+
+#endif
@@ -0,0 +1,92 @@
+#include <quiz.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../console_store.h"
+
+using namespace Code;
+
+static void assert_line_is(const ConsoleStore& store, int index,
+                           ConsoleLine::Type type, const char* text) {
+  ConsoleLine line = store.lineAtIndex(index);
+  quiz_assert(line.type() == type);
+  quiz_assert(strcmp(line.text(), text) == 0);
+}
+
+QUIZ_CASE(code_console_store) {
+  ConsoleStore store;
+  quiz_assert(store.numberOfLines() == 0);
+  const char* command = store.pushCommand("print(1)");
+  quiz_assert(strcmp(command, "print(1)") == 0);
+  store.pushResult("1");
+  store.pushCommand("a = 2");
+  store.pushResult("");
+  store.deleteLastLineIfEmpty();
+  quiz_assert(store.numberOfLines() == 3);
+  store.startNewSession();
+  store.pushCommand("a");
+  store.pushResult("2");
+  assert_line_is(store, 0, ConsoleLine::Type::PreviousSessionCommand,
+                 "print(1)");
+  assert_line_is(store, 1, ConsoleLine::Type::PreviousSessionResult, "1");
+  assert_line_is(store, 2, ConsoleLine::Type::PreviousSessionCommand, "a = 2");
+  assert_line_is(store, 3, ConsoleLine::Type::CurrentSessionCommand, "a");
+  assert_line_is(store, 4, ConsoleLine::Type::CurrentSessionResult, "2");
+
+  // Deleting a line deletes its command and all of its results
+  quiz_assert(store.deleteCommandAndResultsAtIndex(1) == 0);
+  quiz_assert(store.numberOfLines() == 3);
+  assert_line_is(store, 0, ConsoleLine::Type::PreviousSessionCommand, "a = 2");
+  assert_line_is(store, 1, ConsoleLine::Type::CurrentSessionCommand, "a");
+  store.clear();
+  quiz_assert(store.numberOfLines() == 0);
+}
+
+QUIZ_CASE(code_console_store_scrollback) {
+  ConsoleStore store;
+  // The oldest lines are dropped when there are too many lines
+  constexpr int numberOfLines = ConsoleStore::k_maxNumberOfLines + 10;
+  char text[16];
+  for (int i = 0; i < numberOfLines; i++) {
+    snprintf(text, sizeof(text), "%d", i);
+    store.pushResult(text);
+  }
+  quiz_assert(store.numberOfLines() == ConsoleStore::k_maxNumberOfLines);
+  for (int i = 0; i < ConsoleStore::k_maxNumberOfLines; i++) {
+    int firstLine = numberOfLines - ConsoleStore::k_maxNumberOfLines;
+    snprintf(text, sizeof(text), "%d", firstLine + i);
+    assert_line_is(store, i, ConsoleLine::Type::CurrentSessionResult, text);
+  }
+
+  // Or when their texts do not fit in the history
+  store.clear();
+  constexpr size_t longLength = ConsoleStore::k_historySize / 3;
+  char longText[longLength + 1];
+  for (int i = 0; i < 10; i++) {
+    memset(longText, 'a' + i, longLength);
+    longText[longLength] = 0;
+    store.pushResult(longText);
+    store.pushCommand("b");
+  }
+  // Only two pairs of lines fit, stored from the start of the history again
+  quiz_assert(store.numberOfLines() == 4);
+  for (int i = 0; i < 4; i += 2) {
+    ConsoleLine line = store.lineAtIndex(i);
+    char expectedChar = 'a' + 8 + i / 2;
+    quiz_assert(strlen(line.text()) == longLength);
+    quiz_assert(line.text()[0] == expectedChar &&
+                line.text()[longLength - 1] == expectedChar);
+    assert_line_is(store, i + 1, ConsoleLine::Type::CurrentSessionCommand,
+                   "b");
+  }
+
+  // Texts longer than the history are truncated
+  store.clear();
+  char tooLongText[ConsoleStore::k_historySize + 10];
+  memset(tooLongText, 'z', sizeof(tooLongText) - 1);
+  tooLongText[sizeof(tooLongText) - 1] = 0;
+  store.pushResult(tooLongText);
+  quiz_assert(store.numberOfLines() == 1);
+  quiz_assert(strlen(store.lineAtIndex(0).text()) ==
+              ConsoleStore::k_historySize - 1);
+}
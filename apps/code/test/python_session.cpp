@@ -0,0 +1,46 @@
+#include <python/port/port.h>
+#include <quiz.h>
+
+#include "../python_session.h"
+#include "../script_store.h"
+
+using namespace Code;
+
+QUIZ_CASE(code_python_session_reclaims_storage) {
+  ScriptStore::DeleteAllScripts();
+  quiz_assert(Script::Create("edited.py", "x = 1\n") ==
+              Ion::Storage::Record::ErrorStatus::None);
+  Ion::Storage::FileSystem *fileSystem =
+      Ion::Storage::FileSystem::sharedFileSystem;
+  Ion::Storage::Record script = fileSystem->recordNamed("edited.py");
+  size_t scriptSize = script.value().size;
+  size_t availableSize = fileSystem->availableSize();
+  quiz_assert(availableSize > PythonSession::k_storageSizeKeptFromHeap);
+
+  constexpr size_t k_heapSize = 16384;
+  static char heap[k_heapSize];
+  int console, editor;
+  PythonSession session;
+
+  // The console heap is extended into the free storage
+  session.initWithUser(&console, heap, k_heapSize, true);
+  quiz_assert(session.isUser(&console) && session.heapIsExtended());
+  quiz_assert(fileSystem->availableSize() ==
+              PythonSession::k_storageSizeKeptFromHeap);
+  // The list does not fit in the heap alone
+  MicroPython::ExecutionEnvironment env;
+  quiz_assert(env.runCode("l = [0] * 4000"));
+
+  // The editor opened after the console gets all the free storage back
+  session.initWithUser(&editor, heap, k_heapSize, false);
+  quiz_assert(session.isUser(&editor) && !session.heapIsExtended());
+  quiz_assert(fileSystem->availableSize() == availableSize);
+  fileSystem->putAvailableSpaceAtEndOfRecord(script);
+  quiz_assert(script.value().size == scriptSize + availableSize);
+  fileSystem->getAvailableSpaceFromEndOfRecord(script, availableSize);
+  quiz_assert(script.value().size == scriptSize);
+
+  session.deinit();
+  quiz_assert(!session.isInited());
+  ScriptStore::DeleteAllScripts();
+}
@@ -0,0 +1,79 @@
+#include <python/port/port.h>
+#include <quiz.h>
+#include <string.h>
+
+#include "../script_store.h"
+
+using namespace Code;
+
+static bool import_script(ScriptStore *store, const char *command) {
+  constexpr size_t k_heapSize = 16384;
+  static char heap[k_heapSize];
+  MicroPython::registerScriptProvider(store);
+  MicroPython::init(heap, heap + k_heapSize);
+  MicroPython::ExecutionEnvironment env;
+  bool result = env.runCode(command);
+  MicroPython::deinit();
+  MicroPython::registerScriptProvider(nullptr);
+  return result;
+}
+
+static void set_content_of_script(const char *name, const char *content) {
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed(name).destroy();
+  quiz_assert(Script::Create(name, content) ==
+              Ion::Storage::Record::ErrorStatus::None);
+}
+
+QUIZ_CASE(code_compiled_script_cache) {
+  ScriptStore::DeleteAllScripts();
+  ScriptStore store;
+  Ion::Storage::FileSystem *fileSystem =
+      Ion::Storage::FileSystem::sharedFileSystem;
+
+  set_content_of_script("cached.py", "x = 6 * 7\n");
+  quiz_assert(fileSystem->recordBaseNamedWithExtension(
+                              "cached", ScriptStore::k_compiledScriptExtension)
+                  .isNull());
+  quiz_assert(import_script(&store, "from cached import *; assert x == 42"));
+  Ion::Storage::Record compiled = fileSystem->recordBaseNamedWithExtension(
+      "cached", ScriptStore::k_compiledScriptExtension);
+  quiz_assert(!compiled.isNull());
+
+  /* The unchanged script is executed from its compiled code: replacing it
+   * with the compiled code of another script changes what is imported. */
+  set_content_of_script("other.py", "y = 1\n");
+  quiz_assert(import_script(&store, "from other import *; assert y == 1"));
+  Ion::Storage::Record::Data otherCompiled =
+      fileSystem
+          ->recordBaseNamedWithExtension(
+              "other", ScriptStore::k_compiledScriptExtension)
+          .value();
+  constexpr size_t k_bufferSize = 256;
+  char buffer[k_bufferSize];
+  quiz_assert(otherCompiled.size <= k_bufferSize);
+  memcpy(buffer, otherCompiled.buffer, otherCompiled.size);
+  // Keep the checksum of cached.py which precedes the compiled code
+  memcpy(buffer, compiled.value().buffer, sizeof(uint32_t));
+  quiz_assert(compiled.setValue({.buffer = buffer,
+                                 .size = otherCompiled.size}) ==
+              Ion::Storage::Record::ErrorStatus::None);
+  quiz_assert(import_script(&store, "from cached import *; assert y == 1"));
+  uint32_t checksum = compiled.checksum();
+
+  // Editing the script invalidates its compiled code
+  set_content_of_script("cached.py", "x = 6 * 8\n");
+  quiz_assert(import_script(&store, "from cached import *; assert x == 48"));
+  quiz_assert(compiled.checksum() != checksum);
+
+  // Compiled code of deleted scripts is dropped
+  fileSystem->recordNamed("cached.py").destroy();
+  set_content_of_script("other.py", "y = 2\n");
+  quiz_assert(import_script(&store, "from other import *; assert y == 2"));
+  quiz_assert(fileSystem->recordBaseNamedWithExtension(
+                              "cached", ScriptStore::k_compiledScriptExtension)
+                  .isNull());
+
+  ScriptStore::DeleteAllScripts();
+  quiz_assert(fileSystem->numberOfRecordsWithExtension(
+                  ScriptStore::k_compiledScriptExtension) == 0);
+}
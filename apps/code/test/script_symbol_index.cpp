@@ -0,0 +1,89 @@
+#include <quiz.h>
+#include <string.h>
+
+#include "../script_store.h"
+#include "../script_symbol_index.h"
+
+using namespace Code;
+
+using Symbol = ScriptSymbolIndex::Symbol;
+
+static Script create_script(const char *name, const char *content) {
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed(name).destroy();
+  quiz_assert(Script::Create(name, content) ==
+              Ion::Storage::Record::ErrorStatus::None);
+  return Script(Ion::Storage::FileSystem::sharedFileSystem->recordNamed(name));
+}
+
+static uint32_t checksum_of(Script script) {
+  return ScriptSymbolIndex::Checksum(script.content());
+}
+
+QUIZ_CASE(code_script_symbol_index) {
+  ScriptStore::DeleteAllScripts();
+  ScriptSymbolIndex index;
+  Script first = create_script("first.py", "def g():\n  pass\nb = 1\na = 2\n");
+  Script second = create_script("second.py", "from first import *\nc = 3\n");
+
+  /* Names are copied in the index, so the recorded symbols do not need to
+   * outlive the store. */
+  char names[] = "g\0b\0a";
+  const Symbol firstSymbols[] = {{names, Symbol::Kind::Function},
+                                 {names + 2, Symbol::Kind::Variable},
+                                 {names + 4, Symbol::Kind::Variable}};
+  const Symbol secondSymbols[] = {{nullptr, Symbol::Kind::ImportFromBegin},
+                                  {"first", Symbol::Kind::ImportedName},
+                                  {nullptr, Symbol::Kind::ImportAll},
+                                  {"first", Symbol::Kind::ImportEnd},
+                                  {"c", Symbol::Kind::Variable}};
+  ScriptSymbolIndex::Symbols symbols;
+  quiz_assert(!index.find(first, checksum_of(first), &symbols));
+  quiz_assert(index.store(first, checksum_of(first), firstSymbols, 3));
+  quiz_assert(index.store(second, checksum_of(second), secondSymbols, 5));
+  memset(names, 0, sizeof(names));
+
+  quiz_assert(index.find(first, checksum_of(first), &symbols));
+  quiz_assert(symbols.numberOfSymbols == 3 &&
+              symbols.numberOfDefinitions == 3);
+  quiz_assert(strcmp(symbols.symbols[0].name, "g") == 0 &&
+              symbols.symbols[0].kind == Symbol::Kind::Function);
+  // Definitions are sorted by name
+  const char *sortedNames[] = {"a", "b", "g"};
+  for (int i = 0; i < 3; i++) {
+    quiz_assert(strcmp(symbols.symbols[symbols.sortedDefinitions[i]].name,
+                       sortedNames[i]) == 0);
+  }
+  quiz_assert(!index.find(first, checksum_of(first) + 1, &symbols));
+
+  // Editing a script drops it and moves the following scripts
+  first = create_script("first.py", "a = 2\n");
+  index.removeOutdatedScripts();
+  quiz_assert(!index.find(first, checksum_of(first), &symbols));
+  quiz_assert(index.find(second, checksum_of(second), &symbols));
+  quiz_assert(symbols.numberOfSymbols == 5 &&
+              symbols.numberOfDefinitions == 1);
+  quiz_assert(symbols.symbols[0].name == nullptr &&
+              strcmp(symbols.symbols[3].name, "first") == 0 &&
+              strcmp(symbols.symbols[symbols.sortedDefinitions[0]].name,
+                     "c") == 0);
+
+  // Deleting a script drops it
+  second.destroy();
+  index.removeOutdatedScripts();
+  quiz_assert(!index.find(second, checksum_of(first), &symbols));
+
+  // A failed store empties the index on the next cleanup
+  quiz_assert(index.store(first, checksum_of(first), firstSymbols, 1));
+  constexpr int k_tooManySymbols = 200;
+  Symbol manySymbols[k_tooManySymbols];
+  for (int i = 0; i < k_tooManySymbols; i++) {
+    manySymbols[i] = {"x", Symbol::Kind::Variable};
+  }
+  Script third = create_script("third.py", "x = 1\n");
+  quiz_assert(!index.store(third, checksum_of(third), manySymbols,
+                           k_tooManySymbols));
+  quiz_assert(index.find(first, checksum_of(first), &symbols));
+  index.removeOutdatedScripts();
+  quiz_assert(!index.find(first, checksum_of(first), &symbols));
+  ScriptStore::DeleteAllScripts();
+}
@@ -0,0 +1,65 @@
+#include <quiz.h>
+#include <string.h>
+
+#include "../syntax_highlighting_cache.h"
+
+using namespace Code;
+
+static const SyntaxHighlightingCache::Line *find_line(
+    SyntaxHighlightingCache *cache, const char *text) {
+  size_t length = strlen(text);
+  return cache->find(SyntaxHighlightingCache::Key(text, length), length);
+}
+
+static void store_line(SyntaxHighlightingCache *cache, const char *text,
+                       const SyntaxHighlightingCache::Line &line) {
+  size_t length = strlen(text);
+  cache->store(SyntaxHighlightingCache::Key(text, length), length, line);
+}
+
+QUIZ_CASE(code_syntax_highlighting_cache) {
+  SyntaxHighlightingCache cache;
+  SyntaxHighlightingCache::Line line;
+  line.addSpan(0, 2, SyntaxHighlightingCache::Style::Space);
+  line.addSpan(2, 3, SyntaxHighlightingCache::Style::Keyword);
+  // Empty spans are not stored
+  line.addSpan(5, 0, SyntaxHighlightingCache::Style::Space);
+  quiz_assert(line.isComplete() && line.numberOfSpans() == 2);
+
+  const char *text = "  def";
+  quiz_assert(find_line(&cache, text) == nullptr);
+  store_line(&cache, text, line);
+  const SyntaxHighlightingCache::Line *cachedLine = find_line(&cache, text);
+  quiz_assert(cachedLine != nullptr && cachedLine->numberOfSpans() == 2);
+  const SyntaxHighlightingCache::Span &span = cachedLine->spanAtIndex(1);
+  quiz_assert(span.start == 2 && span.length == 3 &&
+              span.style == SyntaxHighlightingCache::Style::Keyword);
+
+  // Editing a line changes its key
+  quiz_assert(find_line(&cache, "  df") == nullptr);
+
+  /* A checksum collision with a line of another length misses, so that the
+   * spans of "  def" are never replayed past the end of a shorter line. */
+  uint32_t key = SyntaxHighlightingCache::Key(text, strlen(text));
+  quiz_assert(cache.find(key, strlen(text)) != nullptr);
+  quiz_assert(cache.find(key, 2) == nullptr);
+
+  // Lines with spans that do not fit are not cached
+  SyntaxHighlightingCache::Line longLine;
+  longLine.addSpan(0, SyntaxHighlightingCache::Line::k_maxLength + 1,
+                   SyntaxHighlightingCache::Style::Comment);
+  quiz_assert(!longLine.isComplete());
+  store_line(&cache, "#", longLine);
+  quiz_assert(find_line(&cache, "#") == nullptr);
+
+  // The least recently used lines are evicted first
+  char otherText[] = "x = 0";
+  for (int i = 0; i < 32; i++) {
+    otherText[4] = '0' + i % 10;
+    otherText[0] = 'a' + i / 10;
+    store_line(&cache, otherText, line);
+    quiz_assert(find_line(&cache, text) != nullptr);
+  }
+  cache.reset();
+  quiz_assert(find_line(&cache, text) == nullptr);
+}
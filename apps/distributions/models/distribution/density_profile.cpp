@@ -0,0 +1,93 @@
+#include "density_profile.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "distribution.h"
+
+namespace Distributions {
+
+void DensityProfile::update(const Distribution* distribution, float xMin,
+                            float xMax, int numberOfSamples) {
+  float start = xMin;
+  if (!distribution->isContinuous()) {
+    start = std::ceil(std::max(xMin, 0.0f));
+    numberOfSamples = std::clamp(std::floor(xMax) - start + 1.0f, 0.0f,
+                                 static_cast<float>(k_maxNumberOfSamples));
+  }
+  assert(0 <= numberOfSamples && numberOfSamples <= k_maxNumberOfSamples);
+  if (isValidFor(distribution, start, xMax, numberOfSamples)) {
+    return;
+  }
+  m_distribution = distribution;
+  m_type = distribution->type();
+  m_isContinuous = distribution->isContinuous();
+  m_start = start;
+  m_end = xMax;
+  m_numberOfSamples = numberOfSamples;
+  int n = const_cast<Distribution*>(distribution)->numberOfParameters();
+  assert(n <= k_maxNumberOfParameters);
+  memcpy(m_parameters, distribution->constParametersArray(),
+         n * sizeof(double));
+  float s = step();
+  for (int i = 0; i < m_numberOfSamples; i++) {
+    m_samples[i] = distribution->evaluateAtAbscissa(m_start + i * s);
+  }
+  m_isValid = true;
+}
+
+float DensityProfile::evaluateAtAbscissa(float x) const {
+  assert(m_isValid);
+  float index = (m_isContinuous ? x : std::floor(x)) - m_start;
+  index /= step();
+  if (!(index >= 0.0f && index <= m_numberOfSamples - 1)) {
+    return m_distribution->evaluateAtAbscissa(x);
+  }
+  /* The curve view computes its abscissas with rounding errors, which should
+   * still read the sample of their pixel column. */
+  int i = std::round(index);
+  if (std::fabs(index - i) < k_indexTolerance) {
+    return m_samples[i];
+  }
+  i = std::floor(index);
+  float t = index - i;
+  if (!m_isContinuous) {
+    return m_distribution->evaluateAtAbscissa(x);
+  }
+  assert(i + 1 < m_numberOfSamples);
+  float a = m_samples[i];
+  float b = m_samples[i + 1];
+  if (!std::isfinite(a) || !std::isfinite(b)) {
+    return m_distribution->evaluateAtAbscissa(x);
+  }
+  return a + t * (b - a);
+}
+
+bool DensityProfile::isValidFor(const Distribution* distribution, float start,
+                                float end, int numberOfSamples) const {
+  /* The distribution may be replaced by another one at the same address, so
+   * its type is checked as well. */
+  if (!m_isValid || m_distribution != distribution ||
+      m_type != distribution->type() || m_start != start || m_end != end ||
+      m_numberOfSamples != numberOfSamples) {
+    return false;
+  }
+  int n = const_cast<Distribution*>(distribution)->numberOfParameters();
+  assert(n <= k_maxNumberOfParameters);
+  /* Compare bits rather than values since an uninitialized parameter is
+   * nan. */
+  return memcmp(m_parameters, distribution->constParametersArray(),
+                n * sizeof(double)) == 0;
+}
+
+float DensityProfile::step() const {
+  if (!m_isContinuous || m_numberOfSamples < 2) {
+    return 1.0f;
+  }
+  return (m_end - m_start) / (m_numberOfSamples - 1);
+}
+
+}  // namespace Distributions
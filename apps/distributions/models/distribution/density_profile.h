@@ -0,0 +1,52 @@
+#ifndef DISTRIBUTIONS_MODELS_DISTRIBUTION_DENSITY_PROFILE_H
+#define DISTRIBUTIONS_MODELS_DISTRIBUTION_DENSITY_PROFILE_H
+
+#include <ion/display.h>
+#include <poincare/distribution.h>
+
+namespace Distributions {
+
+class Distribution;
+
+/* Density of a distribution sampled on the abscissas where the distribution
+ * curve view evaluates it: one sample per pixel column for continuous
+ * distributions, the consecutive integers for discrete ones. The curve view
+ * keeps a single profile and only recomputes it when the distribution or the
+ * range change, so that redrawing the curve when the calculation bounds move
+ * does not evaluate the distribution again. */
+
+class DensityProfile {
+ public:
+  constexpr static int k_maxNumberOfSamples = Ion::Display::Width;
+
+  DensityProfile() : m_distribution(nullptr), m_isValid(false) {}
+
+  /* Sample numberOfSamples abscissas evenly spread from xMin to xMax. Discrete
+   * distributions are sampled on the integers from max(xMin, 0) to xMax. */
+  void update(const Distribution* distribution, float xMin, float xMax,
+              int numberOfSamples);
+  // Fall back to the distribution outside of the sampled abscissas
+  float evaluateAtAbscissa(float x) const;
+
+ private:
+  constexpr static int k_maxNumberOfParameters = 3;
+  constexpr static float k_indexTolerance = 1e-3f;
+
+  bool isValidFor(const Distribution* distribution, float start, float end,
+                  int numberOfSamples) const;
+  float step() const;
+
+  const Distribution* m_distribution;
+  float m_samples[k_maxNumberOfSamples];
+  float m_start;
+  float m_end;
+  double m_parameters[k_maxNumberOfParameters];
+  int m_numberOfSamples;
+  Poincare::Distribution::Type m_type;
+  bool m_isContinuous;
+  bool m_isValid;
+};
+
+}  // namespace Distributions
+
+#endif
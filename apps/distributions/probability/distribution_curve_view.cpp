@@ -12,8 +12,8 @@ namespace Distributions {
 
 template <typename T>
 static T evaluateDistribution1D(T x, void *model, void *) {
-  Distribution *distribution = reinterpret_cast<Distribution *>(model);
-  return distribution->evaluateAtAbscissa(x);
+  DensityProfile *profile = reinterpret_cast<DensityProfile *>(model);
+  return profile->evaluateAtAbscissa(x);
 }
 
 static Coordinate2D<float> evaluateDistribution2D(float x, void *model,
@@ -37,17 +37,22 @@ void DistributionPlotPolicy::drawPlot(const Shared::AbstractPlotView *plotView,
                                       KDContext *ctx, KDRect rect) const {
   double lowerBound = m_calculation->lowerBound();
   double upperBound = m_calculation->upperBound();
+  float xMin = plotView->rangeMin(AbstractPlotView::Axis::Horizontal);
+  float xMax = plotView->rangeMax(AbstractPlotView::Axis::Horizontal);
+  // Continuous curves are evaluated once per pixel column of the graph
+  m_densityProfile.update(m_distribution, xMin, xMax,
+                          plotView->graphWidth() + 1);
 
   if (m_distribution->isContinuous()) {
-    CurveDrawing plot(Curve2D(evaluateDistribution2D, m_distribution), nullptr,
-                      m_distribution->xMin(), m_distribution->xMax(),
-                      plotView->pixelWidth(), Palette::YellowDark, true);
+    CurveDrawing plot(Curve2D(evaluateDistribution2D, &m_densityProfile),
+                      nullptr, xMin, xMax, plotView->pixelWidth(),
+                      Palette::YellowDark, true);
     plot.setPatternOptions(Pattern(Palette::YellowDark), lowerBound, upperBound,
                            Curve2D(evaluateZero), Curve2D(), false);
     plot.draw(plotView, ctx, rect);
   } else {
     double context[] = {lowerBound, upperBound};
-    HistogramDrawing plot(evaluateDistribution1D<double>, m_distribution,
+    HistogramDrawing plot(evaluateDistribution1D<double>, &m_densityProfile,
                           context, barIsHighlighted, 0.f, 1.f, false, false,
                           Palette::GrayMiddle, Palette::YellowDark);
     plot.draw(plotView, ctx, rect);
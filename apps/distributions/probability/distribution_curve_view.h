@@ -5,6 +5,7 @@
 #include <poincare/coordinate_2D.h>
 
 #include "../models/calculation/calculation.h"
+#include "../models/distribution/density_profile.h"
 #include "../models/distribution/distribution.h"
 
 namespace Distributions {
@@ -17,6 +18,7 @@ class DistributionPlotPolicy : public Shared::PlotPolicy::WithCurves,
 
   Distribution* m_distribution;
   Calculation* m_calculation;
+  mutable DensityProfile m_densityProfile;
 };
 
 class DistributionCurveView
@@ -8,6 +8,7 @@
 
 #include "distributions/models/distribution/binomial_distribution.h"
 #include "distributions/models/distribution/chi_squared_distribution.h"
+#include "distributions/models/distribution/density_profile.h"
 #include "distributions/models/distribution/exponential_distribution.h"
 #include "distributions/models/distribution/fisher_distribution.h"
 #include "distributions/models/distribution/geometric_distribution.h"
@@ -381,6 +382,13 @@ QUIZ_CASE(distributions_results_poisson) {
       &distribution, 4, 0.00374018590580994);
   assert_cumulative_distributive_function_direct_and_inverse_is(
       &distribution, 16, 0.8354931476833607);
+
+  // POISSON(400000)
+  distribution.setParameterAtIndex(400000.0, 0);
+  assert_cumulative_distributive_function_direct_and_inverse_is(
+      &distribution, 400000, 0.500420522024237);
+  assert_cumulative_distributive_function_direct_and_inverse_is(
+      &distribution, 399000, 0.05696835315512878);
 }
 
 QUIZ_CASE(distributions_results_fisher) {
@@ -429,3 +437,46 @@ QUIZ_CASE(distributions_results_fisher) {
   assert_finite_integral_between_abscissas_is(&distribution, 1.0, 2.0,
                                               0.19555555555555555);
 }
+
+QUIZ_CASE(distributions_density_profile) {
+  Distributions::DensityProfile profile;
+  Distributions::NormalDistribution normal;
+  normal.setParameterAtIndex(0, 0);
+  normal.setParameterAtIndex(1, 1);
+  float xMin = normal.xMin();
+  float xMax = normal.xMax();
+  constexpr int k_numberOfSamples = 301;
+  profile.update(&normal, xMin, xMax, k_numberOfSamples);
+  float step = (xMax - xMin) / (k_numberOfSamples - 1);
+  // Sampled abscissas are exact, others are interpolated
+  for (int i = 0; i < k_numberOfSamples; i += 30) {
+    float x = xMin + i * step;
+    quiz_assert(profile.evaluateAtAbscissa(x) == normal.evaluateAtAbscissa(x));
+    x += step / 3;
+    assert_roughly_equal<float>(profile.evaluateAtAbscissa(x),
+                                normal.evaluateAtAbscissa(x), 1e-2);
+  }
+  // Abscissas out of the range are evaluated
+  quiz_assert(profile.evaluateAtAbscissa(xMax + 1) ==
+              normal.evaluateAtAbscissa(xMax + 1));
+  // Changing a parameter recomputes the profile
+  normal.setParameterAtIndex(2, 0);
+  profile.update(&normal, xMin, xMax, k_numberOfSamples);
+  quiz_assert(profile.evaluateAtAbscissa(xMin + 150 * step) ==
+              normal.evaluateAtAbscissa(xMin + 150 * step));
+
+  Distributions::BinomialDistribution binomial;
+  binomial.setParameterAtIndex(20, 0);
+  binomial.setParameterAtIndex(0.3, 1);
+  profile.update(&binomial, binomial.xMin(), binomial.xMax(),
+                 k_numberOfSamples);
+  for (int k = -2; k <= 25; k++) {
+    quiz_assert(profile.evaluateAtAbscissa(k) ==
+                binomial.evaluateAtAbscissa(k));
+  }
+  binomial.setParameterAtIndex(0.6, 1);
+  profile.update(&binomial, binomial.xMin(), binomial.xMax(),
+                 k_numberOfSamples);
+  quiz_assert(profile.evaluateAtAbscissa(12) ==
+              binomial.evaluateAtAbscissa(12));
+}
@@ -161,6 +161,28 @@ void LogisticModel::specializedInitCoefficientsForFit(double* modelCoefficients,
     a = defaultValue;
   }
 
+  /* Once c is chosen, the model can be linearized:
+   * ln(c/y-1) = ln(a) - b*x
+   * Refine a and b with a linear least squares fit on the data points for
+   * which 0 < y/c < 1. This does not depend on the spread of X data. */
+  BasisFunction basis = [](int k, double x, const void*) {
+    return k == 0 ? 1.0 : x;
+  };
+  TransformFunction transform = [](double, double y, const void* c) {
+    double ratio = y / *static_cast<const double*>(c);
+    return ratio > 0.0 && ratio < 1.0 ? std::log(1.0 / ratio - 1.0) : NAN;
+  };
+  double linearCoefficients[2];
+  if (FitLinearLeastSquares(store, series, linearCoefficients, 2, basis, &c,
+                            transform)) {
+    double linearA = std::exp(linearCoefficients[0]);
+    double linearB = -linearCoefficients[1];
+    if (std::isfinite(linearA) && std::isfinite(linearB) && linearB != 0.0) {
+      a = linearA;
+      b = linearB;
+    }
+  }
+
   modelCoefficients[0] = a;
   modelCoefficients[1] = b;
   modelCoefficients[2] = c;
@@ -73,6 +73,19 @@ void Model::fit(Store* store, int series, double* modelCoefficients,
 
 void Model::privateFit(Store* store, int series, double* modelCoefficients,
                        Poincare::Context* context) {
+  if (isLinearInCoefficients()) {
+    BasisFunction basis = [](int k, double x, const void* model) {
+      /* The partial derivatives of a model linear in its coefficients are its
+       * basis functions and do not depend on the coefficients. */
+      return static_cast<const Model*>(model)->partialDerivate(nullptr, k, x);
+    };
+    if (FitLinearLeastSquares(store, series, modelCoefficients,
+                              numberOfCoefficients(), basis, this)) {
+      return;
+    }
+    /* The problem is rank deficient, fall back on Levenberg-Marquardt which
+     * still finds a minimum thanks to the damping. */
+  }
   initCoefficientsForFit(modelCoefficients, k_initialCoefficientValue, false,
                          store, series);
   fitLevenbergMarquardt(store, series, modelCoefficients, context);
@@ -87,6 +100,72 @@ bool Model::dataSuitableForFit(Store* store, int series) const {
   return store->seriesIsActive(series);
 }
 
+bool Model::FitLinearLeastSquares(Store* store, int series,
+                                  double* coefficients,
+                                  int numberOfCoefficients, BasisFunction basis,
+                                  const void* auxiliary,
+                                  TransformFunction transform) {
+  int n = numberOfCoefficients;
+  assert(n > 0 && n <= k_maxNumberOfCoefficients);
+  /* Decompose A = Q*R, with A(i,k) = basis(k, xi), and compute z = Qt*Y. The
+   * solution of the problem is then the solution of R*coefficients = z.
+   * Each data point adds a row to A, which is zeroed into R with Givens
+   * rotations, so that neither A nor Q need to be stored. */
+  double r[k_maxNumberOfCoefficients * k_maxNumberOfCoefficients] = {0.0};
+  double z[k_maxNumberOfCoefficients] = {0.0};
+  // Squared norms of the columns of A, used to detect rank deficiency
+  double columnNorms[k_maxNumberOfCoefficients] = {0.0};
+  int numberOfPairs = store->numberOfPairsOfSeries(series);
+  for (int i = 0; i < numberOfPairs; i++) {
+    double xi = store->get(series, 0, i);
+    double yi = store->get(series, 1, i);
+    if (transform) {
+      yi = transform(xi, yi, auxiliary);
+      if (!std::isfinite(yi)) {
+        continue;
+      }
+    }
+    double row[k_maxNumberOfCoefficients];
+    for (int k = 0; k < n; k++) {
+      row[k] = basis(k, xi, auxiliary);
+      columnNorms[k] += row[k] * row[k];
+    }
+    for (int k = 0; k < n; k++) {
+      if (row[k] == 0.0) {
+        continue;
+      }
+      // Rotate rows k of R and row so that row[k] becomes 0
+      double h = std::hypot(r[k * n + k], row[k]);
+      double c = r[k * n + k] / h;
+      double s = row[k] / h;
+      r[k * n + k] = h;
+      for (int j = k + 1; j < n; j++) {
+        double rkj = r[k * n + j];
+        r[k * n + j] = c * rkj + s * row[j];
+        row[j] = c * row[j] - s * rkj;
+      }
+      double zk = z[k];
+      z[k] = c * zk + s * yi;
+      yi = c * yi - s * zk;
+    }
+  }
+  // Back substitution
+  for (int k = n - 1; k >= 0; k--) {
+    double rkk = r[k * n + k];
+    if (!std::isfinite(rkk) ||
+        std::fabs(rkk) <=
+            k_rankDeficiencyTolerance * std::sqrt(columnNorms[k])) {
+      return false;
+    }
+    double value = z[k];
+    for (int j = k + 1; j < n; j++) {
+      value -= r[k * n + j] * coefficients[j];
+    }
+    coefficients[k] = value / rkk;
+  }
+  return true;
+}
+
 Expression Model::AdditionOrSubtractionBuilder(Expression e1, Expression e2,
                                                bool addition) {
   if (addition) {
@@ -236,17 +315,19 @@ int Model::solveLinearSystem(double* solutions, double* coefficients,
                              Context* context) {
   int n = solutionDimension;
   assert(n <= k_maxNumberOfCoefficients);
+  /* The alpha prime matrix is symmetric and, unless the data is degenerate,
+   * positive definite: use a Cholesky decomposition. */
   double
       coefficientsSave[k_maxNumberOfCoefficients * k_maxNumberOfCoefficients];
   for (int i = 0; i < n * n; i++) {
     coefficientsSave[i] = coefficients[i];
   }
-  int inverseResult = Matrix::ArrayInverse(coefficients, n, n);
+  bool decomposed = Matrix::ArrayCholeskyDecomposition(coefficients, n);
   int numberOfMatrixModifications = 0;
-  while (inverseResult < 0 &&
-         numberOfMatrixModifications < k_maxMatrixInversionFixIterations) {
-    /* If the matrix is not invertible, we modify it to try to make
-     * it invertible by multiplying the diagonal coefficients by 1+i/n. This
+  while (!decomposed &&
+         numberOfMatrixModifications < k_maxMatrixDecompositionFixIterations) {
+    /* If the matrix is not positive definite, we modify it to try to make
+     * it so by multiplying the diagonal coefficients by 1+i/n. This
      * will change the iterative path of the algorithm towards the chi2 minimum,
      * but not the final solution itself, as the stopping condition is that chi2
      * is at its minimum, so when B is null. */
@@ -254,19 +335,19 @@ int Model::solveLinearSystem(double* solutions, double* coefficients,
       coefficientsSave[i * n + i] =
           (1 + ((double)i) / ((double)n)) * coefficientsSave[i * n + i];
     }
-    inverseResult = Matrix::ArrayInverse(coefficientsSave, n, n);
+    for (int i = 0; i < n * n; i++) {
+      coefficients[i] = coefficientsSave[i];
+    }
+    decomposed = Matrix::ArrayCholeskyDecomposition(coefficients, n);
     numberOfMatrixModifications++;
   }
-  if (inverseResult < 0) {
+  if (!decomposed) {
     return -1;
   }
-  if (numberOfMatrixModifications > 0) {
-    for (int i = 0; i < n * n; i++) {
-      coefficients[i] = coefficientsSave[i];
-    }
+  for (int i = 0; i < n; i++) {
+    solutions[i] = constants[i];
   }
-  Multiplication::computeOnArrays<double>(coefficients, constants, solutions, n,
-                                          n, 1);
+  Matrix::ArrayCholeskySolve(coefficients, n, solutions, 1);
   return 0;
 }
 
@@ -63,6 +63,27 @@ class Model {
   virtual void privateFit(Store* store, int series, double* modelCoefficients,
                           Poincare::Context* context);
   virtual bool dataSuitableForFit(Store* store, int series) const;
+  /* Models whose expression is a linear combination of their coefficients
+   * (the partial derivatives do not depend on the coefficients) are fitted in
+   * a single pass with a linear least squares solver. */
+  virtual bool isLinearInCoefficients() const { return false; }
+
+  /* Solve the linear least squares problem minimizing
+   * sum((yi - sum(coefficients[k] * basis(k, xi)))^2) with a QR decomposition
+   * built from Givens rotations, one data point at a time. This is much better
+   * conditioned than solving the normal equations and only requires
+   * numberOfCoefficients^2 doubles. If transform is provided, yi is replaced
+   * with transform(xi, yi), and data points with a non-finite transformed
+   * value are ignored. Return false if the problem is rank deficient. */
+  typedef double (*BasisFunction)(int k, double x, const void* auxiliary);
+  typedef double (*TransformFunction)(double x, double y,
+                                      const void* auxiliary);
+  static bool FitLinearLeastSquares(Store* store, int series,
+                                    double* coefficients,
+                                    int numberOfCoefficients,
+                                    BasisFunction basis,
+                                    const void* auxiliary,
+                                    TransformFunction transform = nullptr);
 
   /* The expression of the model is not reduced but build by hand. This
    * builder is used so that, if a = 2 and b = -3, the expression ax+b is
@@ -79,9 +100,13 @@ class Model {
     return 0.0;
   };
 
+  /* Relative tolerance on the diagonal of R under which the linear least
+   * squares problem is considered rank deficient. */
+  constexpr static double k_rankDeficiencyTolerance = 1e-13;
+
   // Levenberg-Marquardt
   constexpr static double k_maxIterations = 300;
-  constexpr static double k_maxMatrixInversionFixIterations = 10;
+  constexpr static double k_maxMatrixDecompositionFixIterations = 10;
   constexpr static double k_initialLambda = 0.001;
   constexpr static double k_lambdaFactor = 10;
   constexpr static double k_chi2ChangeCondition = 0.001;
@@ -21,6 +21,7 @@ class ProportionalModel : public Model {
  private:
   Poincare::Expression privateExpression(
       double* modelCoefficients) const override;
+  bool isLinearInCoefficients() const override { return true; }
   double partialDerivate(double* modelCoefficients,
                          int derivateCoefficientIndex, double x) const override;
 };
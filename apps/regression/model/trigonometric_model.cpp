@@ -209,6 +209,32 @@ void TrigonometricModel::specializedInitCoefficientsForFit(
   modelCoefficients[2] = piInAngleUnit / 2 - modelCoefficients[1] * xMax;
   // Init the "y-delta" coefficient d
   modelCoefficients[k_numberOfCoefficients - 1] = (yMax + yMin) / 2.0;
+
+  if (period <= 0) {
+    return;
+  }
+  /* Once the frequency is chosen, the model is linear in the other
+   * coefficients: a*sin(b*x+c)+d = α*sin(b*x)+β*cos(b*x)+d with
+   * α = a*cos(c) and β = a*sin(c). Refine a, c and d with a linear least
+   * squares fit, which is more resilient to noise than the extrema. */
+  double frequency = toRadians() * modelCoefficients[1];
+  BasisFunction basis = [](int k, double x, const void* auxiliary) {
+    double theta = *static_cast<const double*>(auxiliary) * x;
+    return k == 0 ? std::sin(theta) : k == 1 ? std::cos(theta) : 1.0;
+  };
+  double linearCoefficients[3];
+  if (!FitLinearLeastSquares(store, series, linearCoefficients, 3, basis,
+                             &frequency)) {
+    return;
+  }
+  double a = std::hypot(linearCoefficients[0], linearCoefficients[1]);
+  if (!std::isfinite(a) || a == 0.0) {
+    return;
+  }
+  modelCoefficients[0] = a;
+  modelCoefficients[2] =
+      std::atan2(linearCoefficients[1], linearCoefficients[0]) / toRadians();
+  modelCoefficients[k_numberOfCoefficients - 1] = linearCoefficients[2];
 }
 
 void TrigonometricModel::uniformizeCoefficientsFromFit(
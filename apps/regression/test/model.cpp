@@ -561,19 +561,19 @@ QUIZ_CASE(regression_logistic) {
   constexpr double x6[] = {-0.1, -0.09, -0.08, -0.07, -0.06};
   constexpr double y6[] = {1.82e-6, 3.66e-6, 7.34e-6, 1.46e-5, 2.91e-5};
   static_assert(std::size(x6) == std::size(y6), "Column sizes are different");
-  constexpr double coefficients6[] = {1.17e-8, 250.0,
-                                      2.77e-5};  // target : {0.5, 70.0, 0.001};
-  constexpr double r26 = NAN;  // 0.902321;               // target : 1.0;
-  constexpr double sr6 = 4.9002082E-6;
+  constexpr double coefficients6[] = {2.73e-3, 98.8,
+                                      5.86e-5};  // target : {0.5, 70.0, 0.001};
+  constexpr double r26 = NAN;  // target : 1.0;
+  constexpr double sr6 = 1.106E-6;
   assert_regression_is(x6, y6, std::size(x6), Model::Type::Logistic,
                        coefficients6, NAN, r26, sr6);
 
   constexpr double x7[] = {1.0, 3.0, 4.0, 6.0, 8.0};
   constexpr double y7[] = {4.0, 4.0, 0.0, 58.0, 5.0};
   static_assert(std::size(x7) == std::size(y7), "Column sizes are different");
-  constexpr double coefficients7[] = {3.56e8, 4.256, 31.4};  // No target
+  constexpr double coefficients7[] = {3.22e8, 4.234, 31.44};  // No target
   constexpr double r27 = NAN;  // 0.4;  // No target (But should be positive)
-  constexpr double sr7 = 26.88173;
+  constexpr double sr7 = 26.8841;
   assert_regression_is(x7, y7, std::size(x7), Model::Type::Logistic,
                        coefficients7, NAN, r27, sr7);
 }
@@ -2,6 +2,7 @@
 
 #include <apps/apps_container.h>
 #include <assert.h>
+#include <poincare/computation_context.h>
 #include <poincare/function.h>
 #include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
@@ -27,6 +28,7 @@ OMG::GlobalBox<ContinuousFunctionStore> GlobalContext::continuousFunctionStore;
 
 void GlobalContext::storageDidChangeForRecord(Ion::Storage::Record record) {
   m_sequenceContext.resetCache();
+  resetApproximationCache();
   GlobalContext::sequenceStore->storageDidChangeForRecord(record);
   GlobalContext::continuousFunctionStore->storageDidChangeForRecord(record);
 }
@@ -307,6 +309,87 @@ void GlobalContext::prepareForNewApp() {
 void GlobalContext::reset() {
   sequenceStore->reset();
   continuousFunctionStore->reset();
+  resetApproximationCache();
+}
+
+// Approximation cache
+
+static bool IsSymbolicOrRandom(const Expression e) {
+  return Expression::IsSymbolic(e) || Expression::IsRandom(e);
+}
+
+bool GlobalContext::approximationForSymbol(
+    const SymbolAbstract &symbol,
+    const ApproximationContext &approximationContext, bool doublePrecision,
+    std::complex<double> *value) {
+  int index = indexOfCachedApproximation(symbol, approximationContext,
+                                         doublePrecision);
+  if (index < 0 || !m_cachedApproximations[index].isCacheable) {
+    return false;
+  }
+  *value = m_cachedApproximations[index].value;
+  return true;
+}
+
+void GlobalContext::setApproximationForSymbol(
+    const SymbolAbstract &symbol,
+    const ApproximationContext &approximationContext, bool doublePrecision,
+    std::complex<double> value) {
+  if (symbol.type() != ExpressionNode::Type::Symbol ||
+      indexOfCachedApproximation(symbol, approximationContext,
+                                 doublePrecision) >= 0) {
+    return;
+  }
+  /* Only cache symbols whose value does not depend on other symbols (which
+   * could be shadowed by a child context) nor on random draws. Other symbols
+   * are remembered as such, so that their record is not fetched and parsed
+   * again at each approximation. */
+  Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
+  bool isCacheable = false;
+  if (r.hasExtension(Ion::Storage::expressionExtension)) {
+    Expression e = ExpressionForActualSymbol(r);
+    isCacheable =
+        !e.isUninitialized() && !e.recursivelyMatches(IsSymbolicOrRandom);
+  }
+  CachedApproximation *entry =
+      m_cachedApproximations + m_nextCachedApproximationIndex;
+  strlcpy(entry->name, symbol.name(), sizeof(entry->name));
+  entry->value = value;
+  entry->complexFormat = approximationContext.complexFormat();
+  entry->angleUnit = approximationContext.angleUnit();
+  entry->doublePrecision = doublePrecision;
+  entry->isCacheable = isCacheable;
+  m_nextCachedApproximationIndex =
+      (m_nextCachedApproximationIndex + 1) % k_numberOfCachedApproximations;
+}
+
+int GlobalContext::indexOfCachedApproximation(
+    const SymbolAbstract &symbol,
+    const ApproximationContext &approximationContext, bool doublePrecision) {
+  uint32_t storageChangeCounter =
+      Ion::Storage::FileSystem::sharedFileSystem->changeCounter();
+  if (m_approximationCacheStorageChangeCounter != storageChangeCounter) {
+    resetApproximationCache();
+    m_approximationCacheStorageChangeCounter = storageChangeCounter;
+    return -1;
+  }
+  for (int i = 0; i < k_numberOfCachedApproximations; i++) {
+    const CachedApproximation &entry = m_cachedApproximations[i];
+    if (entry.doublePrecision == doublePrecision &&
+        entry.complexFormat == approximationContext.complexFormat() &&
+        entry.angleUnit == approximationContext.angleUnit() &&
+        entry.name[0] != 0 && strcmp(entry.name, symbol.name()) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void GlobalContext::resetApproximationCache() {
+  for (int i = 0; i < k_numberOfCachedApproximations; i++) {
+    m_cachedApproximations[i].name[0] = 0;
+  }
+  m_nextCachedApproximationIndex = 0;
 }
 
 // Parametric components
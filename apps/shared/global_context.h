@@ -44,7 +44,11 @@ class GlobalContext final : public Poincare::Context {
   static void DeleteParametricComponentsOfRecord(Ion::Storage::Record record);
   static void StoreParametricComponentsOfRecord(Ion::Storage::Record record);
 
-  GlobalContext() : m_sequenceContext(this, sequenceStore){};
+  GlobalContext()
+      : m_sequenceContext(this, sequenceStore),
+        m_approximationCacheStorageChangeCounter(0) {
+    resetApproximationCache();
+  };
   /* Expression for symbol
    * The expression recorded in global context is already an expression.
    * Otherwise, we would need the context and the angle unit to evaluate it */
@@ -53,6 +57,14 @@ class GlobalContext final : public Poincare::Context {
   bool setExpressionForSymbolAbstract(
       const Poincare::Expression &expression,
       const Poincare::SymbolAbstract &symbol) override;
+  bool approximationForSymbol(
+      const Poincare::SymbolAbstract &symbol,
+      const Poincare::ApproximationContext &approximationContext,
+      bool doublePrecision, std::complex<double> *value) override;
+  void setApproximationForSymbol(
+      const Poincare::SymbolAbstract &symbol,
+      const Poincare::ApproximationContext &approximationContext,
+      bool doublePrecision, std::complex<double> value) override;
   static OMG::GlobalBox<SequenceStore> sequenceStore;
   static OMG::GlobalBox<ContinuousFunctionStore> continuousFunctionStore;
   void storageDidChangeForRecord(const Ion::Storage::Record record);
@@ -89,7 +101,32 @@ class GlobalContext final : public Poincare::Context {
   // Record getter
   static Ion::Storage::Record SymbolAbstractRecordWithBaseName(
       const char *name);
+  // Approximation cache
+  int indexOfCachedApproximation(
+      const Poincare::SymbolAbstract &symbol,
+      const Poincare::ApproximationContext &approximationContext,
+      bool doublePrecision);
+  void resetApproximationCache();
+
+  constexpr static int k_numberOfCachedApproximations = 8;
+  struct CachedApproximation {
+    // An empty name marks an unused entry
+    char name[Poincare::SymbolAbstractNode::k_maxNameSize];
+    std::complex<double> value;
+    Poincare::Preferences::ComplexFormat complexFormat;
+    Poincare::Preferences::AngleUnit angleUnit;
+    bool doublePrecision;
+    // False if the symbol must be approximated each time
+    bool isCacheable;
+  };
+
   SequenceContext m_sequenceContext;
+  CachedApproximation m_cachedApproximations[k_numberOfCachedApproximations];
+  // Entries are evicted in insertion order
+  int m_nextCachedApproximationIndex;
+  /* The cache is also reset in storageDidChangeForRecord, but global contexts
+   * are not always notified by the storage (in tests for instance). */
+  uint32_t m_approximationCacheStorageChangeCounter;
 };
 
 }  // namespace Shared
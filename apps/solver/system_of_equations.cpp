@@ -4,7 +4,9 @@
 #include <apps/global_preferences.h>
 #include <apps/shared/expression_display_permissions.h>
 #include <apps/shared/poincare_helpers.h>
+#include <poincare/arithmetic.h>
 #include <poincare/matrix.h>
+#include <poincare/numeric_polynomial.h>
 #include <poincare/polynomial.h>
 #include <poincare/print_int.h>
 #include <poincare/symbol.h>
@@ -23,14 +25,19 @@ const Expression
 SystemOfEquations::ContextWithoutT::protectedExpressionForSymbolAbstract(
     const SymbolAbstract &symbol, bool clone,
     ContextWithParent *lastDescendantContext) {
-  if (symbol.type() == ExpressionNode::Type::Symbol &&
-      static_cast<const Symbol &>(symbol).name()[0] == 't') {
+  if (IsParameter(symbol)) {
     return Expression();
   }
   return ContextWithParent::protectedExpressionForSymbolAbstract(
       symbol, clone, lastDescendantContext);
 }
 
+bool SystemOfEquations::ContextWithoutT::IsParameter(
+    const SymbolAbstract &symbol) {
+  return symbol.type() == ExpressionNode::Type::Symbol &&
+         static_cast<const Symbol &>(symbol).name()[0] == 't';
+}
+
 SystemOfEquations::Error SystemOfEquations::exactSolve(Context *context) {
   m_overrideUserVariables = false;
   Error firstError = privateExactSolve(context);
@@ -124,6 +131,29 @@ void SystemOfEquations::approximateSolve(Context *context) {
   assert(m_approximateSolvingRange.isValid());
   double rangeMin = m_approximateSolvingRange.min();
   double rangeMax = m_approximateSolvingRange.max();
+
+  /* The roots of polynomial equations that could not be solved exactly, such
+   * as those of degree higher than 3, are isolated from their coefficients
+   * instead of being searched for by sampling the equation. */
+  NumericPolynomial polynomial = NumericPolynomial::FromExpression(
+      undevelopedExpression, m_variables[0],
+      ApproximationContext(context,
+                           Preferences::SharedPreferences()->complexFormat(),
+                           Preferences::SharedPreferences()->angleUnit()));
+  if (!polynomial.isUndefined() && polynomial.degree() > 0) {
+    double roots[k_maxNumberOfApproximateSolutions + 1];
+    int numberOfRoots = polynomial.realRoots(
+        rangeMin, rangeMax, roots, k_maxNumberOfApproximateSolutions + 1);
+    for (int i = 0; i < numberOfRoots; i++) {
+      if (i == k_maxNumberOfApproximateSolutions) {
+        m_hasMoreSolutions = true;
+      } else {
+        registerSolution(roots[i]);
+      }
+    }
+    return;
+  }
+
   Poincare::Solver<double> solver =
       PoincareHelpers::Solver(rangeMin, rangeMax, m_variables[0], context);
   solver.stretch();
@@ -265,6 +295,115 @@ SystemOfEquations::Error SystemOfEquations::simplifyAndFindVariables(
   return Error::NoError;
 }
 
+/* Solve the system A*x=b, with coefficients of A and b given by rows, using
+ * Bareiss' fraction-free elimination on integers. This avoids canonizing a
+ * Matrix in the TreePool, where intermediate rationals grow quickly.
+ * Return false if a coefficient is not a rational, if the system does not have
+ * a unique solution or if the integers overflow: the system should then be
+ * solved symbolically. */
+static bool SolveRationalLinearSystem(
+    const Expression coefficients[][Expression::k_maxNumberOfVariables],
+    const Expression *constants, int m, int n, Expression *solutions) {
+  if (n <= 0 || m < n) {
+    return false;
+  }
+  Integer ab[EquationStore::k_maxNumberOfEquations]
+            [Expression::k_maxNumberOfVariables + 1];
+  for (int i = 0; i < m; i++) {
+    // Scale each row by the LCM of its denominators to only handle integers
+    Integer denominatorsLCM(1);
+    for (int j = 0; j <= n; j++) {
+      const Expression &e = j < n ? coefficients[i][j] : constants[i];
+      if (e.type() != ExpressionNode::Type::Rational) {
+        return false;
+      }
+      const Rational &r = static_cast<const Rational &>(e);
+      denominatorsLCM =
+          Arithmetic::LCM(denominatorsLCM, r.integerDenominator());
+    }
+    for (int j = 0; j <= n; j++) {
+      const Rational &r = static_cast<const Rational &>(
+          j < n ? coefficients[i][j] : constants[i]);
+      ab[i][j] = Integer::Multiplication(
+          r.signedIntegerNumerator(),
+          Integer::Division(denominatorsLCM, r.integerDenominator()).quotient);
+      if (ab[i][j].isOverflow()) {
+        return false;
+      }
+    }
+  }
+
+  /* Forward elimination: each step divides exactly by the previous pivot, so
+   * that coefficients are minors of (A|b) and stay as small as possible. */
+  Integer previousPivot(1);
+  for (int k = 0; k < n; k++) {
+    // Choose the smallest non-null pivot to limit the coefficients growth
+    int pivotRow = -1;
+    for (int i = k; i < m; i++) {
+      if (!ab[i][k].isZero() &&
+          (pivotRow < 0 ||
+           ab[i][k].numberOfDigits() < ab[pivotRow][k].numberOfDigits())) {
+        pivotRow = i;
+      }
+    }
+    if (pivotRow < 0) {
+      // The rank of A is lower than n
+      return false;
+    }
+    if (pivotRow != k) {
+      for (int j = k; j <= n; j++) {
+        Integer temp = ab[k][j];
+        ab[k][j] = ab[pivotRow][j];
+        ab[pivotRow][j] = temp;
+      }
+    }
+    for (int i = k + 1; i < m; i++) {
+      for (int j = k + 1; j <= n; j++) {
+        Integer numerator = Integer::Subtraction(
+            Integer::Multiplication(ab[k][k], ab[i][j]),
+            Integer::Multiplication(ab[i][k], ab[k][j]));
+        IntegerDivision division = Integer::Division(numerator, previousPivot);
+        if (numerator.isOverflow() || division.quotient.isOverflow()) {
+          return false;
+        }
+        assert(division.remainder.isZero());
+        ab[i][j] = division.quotient;
+      }
+      ab[i][k] = Integer(0);
+    }
+    previousPivot = ab[k][k];
+  }
+  for (int i = n; i < m; i++) {
+    if (!ab[i][n].isZero()) {
+      // Row i describes an equation of the form '0=b', there is no solution
+      return false;
+    }
+  }
+
+  /* Back substitution: the last pivot d is the determinant of the system, and
+   * d*x is an integer vector by Cramer's rule, so divisions are exact. */
+  const Integer &determinant = ab[n - 1][n - 1];
+  Integer scaledSolutions[Expression::k_maxNumberOfVariables];
+  for (int i = n - 1; i >= 0; i--) {
+    Integer value = Integer::Multiplication(determinant, ab[i][n]);
+    for (int j = i + 1; j < n; j++) {
+      value = Integer::Subtraction(
+          value, Integer::Multiplication(ab[i][j], scaledSolutions[j]));
+    }
+    IntegerDivision division = Integer::Division(value, ab[i][i]);
+    if (value.isOverflow() || division.quotient.isOverflow()) {
+      return false;
+    }
+    assert(division.remainder.isZero());
+    scaledSolutions[i] = division.quotient;
+  }
+  for (int i = 0; i < n; i++) {
+    Integer denominator = determinant;
+    solutions[i] = Rational::Builder(scaledSolutions[i], denominator);
+  }
+  return true;
+}
+
 SystemOfEquations::Error SystemOfEquations::solveLinearSystem(
     Context *context, Expression *simplifiedEquations) {
   Preferences::AngleUnit angleUnit =
@@ -295,6 +434,12 @@ SystemOfEquations::Error SystemOfEquations::solveLinearSystem(
   m_hasMoreSolutions = false;
   // n unknown variables and m equations
   int n = m_numberOfSolvingVariables;
+  Expression solutions[Expression::k_maxNumberOfVariables];
+  if (SolveRationalLinearSystem(coefficients, constants, m, n, solutions)) {
+    return registerLinearSystemSolutions(context, simplifiedEquations,
+                                         solutions);
+  }
+
   // Create the matrix (A|b) for the equation Ax=b;
   Matrix ab = Matrix::Builder();
   int abChildren = 0;
@@ -426,8 +571,18 @@ SystemOfEquations::Error SystemOfEquations::solveLinearSystem(
   }
   assert(rank == n);
 
+  for (int i = 0; i < n; i++) {
+    solutions[i] = ab.matrixChild(i, n);
+  }
+  return registerLinearSystemSolutions(context, simplifiedEquations, solutions);
+}
+
+SystemOfEquations::Error SystemOfEquations::registerLinearSystemSolutions(
+    Context *context, Expression *simplifiedEquations, Expression *solutions) {
   // System is fully qualified, register the solutions.
   m_numberOfSolutions = 0;
+  int n = m_numberOfSolvingVariables;
+  const int numberOfOriginalEquations = m_store->numberOfDefinedModels();
 
   // Make sure the solution satisfies dependencies in equations
   VariableContext solutionContexts[k_maxNumberOfSolutions];
@@ -435,8 +590,7 @@ SystemOfEquations::Error SystemOfEquations::solveLinearSystem(
     solutionContexts[i] = VariableContext(
         variable(i), i == 0 ? context : &solutionContexts[i - 1]);
     solutionContexts[i].setExpressionForSymbolAbstract(
-        ab.matrixChild(i, n),
-        Symbol::Builder(variable(i), strlen(variable(i))));
+        solutions[i], Symbol::Builder(variable(i), strlen(variable(i))));
   }
   ReductionContext reductionContextWithSolutions(
       &solutionContexts[n - 1], m_complexFormat,
@@ -457,7 +611,7 @@ SystemOfEquations::Error SystemOfEquations::solveLinearSystem(
   SolutionType solutionType =
       m_hasMoreSolutions ? SolutionType::Formal : SolutionType::Exact;
   for (int i = 0; i < n; i++) {
-    Error error = registerSolution(ab.matrixChild(i, n), context, solutionType);
+    Error error = registerSolution(solutions[i], context, solutionType);
     if (error != Error::NoError) {
       return error;
     }
@@ -97,8 +97,26 @@ class SystemOfEquations {
   class ContextWithoutT : public Poincare::ContextWithParent {
    public:
     using Poincare::ContextWithParent::ContextWithParent;
+    bool approximationForSymbol(
+        const Poincare::SymbolAbstract& symbol,
+        const Poincare::ApproximationContext& approximationContext,
+        bool doublePrecision, std::complex<double>* value) override {
+      return !IsParameter(symbol) &&
+             ContextWithParent::approximationForSymbol(
+                 symbol, approximationContext, doublePrecision, value);
+    }
+    void setApproximationForSymbol(
+        const Poincare::SymbolAbstract& symbol,
+        const Poincare::ApproximationContext& approximationContext,
+        bool doublePrecision, std::complex<double> value) override {
+      if (!IsParameter(symbol)) {
+        ContextWithParent::setApproximationForSymbol(
+            symbol, approximationContext, doublePrecision, value);
+      }
+    }
 
    private:
+    static bool IsParameter(const Poincare::SymbolAbstract& symbol);
     const Poincare::Expression protectedExpressionForSymbolAbstract(
         const Poincare::SymbolAbstract& symbol, bool clone,
         Poincare::ContextWithParent* lastDescendantContext) override;
@@ -111,6 +129,9 @@ class SystemOfEquations {
                                  Poincare::Expression* simplifiedEquations);
   Error solveLinearSystem(Poincare::Context* context,
                           Poincare::Expression* simplifiedEquations);
+  Error registerLinearSystemSolutions(Poincare::Context* context,
+                                      Poincare::Expression* simplifiedEquations,
+                                      Poincare::Expression* solutions);
   Error solvePolynomial(Poincare::Context* context,
                         Poincare::Expression* simplifiedEquations);
   uint32_t tagParametersUsedAsVariables() const;
@@ -24,6 +24,14 @@ QUIZ_CASE(solver_linear_system) {
   assert_solves_to({"x+y=0", "3x+y+z=-5", "4z-π=0"},
                    {"x=(-π-20)/8", "y=(π+20)/8", "z=π/4"});
   assert_solves_to({"x+y=0", "3x+y=-5"}, {"x=-5/2", "y=5/2"});
+  assert_solves_to(
+      {"-500952a+242859b+141332c-726483x-224147y+920876z=2193652",
+       "266513a-5837b+312231c+218136x-862576y+270035z=-2841111",
+       "-972384a+905931b+756300c-15948x-456095y+155080z=-3900043",
+       "-508572a-597883b+503969c-13785x+134505y+754187z=1441237",
+       "152661a-1014b-167148c+340224x+805695y-684134z=962227",
+       "-513624a+331400b-682024c+820423x+941618y+97191z=-3474772"},
+      {"a=3", "b=-1", "c=2", "x=-5", "y=4", "z=1"});
   assert_solves_to_infinite_solutions("0=0");
   assert_solves_to_infinite_solutions({"x+y=0"}, {"x=-t", "y=t"});
   assert_solves_to_infinite_solutions({"x-x=0"}, {"x=t"});
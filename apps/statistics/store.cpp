@@ -26,6 +26,9 @@ Store::Store(GlobalContext* context, UserPreferences* userPreferences)
     : StatisticsStore(context, userPreferences),
       m_memoizedMaxNumberOfModes(-1),
       m_graphViewInvalidated(true) {
+  for (int s = 0; s < k_numberOfSeries; s++) {
+    m_memoizedNumberOfModes[s] = -1;
+  }
   initDatasets();
 }
 
@@ -371,10 +374,8 @@ double Store::squaredValueSum(int series) const {
 }
 
 int Store::numberOfModes(int series) const {
-  double modeFreq;
-  int modesTotal;
-  computeModes(series, -1, &modeFreq, &modesTotal);
-  return modesTotal;
+  computeModes(series);
+  return m_memoizedNumberOfModes[series];
 }
 
 bool Store::shouldDisplayModes(int series) const {
@@ -396,61 +397,62 @@ int Store::totalNumberOfModes() const {
 }
 
 double Store::modeAtIndex(int series, int index) const {
-  double modeFreq;
-  int modesTotal;
-  return computeModes(series, index, &modeFreq, &modesTotal);
+  computeModes(series);
+  assert(index >= 0 && index < m_memoizedNumberOfModes[series]);
+  return get(series, 0, m_memoizedModesValueIndexes[series][index]);
 }
 
 double Store::modeFrequency(int series) const {
-  double modeFreq;
-  int modesTotal;
-  computeModes(series, -1, &modeFreq, &modesTotal);
-  return modeFreq;
+  computeModes(series);
+  return m_memoizedModeFrequency[series];
 }
 
-double Store::computeModes(int series, int i, double* modeFreq,
-                           int* modesTotal) const {
-  *modesTotal = 0;
-  *modeFreq = 0.0;
-  double ithValue = NAN;
+void Store::computeModes(int series) const {
+  if (m_memoizedNumberOfModes[series] >= 0) {
+    return;
+  }
+  int modesTotal = 0;
+  double modeFreq = 0.0;
+  uint8_t* modes = m_memoizedModesValueIndexes[series];
+  int currentValueIndex = -1;
   double currentValue = NAN;
   double currentValueFrequency = NAN;
   int numberOfPairs = numberOfPairsOfSeries(series);
   for (int j = 0; j <= numberOfPairs; j++) {
+    int valueIndex;
     double value, valueFrequency;
     if (j < numberOfPairs) {
-      int valueIndex = valueIndexAtSortedIndex(series, j);
+      valueIndex = valueIndexAtSortedIndex(series, j);
       value = get(series, 0, valueIndex);
       valueFrequency = get(series, 1, valueIndex);
     } else {
       // Iterating one last time to process the last value
+      valueIndex = -1;
       value = valueFrequency = NAN;
     }
     // currentValue != value returns true if currentValue or value is NAN
     if (currentValue != value) {
       // A new value has been found
-      if (currentValueFrequency > *modeFreq) {
+      if (currentValueFrequency > modeFreq) {
         // A better mode has been found, reset solutions
-        *modeFreq = currentValueFrequency;
-        *modesTotal = 0;
-        ithValue = NAN;
+        modeFreq = currentValueFrequency;
+        modesTotal = 0;
       }
-      if (currentValueFrequency == *modeFreq) {
+      if (currentValueFrequency == modeFreq) {
         // Another mode has been found
-        if (*modesTotal == i) {
-          ithValue = currentValue;
-        }
-        *modesTotal += 1;
+        assert(currentValueIndex >= 0 && modesTotal < k_maxNumberOfPairs);
+        modes[modesTotal++] = static_cast<uint8_t>(currentValueIndex);
       }
       currentValueFrequency = 0.0;
       currentValue = value;
+      currentValueIndex = valueIndex;
     }
     currentValueFrequency += valueFrequency;
   }
-  // A valid total, frequency and ithValue (if requested) have been calculated
-  assert(*modesTotal > 0 && *modeFreq > 0.0 &&
-         std::isnan(ithValue) == (i == -1));
-  return ithValue;
+  // A valid total and frequency have been calculated
+  assert(modesTotal > 0 && modeFreq > 0.0);
+  m_memoizedNumberOfModes[series] = modesTotal;
+  m_memoizedModeFrequency[series] = modeFreq;
 }
 
 bool Store::deleteValueAtIndex(int series, int i, int j,
@@ -480,6 +482,7 @@ int Store::computeRelativeColumnAndSeries(int* i) const {
 
 bool Store::updateSeries(int series, bool delayUpdate) {
   m_memoizedMaxNumberOfModes = -1;
+  m_memoizedNumberOfModes[series] = -1;
   return StatisticsStore::updateSeries(series, delayUpdate);
 }
 
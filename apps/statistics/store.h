@@ -160,10 +160,9 @@ class Store : public Shared::StatisticsStore {
   void countDistinctValues(int series, int start, int end, int i,
                            bool handleNullFrequencies, double *value,
                            int *distinctValues) const;
-  /* Find the i-th mode (ordered by value). Also retrieve the total number of
-   * modes and the mode frequency. */
-  double computeModes(int series, int i, double *modeFreq,
-                      int *modesTotal) const;
+  /* Compute all the modes (ordered by value) and the mode frequency in a
+   * single pass over the sorted values, and memoize them. */
+  void computeModes(int series) const;
   double sortedElementAtCumulatedFrequency(
       int series, double k, bool createMiddleElement = false) const;
   double sortedElementAtCumulatedPopulation(
@@ -180,6 +179,13 @@ class Store : public Shared::StatisticsStore {
   /* Memoizing the max number of modes because the CalculationControllers needs
    * it in numberOfRows(), which is used a lot. */
   mutable int m_memoizedMaxNumberOfModes;
+  /* Memoizing the modes of each series, as the CalculationController asks for
+   * them one at a time. Modes are stored as value indexes, the number of modes
+   * is -1 if they need to be recomputed. */
+  mutable int m_memoizedNumberOfModes[k_numberOfSeries];
+  mutable double m_memoizedModeFrequency[k_numberOfSeries];
+  mutable uint8_t m_memoizedModesValueIndexes[k_numberOfSeries]
+                                             [k_maxNumberOfPairs];
   bool m_graphViewInvalidated;
 };
 
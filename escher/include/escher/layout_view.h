@@ -17,7 +17,9 @@ class LayoutView : public GlyphsView {
   using TitleType = Poincare::Layout;
 
   LayoutView(KDGlyph::Format format = {})
-      : GlyphsView(format), m_horizontalMargin(0) {}
+      : GlyphsView(format),
+        m_horizontalMargin(0),
+        m_cachesLayoutMetrics(false) {}
 
   Poincare::Layout layout() const override { return m_layout; }
   bool setLayout(Poincare::Layout layout);
@@ -26,6 +28,12 @@ class LayoutView : public GlyphsView {
   void setHorizontalMargin(KDCoordinate horizontalMargin) {
     m_horizontalMargin = horizontalMargin;
   }
+  /* Views whose layouts are never edited in place can share the metrics of
+   * their layouts through the Poincare::LayoutMetricsCache, sparing a full
+   * measure of the layout tree each time an identical layout is rebuilt. */
+  void setCachesLayoutMetrics(bool caches) { m_cachesLayoutMetrics = caches; }
+  KDSize layoutSize() const;
+  KDCoordinate layoutBaseline() const;
   int numberOfLayouts() const;
   KDSize minimalSizeForOptimalDisplay() const override;
   KDPoint drawingOrigin() const;
@@ -47,7 +55,9 @@ class LayoutView : public GlyphsView {
   virtual Poincare::LayoutSelection selection() const {
     return Poincare::LayoutSelection();
   }
+  bool layoutMetrics(KDSize* size, KDCoordinate* baseline) const;
   KDCoordinate m_horizontalMargin;
+  bool m_cachesLayoutMetrics;
 };
 
 class LayoutViewWithCursor : public LayoutView {
@@ -1,6 +1,7 @@
 #include <escher/layout_view.h>
 #include <escher/palette.h>
 #include <poincare/code_point_layout.h>
+#include <poincare/layout_metrics_cache.h>
 
 #include <algorithm>
 
@@ -26,17 +27,60 @@ int LayoutView::numberOfLayouts() const {
   return m_layout.numberOfDescendants(true);
 }
 
+KDSize LayoutView::layoutSize() const {
+  KDSize size = KDSizeZero;
+  KDCoordinate baseline = 0;
+  if (!layoutMetrics(&size, &baseline)) {
+    size = m_layout.layoutSize(font());
+  }
+  return size;
+}
+
+KDCoordinate LayoutView::layoutBaseline() const {
+  KDSize size = KDSizeZero;
+  KDCoordinate baseline = 0;
+  if (!layoutMetrics(&size, &baseline)) {
+    baseline = m_layout.baseline(font());
+  }
+  return baseline;
+}
+
+bool LayoutView::layoutMetrics(KDSize* size, KDCoordinate* baseline) const {
+  assert(!m_layout.isUninitialized());
+  if (!m_cachesLayoutMetrics) {
+    return false;
+  }
+  /* The cache is only looked up until the metrics are memoized in the layout.
+   * Modifying the layout invalidates them, so that the signature of the
+   * modified layout is computed on the next call. */
+  LayoutNode* node = m_layout.node();
+  if (!node->hasMemoizedMetrics(font())) {
+    uint8_t buffer[LayoutMetricsCache::k_maxSignatureSize];
+    LayoutNode::Signature signature(buffer, sizeof(buffer));
+    node->sign(&signature);
+    LayoutMetricsCache* cache = LayoutMetricsCache::SharedCache();
+    if (cache->find(signature, font(), size, baseline)) {
+      node->memoizeMetrics(font(), *size, *baseline);
+      return true;
+    }
+    cache->store(signature, font(), node->layoutSize(font()),
+                 node->baseline(font()));
+  }
+  *size = node->layoutSize(font());
+  *baseline = node->baseline(font());
+  return true;
+}
+
 KDSize LayoutView::minimalSizeForOptimalDisplay() const {
   if (m_layout.isUninitialized()) {
     return KDSizeZero;
   }
-  KDSize layoutSize = m_layout.layoutSize(font());
-  return KDSize(layoutSize.width() + 2 * m_horizontalMargin,
-                layoutSize.height());
+  KDSize size = layoutSize();
+  return KDSize(size.width() + 2 * m_horizontalMargin, size.height());
 }
 
 KDPoint LayoutView::drawingOrigin() const {
-  KDSize layoutSize = m_layout.layoutSize(font());
+  KDSize layoutSize = this->layoutSize();
   return KDPoint(
       m_horizontalMargin +
           m_glyphFormat.horizontalAlignment *
@@ -12,6 +12,7 @@ ScrollableLayoutView::ScrollableLayoutView(Responder* parentResponder,
                                            KDGlyph::Format format)
     : ScrollableView(parentResponder, &m_layoutView, this),
       m_layoutView(format) {
+  m_layoutView.setCachesLayoutMetrics(true);
   decorator()->setFont(format.style.font);
   setMargins(
       {{leftRightMargin, leftRightMargin}, {topBottomMargin, topBottomMargin}});
@@ -19,7 +19,10 @@ AbstractScrollableMultipleLayoutsView::ContentCell::ContentCell(
       m_displayCenter(true),
       m_displayableCenter(true),
       m_rightIsStrictlyEqual(false),
-      m_horizontalAlignment(horizontalAlignment) {}
+      m_horizontalAlignment(horizontalAlignment) {
+  m_rightLayoutView.setCachesLayoutMetrics(true);
+  m_centeredLayoutView.setCachesLayoutMetrics(true);
+}
 
 KDColor AbstractScrollableMultipleLayoutsView::ContentCell::backgroundColor()
     const {
@@ -125,7 +128,7 @@ KDCoordinate AbstractScrollableMultipleLayoutsView::ContentCell::baseline(
   // Left view
   KDCoordinate leftViewBaseline =
       (leftLayoutView() && !leftLayoutView()->layout().isUninitialized())
-          ? leftLayoutView()->layout().baseline(leftLayoutView()->font())
+          ? leftLayoutView()->layoutBaseline()
           : 0;
   if (leftBaseline != nullptr) {
     *leftBaseline = leftViewBaseline;
@@ -133,7 +136,7 @@ KDCoordinate AbstractScrollableMultipleLayoutsView::ContentCell::baseline(
 
   // Center view
   KDCoordinate centerViewBaseline =
-      displayCenter() ? m_centeredLayoutView.layout().baseline(font()) : 0;
+      displayCenter() ? m_centeredLayoutView.layoutBaseline() : 0;
   if (centerBaseline != nullptr) {
     *centerBaseline = centerViewBaseline;
   }
@@ -142,7 +145,7 @@ KDCoordinate AbstractScrollableMultipleLayoutsView::ContentCell::baseline(
   KDCoordinate rightViewBaseline =
       m_rightLayoutView.layout().isUninitialized()
           ? 0
-          : m_rightLayoutView.layout().baseline(font());
+          : m_rightLayoutView.layoutBaseline();
   if (rightBaseline != nullptr) {
     *rightBaseline = rightViewBaseline;
   }
@@ -0,0 +1,32 @@
+#include <escher/layout_view.h>
+#include <poincare/code_point_layout.h>
+#include <poincare/horizontal_layout.h>
+#include <quiz.h>
+
+using namespace Escher;
+using namespace Poincare;
+
+static HorizontalLayout digits_layout() {
+  return HorizontalLayout::Builder(CodePointLayout::Builder('1'),
+                                   CodePointLayout::Builder('2'),
+                                   CodePointLayout::Builder('3'));
+}
+
+QUIZ_CASE(escher_layout_view_metrics_cache) {
+  LayoutView view;
+  view.setCachesLayoutMetrics(true);
+  view.setLayout(digits_layout());
+  KDSize size = view.minimalSizeForOptimalDisplay();
+
+  // An identical layout reuses the metrics of the first one
+  HorizontalLayout rebuilt = digits_layout();
+  view.setLayout(rebuilt);
+  quiz_assert(view.minimalSizeForOptimalDisplay() == size);
+  quiz_assert(rebuilt.node()->hasMemoizedMetrics(view.font()));
+
+  // Modifying the layout in place invalidates its metrics
+  rebuilt.addOrMergeChildAtIndex(CodePointLayout::Builder('4'), 3);
+  rebuilt.invalidAllSizesPositionsAndBaselines();
+  quiz_assert(view.minimalSizeForOptimalDisplay().width() > size.width());
+  view.setLayout(Layout());
+}
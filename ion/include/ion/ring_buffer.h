@@ -42,6 +42,11 @@ class RingBuffer {
     return &m_stack[(m_start + index) % N];
   }
 
+  const T* elementAtIndex(int index) const {
+    assert(index >= 0 && index < static_cast<int>(length()));
+    return &m_stack[(m_start + index) % N];
+  }
+
   size_t length() const {
     assert(0 <= m_start && m_start < N);
     assert(0 <= m_length && m_length <= N);
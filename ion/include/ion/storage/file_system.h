@@ -41,11 +41,19 @@ class FileSystem {
   size_t availableSize();
   size_t putAvailableSpaceAtEndOfRecord(Record r);
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
+  /* The available space beyond keptSize bytes can be lent, for instance to
+   * extend the Python heap. Records cannot grow into the lent space until it
+   * is reclaimed, and its content is lost when it is. */
+  void *lendAvailableSpace(size_t keptSize, size_t *lentSize);
+  void reclaimLentSpace() { m_lentSize = 0; }
   uint32_t checksum();
 
   // Storage delegate
   void setDelegate(StorageDelegate *delegate) { m_delegate = delegate; }
   void notifyChangeToDelegate(const Record r = Record()) const;
+  /* Incremented on each notified change, so that caches of records content
+   * can be invalidated even when they are not the storage delegate. */
+  uint32_t changeCounter() const { return m_changeCounter; }
   Record::ErrorStatus notifyFullnessToDelegate() const;
 
   // Record name verifier
@@ -190,6 +198,7 @@ class FileSystem {
 
   bool isNameOfRecordTaken(Record r, const Record *recordToExclude = nullptr);
   char *endBuffer();
+  char *endLendableSpace() { return m_buffer + k_storageSize - m_lentSize; }
   size_t sizeOfRecordWithName(Record::Name name, size_t dataSize);
   bool slideBuffer(char *position, int delta);
   class RecordIterator {
@@ -227,6 +236,9 @@ class FileSystem {
   RecordNameVerifier m_recordNameVerifier;
   mutable Record m_lastRecordRetrieved;
   mutable char *m_lastRecordRetrievedPointer;
+  mutable uint32_t m_changeCounter;
+  // Lent space is taken at the end of the buffer
+  size_t m_lentSize;
 };
 
 }  // namespace Storage
@@ -13,6 +13,13 @@ void msleep(uint32_t ms);
  * On the device, epoch is the boot time. */
 uint64_t millis();
 
+/* Hot loops, such as the Python virtual machine, periodically do some work.
+ * Reading millis each time is too slow, as it is a system call on the device.
+ * Instead, they can pop a flag raised every k_periodicFlagInterval ms. */
+constexpr uint32_t k_periodicFlagInterval = 100;
+// Return true if the flag was raised since the previous call
+bool popPeriodicFlag();
+
 }  // namespace Timing
 }  // namespace Ion
 
@@ -1,4 +1,5 @@
 #include <drivers/svcall.h>
+#include <ion/src/shared/periodic_flag.h>
 #include <ion/timing.h>
 
 namespace Ion {
@@ -14,5 +15,9 @@ uint64_t SVC_ATTRIBUTES millis() {
   SVC_RETURNING_R0R1(SVC_TIMING_MILLIS, uint64_t)
 }
 
+/* The SysTick interrupt is handled by the kernel, so the userland polls the
+ * flag instead. */
+bool popPeriodicFlag() { return pollPeriodicFlag(); }
+
 }  // namespace Timing
 }  // namespace Ion
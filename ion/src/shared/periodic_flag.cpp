@@ -0,0 +1,47 @@
+#include "periodic_flag.h"
+
+#include <ion/timing.h>
+
+#include <algorithm>
+
+namespace Ion {
+namespace Timing {
+
+constexpr static uint64_t k_pollingInterval = 10;
+/* Calls can suddenly become much slower than the ones the number of calls
+ * between reads was adapted to, for instance when a script starts drawing
+ * after a tight loop. The maximum bounds the delay until the next read. */
+constexpr static uint32_t k_maxCallsBetweenReads = 1 << 8;
+
+bool pollPeriodicFlag() {
+  static uint32_t s_callsBetweenReads = 1;
+  static uint32_t s_remainingCalls = 0;
+  static uint64_t s_lastRead = 0;
+  static uint64_t s_lastRaise = 0;
+  if (s_remainingCalls > 0) {
+    s_remainingCalls--;
+    return false;
+  }
+  uint64_t now = millis();
+  uint64_t elapsed = now - s_lastRead;
+  if (elapsed < k_pollingInterval) {
+    if (s_callsBetweenReads < k_maxCallsBetweenReads) {
+      s_callsBetweenReads *= 2;
+    }
+  } else {
+    /* Scale rather than halve, so that slow calls are back to a read every
+     * k_pollingInterval ms after a single read. */
+    s_callsBetweenReads = std::max<uint64_t>(
+        1, s_callsBetweenReads * k_pollingInterval / elapsed);
+  }
+  s_lastRead = now;
+  s_remainingCalls = s_callsBetweenReads;
+  if (now - s_lastRaise < k_periodicFlagInterval) {
+    return false;
+  }
+  s_lastRaise = now;
+  return true;
+}
+
+}  // namespace Timing
+}  // namespace Ion
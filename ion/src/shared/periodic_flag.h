@@ -0,0 +1,16 @@
+#ifndef ION_SHARED_PERIODIC_FLAG_H
+#define ION_SHARED_PERIODIC_FLAG_H
+
+namespace Ion {
+namespace Timing {
+
+/* Raise the periodic flag without a timer interrupt. millis is only read once
+ * every few calls, and the number of calls between two reads adapts to the
+ * frequency of the calls so that it is read about every k_pollingInterval
+ * ms. */
+bool pollPeriodicFlag();
+
+}  // namespace Timing
+}  // namespace Ion
+
+#endif
@@ -29,8 +29,8 @@ void FileSystem::log() {
 size_t FileSystem::availableSize() {
   /* TODO maybe do: availableSize(char ** endBuffer) to get the endBuffer if it
    * is needed after calling availableSize */
-  assert(k_storageSize >= (endBuffer() - m_buffer) + sizeof(record_size_t));
-  return k_storageSize - (endBuffer() - m_buffer) - sizeof(record_size_t);
+  assert(endLendableSpace() >= endBuffer() + sizeof(record_size_t));
+  return endLendableSpace() - endBuffer() - sizeof(record_size_t);
 }
 
 size_t FileSystem::putAvailableSpaceAtEndOfRecord(Record r) {
@@ -39,7 +39,7 @@ size_t FileSystem::putAvailableSpaceAtEndOfRecord(Record r) {
   size_t availableStorageSize = availableSize();
   char *nextRecord = p + previousRecordSize;
   memmove(nextRecord + availableStorageSize, nextRecord,
-          (m_buffer + k_storageSize - availableStorageSize) - nextRecord);
+          (endLendableSpace() - availableStorageSize) - nextRecord);
   size_t newRecordSize = previousRecordSize + availableStorageSize;
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
   return newRecordSize;
@@ -51,11 +51,19 @@ void FileSystem::getAvailableSpaceFromEndOfRecord(Record r,
   size_t previousRecordSize = sizeOfRecordStarting(p);
   char *nextRecord = p + previousRecordSize;
   memmove(nextRecord - recordAvailableSpace, nextRecord,
-          m_buffer + k_storageSize - nextRecord);
+          endLendableSpace() - nextRecord);
   overrideSizeAtPosition(
       p, (record_size_t)(previousRecordSize - recordAvailableSpace));
 }
 
+void *FileSystem::lendAvailableSpace(size_t keptSize, size_t *lentSize) {
+  assert(m_lentSize == 0);
+  size_t available = availableSize();
+  m_lentSize = available > keptSize ? available - keptSize : 0;
+  *lentSize = m_lentSize;
+  return endLendableSpace();
+}
+
 uint32_t FileSystem::checksum() {
   return Ion::crc32Byte((const uint8_t *)m_buffer, endBuffer() - m_buffer);
 }
@@ -63,6 +71,7 @@ uint32_t FileSystem::checksum() {
 void FileSystem::notifyChangeToDelegate(const Record record) const {
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
+  m_changeCounter++;
   if (m_delegate) {
     m_delegate->storageDidChangeForRecord(record);
   }
@@ -341,7 +350,9 @@ FileSystem::FileSystem()
       m_magicFooter(Magic),
       m_delegate(nullptr),
       m_lastRecordRetrieved(nullptr),
-      m_lastRecordRetrievedPointer(nullptr) {
+      m_lastRecordRetrievedPointer(nullptr),
+      m_changeCounter(0),
+      m_lentSize(0) {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
   // Set the size of the first record to 0
@@ -453,6 +464,8 @@ bool FileSystem::destroyRecord(Record record, bool notifyDelegate) {
     slideBuffer(p + previousRecordSize, -previousRecordSize);
     if (notifyDelegate) {
       notifyChangeToDelegate();
+    } else {
+      m_changeCounter++;
     }
   }
   return true;
@@ -1,11 +1,19 @@
 #include <SDL.h>
+#include <ion/src/shared/periodic_flag.h>
 #include <ion/timing.h>
 
+#include <atomic>
 #include <chrono>
 
 #include "window.h"
 
 static auto start = std::chrono::steady_clock::now();
+static std::atomic<bool> sPeriodicFlag(false);
+
+static Uint32 raisePeriodicFlag(Uint32 interval, void *) {
+  sPeriodicFlag.store(true, std::memory_order_relaxed);
+  return interval;
+}
 
 namespace Ion {
 namespace Timing {
@@ -15,6 +23,22 @@ uint64_t millis() {
   return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
 }
 
+bool popPeriodicFlag() {
+  /* The flag is raised by the timer thread of SDL, which is started on the
+   * first call. The web simulator has no threads and polls the flag. */
+  static bool s_hasTimer =
+      SDL_InitSubSystem(SDL_INIT_TIMER) == 0 &&
+      SDL_AddTimer(k_periodicFlagInterval, raisePeriodicFlag, nullptr) != 0;
+  if (!s_hasTimer) {
+    return pollPeriodicFlag();
+  }
+  if (!sPeriodicFlag.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  sPeriodicFlag.store(false, std::memory_order_relaxed);
+  return true;
+}
+
 void msleep(uint32_t ms) {
   if (Simulator::Window::isHeadless()) {
     return;
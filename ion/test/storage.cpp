@@ -597,6 +597,38 @@ bool isDataOfRecord(const char *baseName, const char *extension,
   return strcmp(recordData, data) == 0;
 }
 
+QUIZ_CASE(ion_storage_lend_available_space) {
+  Storage::FileSystem *fileSystem = Storage::FileSystem::sharedFileSystem;
+  size_t initialAvailableSize = fileSystem->availableSize();
+  constexpr size_t keptSize = 1024;
+  quiz_assert(initialAvailableSize > keptSize);
+  size_t lentSize;
+  char *lentSpace = static_cast<char *>(
+      fileSystem->lendAvailableSpace(keptSize, &lentSize));
+  quiz_assert(lentSize == initialAvailableSize - keptSize);
+  quiz_assert(fileSystem->availableSize() == keptSize);
+  memset(lentSpace, 0xFF, lentSize);
+
+  // Records can only use the kept space
+  const char *baseNameRecord = "ionTestStorage";
+  const char *extensionRecord = "record1";
+  Storage::Record::ErrorStatus error =
+      putRecordInSharedStorage(baseNameRecord, extensionRecord, "data");
+  quiz_assert(error == Storage::Record::ErrorStatus::None);
+  Storage::Record record(baseNameRecord, extensionRecord);
+  size_t availableSize = fileSystem->availableSize();
+  fileSystem->putAvailableSpaceAtEndOfRecord(record);
+  quiz_assert(fileSystem->availableSize() == 0);
+  fileSystem->getAvailableSpaceFromEndOfRecord(record, availableSize);
+  quiz_assert(record.value().size == strlen("data") &&
+              memcmp(record.value().buffer, "data", strlen("data")) == 0);
+  record.destroy();
+  quiz_assert(fileSystem->availableSize() == keptSize);
+
+  fileSystem->reclaimLentSpace();
+  quiz_assert(fileSystem->availableSize() == initialAvailableSize);
+}
+
 QUIZ_CASE(ion_storage_record_name_verifier) {
   Ion::Storage::RecordNameVerifier *recordNameVerifier =
       Storage::FileSystem::sharedFileSystem->recordNameVerifier();
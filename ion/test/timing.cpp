@@ -0,0 +1,44 @@
+#include <ion/src/shared/periodic_flag.h>
+#include <ion/timing.h>
+#include <quiz.h>
+
+using namespace Ion::Timing;
+
+QUIZ_CASE(ion_timing_periodic_flag) {
+  uint64_t start = millis();
+  bool raised = false;
+  while (!raised && millis() - start < 3 * k_periodicFlagInterval) {
+    raised = popPeriodicFlag();
+  }
+  quiz_assert(raised);
+}
+
+QUIZ_CASE(ion_timing_polled_periodic_flag_after_burst) {
+  // A burst of fast calls maximizes the number of calls between reads
+  uint64_t start = millis();
+  while (millis() - start < 3 * k_periodicFlagInterval) {
+    pollPeriodicFlag();
+  }
+  /* Slow calls, of about 1ms each, may wait for the maximal number of calls
+   * until millis is read again, but should then raise the flag periodically.
+   */
+  constexpr int k_numberOfRaises = 5;
+  start = millis();
+  uint64_t now = start;
+  uint64_t lastRaise = 0;
+  int numberOfRaises = 0;
+  while (numberOfRaises < k_numberOfRaises &&
+         now - start < 20 * k_periodicFlagInterval) {
+    uint64_t callStart = now;
+    while (now == callStart) {
+      now = millis();
+    }
+    if (pollPeriodicFlag()) {
+      quiz_assert(numberOfRaises < 2 ||
+                  now - lastRaise < 2 * k_periodicFlagInterval);
+      lastRaise = now;
+      numberOfRaises++;
+    }
+  }
+  quiz_assert(numberOfRaises == k_numberOfRaises);
+}
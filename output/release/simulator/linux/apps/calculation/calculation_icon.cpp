@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calculation_icon.h"
+
+// Compressed 3080 pixels into 412 bytes (6.69% compression ratio)/
+const uint8_t compressedPixelData[412] = {0x19, 0xff, 0x01, 0x00, 0x4f, 0xdf, 0xff, 0xbe, 0xf7, 0x02, 0x00, 0x11, 0x2f, 0x4e, 0x63, 0x28, 0x00, 0x13, 0x2f, 0xdf, 0xff, 0x01, 0x00, 0x05, 0x0e, 0x40, 0x00, 0x0f, 0x6e, 0x00, 0x2f, 0x02, 0x02, 0x00, 0x2e, 0xff, 0xff, 0xd4, 0x00, 0x0f, 0x6e, 0x00, 0x47, 0x0a, 0xe4, 0x00, 0x0e, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x3d, 0x08, 0x70, 0x00, 0x2f, 0xbe, 0xf7, 0x6e, 0x00, 0x4f, 0x2e, 0xbe, 0xf7, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x49, 0x00, 0x70, 0x00, 0x1f, 0xdf, 0x6e, 0x00, 0xc6, 0x0f, 0x6c, 0x00, 0x09, 0x4f, 0x08, 0x42, 0x08, 0x42, 0x6e, 0x00, 0x3b, 0x2f, 0xbe, 0xf7, 0x6e, 0x00, 0xff, 0xff, 0x23, 0x2f, 0x08, 0x42, 0x02, 0x00, 0x07, 0x0e, 0x6e, 0x00, 0x0f, 0x36, 0x00, 0x1d, 0x0f, 0x6e, 0x00, 0x6b, 0x0f, 0x70, 0x03, 0xff, 0xff, 0x83, 0x0e, 0x72, 0x06, 0x0f, 0x6e, 0x00, 0xff, 0xf4, 0x2f, 0x4e, 0x63, 0x02, 0x00, 0x59, 0x0f, 0xa4, 0x00, 0x25, 0x2f, 0xa6, 0xfd, 0x02, 0x00, 0x21, 0x0f, 0x6e, 0x00, 0xff, 0xff, 0x95, 0x48, 0xb7, 0xb5, 0x3c, 0xe7, 0x10, 0x00, 0x4f, 0x3c, 0xe7, 0xb7, 0xb5, 0x6e, 0x00, 0x45, 0x86, 0xb7, 0xb5, 0x09, 0x42, 0xec, 0x5a, 0x3c, 0xe7, 0x6c, 0x00, 0x6f, 0xec, 0x5a, 0x09, 0x42, 0xb7, 0xb5, 0x6e, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x15, 0x08, 0x70, 0x00, 0x0a, 0x0e, 0x00, 0x0f, 0x6e, 0x00, 0x05, 0x1f, 0xff, 0x01, 0x00, 0x08, 0x0f, 0x4a, 0x01, 0x0d, 0x06, 0x62, 0x00, 0x0e, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x3f, 0x06, 0x70, 0x00, 0x0e, 0x6c, 0x00, 0x0f, 0x94, 0x02, 0x43, 0x02, 0x70, 0x00, 0x0e, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0xaf, 0x0f, 0x4a, 0x01, 0x59, 0x0f, 0x26, 0x02, 0x59, 0x0f, 0x02, 0x03, 0x5b, 0x0f, 0xde, 0x03, 0x4b, 0x1f, 0x9e, 0xba, 0x04, 0x58, 0x4f, 0x86, 0xfd, 0x7d, 0xef, 0x96, 0x05, 0x57, 0x3f, 0x47, 0xed, 0x5d, 0x6e, 0x00, 0x58, 0x5f, 0x6b, 0xe5, 0x9e, 0xf7, 0x9e, 0x6e, 0x00, 0x54, 0x8f, 0x86, 0xfd, 0x55, 0xe6, 0xff, 0xff, 0x3c, 0xe7, 0x6e, 0x00, 0x53, 0x20, 0xe8, 0xdc, 0x36, 0x14, 0x4f, 0x9e, 0xf7, 0x5d, 0xef, 0x6e, 0x00, 0x4f, 0x42, 0x06, 0xe5, 0x76, 0xe6, 0x14, 0x03, 0x4f, 0x5d, 0xef, 0x5d, 0xef, 0x6e, 0x00, 0x4b, 0x46, 0x06, 0xe5, 0xb0, 0xd5, 0x84, 0x03, 0x5f, 0x5d, 0xef, 0x1c, 0xe7, 0x9e, 0x6e, 0x00, 0x44, 0x6a, 0x86, 0xf5, 0xa6, 0xd4, 0x8f, 0xd5, 0xf4, 0x03, 0x9f, 0x9e, 0xf7, 0xfb, 0xde, 0x1c, 0xe7, 0x7d, 0xef, 0x9e, 0x6e, 0x00, 0x38, 0x84, 0x86, 0xf5, 0x26, 0xed, 0xc6, 0xd4, 0xa9, 0xc4, 0x44, 0x01, 0x0c, 0x72, 0x00, 0x5f, 0x3c, 0xe7, 0xfb, 0xde, 0xdb, 0x02, 0x00, 0x10, 0x4f, 0x8b, 0x4a, 0x26, 0xc4, 0x02, 0x00, 0x0d, 0x83, 0x46, 0xc4, 0x89, 0xc4, 0x2d, 0xcd, 0x55, 0xe6, 0x52, 0x16, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 412, false);
+
+const Escher::Image * const ImageStore::CalculationIcon = &image;
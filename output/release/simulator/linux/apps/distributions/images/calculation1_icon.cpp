@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calculation1_icon.h"
+
+// Compressed 897 pixels into 541 bytes (20.10% compression ratio)/
+const uint8_t compressedPixelData[541] = {0x1f, 0xff, 0x01, 0x00, 0xac, 0x8f, 0x14, 0xff, 0x06, 0xfe, 0xe5, 0xfd, 0xd1, 0xfe, 0x4c, 0x00, 0x33, 0x9f, 0x07, 0xfe, 0x06, 0xfe, 0xbc, 0xff, 0x4b, 0xfe, 0x8d, 0x50, 0x00, 0x2e, 0x80, 0x9a, 0xff, 0xe5, 0xfd, 0xe5, 0xfd, 0xc3, 0xfd, 0x0c, 0x00, 0x3f, 0x29, 0xfe, 0xf2, 0x50, 0x00, 0x2c, 0x53, 0x4a, 0xfe, 0x07, 0xfe, 0xc3, 0x4e, 0x00, 0x5f, 0xbc, 0xff, 0xe5, 0xfd, 0xbc, 0x4c, 0x00, 0x28, 0x20, 0x57, 0xff, 0x98, 0x00, 0x04, 0x4e, 0x00, 0x5f, 0xff, 0xff, 0xf2, 0xfe, 0x6c, 0x9e, 0x00, 0x28, 0x39, 0x29, 0xfe, 0xc4, 0x4e, 0x00, 0x5f, 0xfe, 0xff, 0xe6, 0xfd, 0x9a, 0x34, 0x01, 0x26, 0x04, 0x4c, 0x00, 0x24, 0xc3, 0xfd, 0x14, 0x00, 0x1f, 0x6c, 0x9e, 0x00, 0x26, 0x2e, 0x8d, 0xfe, 0x4e, 0x00, 0x5f, 0xde, 0xff, 0xe5, 0xfd, 0xbb, 0x4c, 0x00, 0x20, 0x17, 0xdd, 0x9a, 0x00, 0x26, 0xc3, 0xfd, 0x18, 0x00, 0x3f, 0xd1, 0xfe, 0xaf, 0x9e, 0x00, 0x20, 0x3e, 0xd1, 0xfe, 0xc3, 0x4e, 0x00, 0x03, 0xda, 0x01, 0x1f, 0xde, 0x4e, 0x00, 0x1e, 0x2e, 0xc4, 0xfd, 0x4e, 0x00, 0x04, 0x3c, 0x01, 0x1f, 0x13, 0x02, 0x03, 0x1e, 0x1f, 0xc3, 0x4e, 0x00, 0x06, 0x3f, 0x78, 0xff, 0x07, 0xec, 0x00, 0x1c, 0x2e, 0xe5, 0xfd, 0x4e, 0x00, 0x06, 0x01, 0x00, 0x3f, 0x28, 0xfe, 0x57, 0x4c, 0x00, 0x18, 0x3e, 0xd0, 0xfe, 0xc3, 0x4e, 0x00, 0x09, 0xba, 0x00, 0x2f, 0x6b, 0xfe, 0x02, 0x03, 0x17, 0x0c, 0x4c, 0x00, 0x0c, 0x4e, 0x00, 0x0e, 0xc6, 0x02, 0x0f, 0x4c, 0x00, 0x19, 0x0c, 0x4e, 0x00, 0x0f, 0x9e, 0x00, 0x15, 0x1e, 0x13, 0x4c, 0x00, 0x0e, 0x4e, 0x00, 0x03, 0x3c, 0x01, 0x0f, 0x52, 0x04, 0x0b, 0x3d, 0x79, 0xff, 0x29, 0x30, 0x01, 0x0e, 0x4e, 0x00, 0x06, 0x78, 0x02, 0x5f, 0x28, 0xfe, 0x6c, 0xfe, 0x9b, 0xac, 0x02, 0x04, 0x2c, 0x28, 0xfe, 0xc8, 0x01, 0x0f, 0x4e, 0x00, 0x0b, 0x02, 0x54, 0x04, 0x5d, 0x07, 0xfe, 0x6b, 0xfe, 0x14, 0x18, 0x00, 0x5f, 0xfe, 0xff, 0xde, 0xff, 0xdd, 0x02, 0x00, 0x08, 0x0f, 0x01, 0x00, 0x61, 0x1f, 0x00, 0x01, 0x00, 0x4c, 0x5f, 0x64, 0xe0, 0xe9, 0x7e, 0x03, 0x26, 0x00, 0x0e, 0x7f, 0x69, 0xdc, 0xdd, 0x20, 0xb8, 0xa4, 0x01, 0x26, 0x00, 0x0c, 0x8f, 0x30, 0xea, 0xec, 0xff, 0x00, 0x06, 0xca, 0x73, 0x27, 0x00, 0x0c, 0x20, 0xc2, 0xd9, 0xd7, 0x00, 0x3f, 0x21, 0xed, 0x22, 0x26, 0x00, 0x0a, 0x22, 0x49, 0xe9, 0xfe, 0x00, 0x2f, 0x79, 0xaa, 0x27, 0x00, 0x0a, 0x22, 0xc6, 0xf3, 0x27, 0x00, 0x3f, 0x09, 0xe5, 0x33, 0x26, 0x00, 0x08, 0x24, 0x32, 0xf2, 0x4c, 0x01, 0x2f, 0xad, 0xad, 0x27, 0x00, 0x08, 0x24, 0xa7, 0xf7, 0x27, 0x00, 0x3f, 0x0b, 0xe9, 0x24, 0x26, 0x00, 0x06, 0x26, 0x12, 0xf7, 0x9a, 0x01, 0x2f, 0x83, 0x91, 0x27, 0x00, 0x06, 0x26, 0x83, 0xfc, 0x27, 0x00, 0x3f, 0x1e, 0xeb, 0x0c, 0x26, 0x00, 0x04, 0x28, 0x01, 0xf1, 0xe8, 0x01, 0x2f, 0xa9, 0x6d, 0x27, 0x00, 0x04, 0x28, 0x67, 0xfe, 0x27, 0x00, 0x2f, 0x3e, 0xd6, 0x8b, 0x01, 0x04, 0x1a, 0xeb, 0x36, 0x02, 0x2f, 0xce, 0x47, 0x26, 0x00, 0x02, 0x1b, 0x87, 0x5d, 0x02, 0x2f, 0x62, 0xb3, 0x26, 0x00, 0x01, 0x2b, 0x4e, 0xfe, 0x27, 0x00, 0x3e, 0x09, 0xe3, 0x2d, 0x26, 0x00, 0x2d, 0x46, 0xfa, 0xab, 0x02, 0x2d, 0x65, 0xb4, 0x26, 0x00, 0x2e, 0x6d, 0xfd, 0xd2, 0x02, 0x3a, 0x04, 0xcf, 0x79, 0x25, 0x00, 0x3f, 0x3b, 0xc9, 0xfe, 0xf9, 0x02, 0x01, 0x45, 0x1c, 0xd3, 0xad, 0x28, 0x0d, 0x00, 0x5f, 0x07, 0x7e, 0xd1, 0xe6, 0xfd, 0x20, 0x03, 0x03, 0x64, 0x07, 0x77, 0xdb, 0xb4, 0x67, 0x00, 0xac, 0x00, 0x29, 0x0d, 0x11, 0x01, 0x00, 0x09, 0x73, 0x01, 0x2f, 0x02, 0x02, 0x1c, 0x03, 0x13, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(39, 23, compressedPixelData, 541, true);
+
+const Escher::Image * const ImageStore::Calculation1Icon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "normal_icon.h"
+
+// Compressed 665 pixels into 418 bytes (20.95% compression ratio)/
+const uint8_t compressedPixelData[418] = {0x1f, 0xff, 0x01, 0x00, 0x0c, 0x9f, 0xd0, 0xfe, 0xa2, 0xfd, 0xc2, 0xfd, 0xf2, 0xfe, 0xff, 0x01, 0x00, 0x28, 0x42, 0x6b, 0xfe, 0x80, 0xfd, 0x02, 0x00, 0x1f, 0xf1, 0x48, 0x00, 0x26, 0x15, 0xf1, 0x44, 0x00, 0x00, 0x02, 0x00, 0x1f, 0x9a, 0x44, 0x00, 0x22, 0x48, 0xbb, 0xff, 0x81, 0xfd, 0x46, 0x00, 0x1f, 0x28, 0x8e, 0x00, 0x22, 0x19, 0x4a, 0x8a, 0x00, 0x00, 0x02, 0x00, 0x1f, 0x56, 0x44, 0x00, 0x1e, 0x4c, 0x9a, 0xff, 0x80, 0xfd, 0x02, 0x00, 0x2f, 0x07, 0xfe, 0x8a, 0x00, 0x2f, 0x00, 0x02, 0x00, 0x1f, 0x79, 0x44, 0x00, 0x1a, 0x1e, 0x9b, 0x8a, 0x00, 0x01, 0x02, 0x00, 0x1f, 0x6b, 0x8e, 0x00, 0x1a, 0x2f, 0x8d, 0xfe, 0x46, 0x00, 0x03, 0x3f, 0x81, 0xfd, 0xdd, 0x44, 0x00, 0x16, 0x3e, 0xde, 0xff, 0xa1, 0x44, 0x00, 0x0f, 0x38, 0x02, 0x1e, 0x1e, 0xf2, 0x8a, 0x00, 0x05, 0x02, 0x00, 0x2f, 0xe4, 0xfd, 0x46, 0x00, 0x15, 0x1e, 0xe5, 0x44, 0x00, 0x07, 0x02, 0x00, 0x1f, 0x57, 0x44, 0x00, 0x12, 0x1e, 0x57, 0x5a, 0x01, 0x0f, 0x7e, 0x02, 0x20, 0x1f, 0x28, 0xd0, 0x00, 0x08, 0x0e, 0x0c, 0x03, 0x0f, 0x6e, 0x02, 0x17, 0x0e, 0x8e, 0x00, 0x0f, 0x8a, 0x00, 0x2f, 0x00, 0x02, 0x00, 0x1f, 0xd0, 0x48, 0x00, 0x0a, 0x1f, 0xaf, 0x44, 0x00, 0x12, 0x02, 0x90, 0x00, 0x0f, 0x66, 0x01, 0x01, 0x5f, 0xfe, 0xff, 0x36, 0xff, 0x07, 0x44, 0x00, 0x16, 0x02, 0x02, 0x00, 0x53, 0xe5, 0xfd, 0xd0, 0xfe, 0x99, 0x40, 0x00, 0x6e, 0x56, 0xff, 0xaf, 0xfe, 0x28, 0xfe, 0x68, 0x02, 0x0f, 0x02, 0x00, 0x15, 0x5a, 0xc2, 0xfd, 0x29, 0xfe, 0x00, 0x01, 0x00, 0x6f, 0x03, 0x7b, 0xec, 0xe8, 0x68, 0x00, 0x01, 0x00, 0x09, 0x20, 0x01, 0xa3, 0x7b, 0x00, 0x1f, 0x70, 0x23, 0x00, 0x09, 0x11, 0x72, 0x9e, 0x00, 0x2f, 0xfa, 0x2d, 0x22, 0x00, 0x07, 0x22, 0x22, 0xf7, 0xc2, 0x00, 0x1f, 0xba, 0x23, 0x00, 0x07, 0x14, 0xab, 0x26, 0x01, 0x1f, 0x48, 0x22, 0x00, 0x05, 0x15, 0x2e, 0x9d, 0x01, 0x1f, 0xc2, 0x23, 0x00, 0x05, 0x16, 0xad, 0x6d, 0x01, 0x1f, 0x35, 0x22, 0x00, 0x03, 0x17, 0x24, 0x46, 0x03, 0x1f, 0xa0, 0x23, 0x00, 0x03, 0x17, 0x92, 0xb3, 0x01, 0x2f, 0xf6, 0x13, 0x22, 0x00, 0x01, 0x28, 0x0e, 0xf3, 0xd7, 0x01, 0x1f, 0x72, 0x23, 0x00, 0x01, 0x19, 0x6d, 0xfa, 0x01, 0x3e, 0xdb, 0x02, 0x00, 0x59, 0x01, 0x1a, 0xd6, 0x1e, 0x02, 0x1e, 0x47, 0x23, 0x00, 0x1b, 0x47, 0x41, 0x02, 0x1e, 0xb8, 0x23, 0x00, 0x1c, 0xb8, 0x64, 0x02, 0x1c, 0x2f, 0x22, 0x00, 0x1d, 0x2f, 0xd4, 0x02, 0x0d, 0x86, 0x01, 0x1e, 0xb9, 0xac, 0x02, 0x1a, 0x78, 0x22, 0x00, 0x1f, 0x84, 0x10, 0x03, 0x01, 0x34, 0xbc, 0x42, 0x01, 0x20, 0x00, 0x3f, 0x08, 0x4f, 0xc1, 0x35, 0x03, 0x04, 0xaf, 0xd7, 0x7f, 0x31, 0x01, 0x00, 0x04, 0x4a, 0x83, 0xb8, 0xf2, 0x58, 0x03, 0x06, 0x50, 0xff, 0xff, 0xff, 0xe8, 0xb4, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 418, true);
+
+const Escher::Image * const ImageStore::NormalIcon = &image;
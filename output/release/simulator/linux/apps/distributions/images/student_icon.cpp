@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "student_icon.h"
+
+// Compressed 608 pixels into 413 bytes (22.64% compression ratio)/
+const uint8_t compressedPixelData[413] = {0x1f, 0xff, 0x01, 0x00, 0x0a, 0x8f, 0xbc, 0xff, 0xc3, 0xfd, 0xc3, 0xfd, 0xbb, 0xff, 0x01, 0x00, 0x25, 0x8f, 0x6c, 0xfe, 0x80, 0xfd, 0x80, 0xfd, 0x28, 0xfe, 0x3e, 0x00, 0x23, 0x51, 0xde, 0xff, 0xa1, 0xfd, 0x80, 0x02, 0x00, 0x1f, 0x99, 0x40, 0x00, 0x22, 0x33, 0x35, 0xff, 0x80, 0x40, 0x00, 0x1f, 0x8d, 0x82, 0x00, 0x22, 0x24, 0x8c, 0xfe, 0x40, 0x00, 0x2f, 0xc3, 0xfd, 0x40, 0x00, 0x21, 0x35, 0xe4, 0xfd, 0x80, 0x02, 0x00, 0x1f, 0x78, 0x3e, 0x00, 0x1e, 0x37, 0xdd, 0xff, 0x80, 0x40, 0x00, 0x1f, 0xaf, 0xc2, 0x00, 0x1e, 0x19, 0x56, 0x40, 0x00, 0x1f, 0xe5, 0xc2, 0x00, 0x1e, 0x15, 0xaf, 0xfe, 0x00, 0x02, 0x02, 0x00, 0x1f, 0xbc, 0x40, 0x00, 0x1c, 0x1b, 0x28, 0x40, 0x00, 0x1f, 0xf2, 0xc2, 0x00, 0x1c, 0x19, 0xa1, 0x3e, 0x00, 0x0f, 0x46, 0x02, 0x1d, 0x19, 0x78, 0xfe, 0x00, 0x02, 0x02, 0x00, 0x1f, 0xdd, 0xfe, 0x00, 0x28, 0x00, 0x02, 0x00, 0x1f, 0x13, 0x40, 0x00, 0x18, 0x2e, 0xe5, 0xfd, 0x40, 0x00, 0x2f, 0x06, 0xfe, 0xbe, 0x00, 0x29, 0x00, 0x02, 0x00, 0x1f, 0x57, 0x3a, 0x02, 0x14, 0x0e, 0x7e, 0x00, 0x02, 0x02, 0x00, 0x1f, 0xe4, 0x04, 0x01, 0x10, 0x1e, 0x9a, 0x3e, 0x00, 0x09, 0xc4, 0x00, 0x0f, 0x08, 0x02, 0x09, 0x3e, 0x79, 0xff, 0x6b, 0x38, 0x01, 0x0b, 0x02, 0x00, 0x59, 0xa1, 0xfd, 0xf1, 0xfe, 0xde, 0xae, 0x00, 0x9f, 0xbb, 0xff, 0x78, 0xff, 0xf3, 0xfe, 0x6c, 0xfe, 0xc4, 0x3a, 0x00, 0x0c, 0x08, 0x44, 0x00, 0x9a, 0x6b, 0xfe, 0x14, 0xff, 0x99, 0xff, 0xde, 0xff, 0x00, 0x01, 0x00, 0x5f, 0x1c, 0xe3, 0xe4, 0x23, 0x00, 0x01, 0x00, 0x08, 0x4f, 0x9f, 0xff, 0xff, 0xbc, 0x1f, 0x00, 0x08, 0x6f, 0x0e, 0xf5, 0xff, 0xff, 0xff, 0x31, 0x20, 0x00, 0x07, 0x10, 0x55, 0xb1, 0x00, 0x1f, 0x95, 0x20, 0x00, 0x07, 0x01, 0xa8, 0x04, 0x2f, 0xe7, 0x03, 0x20, 0x00, 0x06, 0x11, 0xd8, 0xf2, 0x00, 0x1f, 0x3c, 0x1f, 0x00, 0x05, 0x12, 0x12, 0x21, 0x02, 0x1f, 0x87, 0x20, 0x00, 0x05, 0x12, 0x49, 0x32, 0x01, 0x1f, 0xd2, 0x20, 0x00, 0x05, 0x13, 0x81, 0x53, 0x01, 0x1f, 0x1e, 0x20, 0x00, 0x04, 0x04, 0xc9, 0x05, 0x1f, 0x69, 0x1f, 0x00, 0x03, 0x23, 0x06, 0xf5, 0x20, 0x00, 0x1f, 0xba, 0x20, 0x00, 0x03, 0x14, 0x3c, 0xb3, 0x01, 0x2f, 0xfa, 0x11, 0x20, 0x00, 0x02, 0x15, 0x85, 0xd4, 0x01, 0x1f, 0x65, 0x20, 0x00, 0x02, 0x15, 0xd6, 0x20, 0x00, 0x1f, 0xc9, 0x1f, 0x00, 0x01, 0x17, 0x3e, 0x15, 0x02, 0x1e, 0x42, 0x1f, 0x00, 0x27, 0x11, 0xd7, 0x20, 0x00, 0x2c, 0xdb, 0x10, 0x1f, 0x00, 0x29, 0x2c, 0xd3, 0x8a, 0x02, 0x29, 0xcd, 0x1d, 0x1e, 0x00, 0x3b, 0x33, 0xa1, 0xfc, 0xab, 0x02, 0x30, 0xf1, 0x70, 0x0c, 0x19, 0x00, 0x6f, 0x04, 0x11, 0x21, 0x3e, 0x66, 0x9b, 0x16, 0x03, 0x02, 0x50, 0xf0, 0xa4, 0x5e, 0x30, 0x0c, 
+};
+
+constexpr Escher::Image image = Escher::Image(32, 19, compressedPixelData, 413, true);
+
+const Escher::Image * const ImageStore::StudentIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "uniform_icon.h"
+
+// Compressed 665 pixels into 66 bytes (3.31% compression ratio)/
+const uint8_t compressedPixelData[66] = {0x1f, 0xff, 0x01, 0x00, 0xff, 0xe5, 0x2f, 0xc3, 0xfd, 0x02, 0x00, 0x17, 0x0f, 0x46, 0x00, 0x1f, 0x0e, 0x2a, 0x00, 0x0f, 0x46, 0x00, 0xff, 0xff, 0x73, 0x0f, 0xee, 0x02, 0x25, 0x08, 0x1e, 0x00, 0x3f, 0xe5, 0xfd, 0x00, 0x01, 0x00, 0xe8, 0x0f, 0x90, 0x01, 0x03, 0x0e, 0x23, 0x00, 0x0c, 0x19, 0x00, 0x0f, 0x23, 0x00, 0xff, 0x30, 0x0f, 0x77, 0x01, 0x09, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
+};
+
+constexpr Escher::Image image = Escher::Image(35, 19, compressedPixelData, 66, true);
+
+const Escher::Image * const ImageStore::UniformIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "elements_icon.h"
+
+// Compressed 3080 pixels into 1858 bytes (30.16% compression ratio)/
+const uint8_t compressedPixelData[1858] = {0x15, 0xff, 0x01, 0x00, 0x8f, 0x3d, 0xe7, 0x35, 0xa5, 0xd0, 0x73, 0x4e, 0x63, 0x02, 0x00, 0x39, 0x7b, 0xd0, 0x73, 0x35, 0xa5, 0x3d, 0xe7, 0xff, 0x01, 0x00, 0x6f, 0xbf, 0xf7, 0xf4, 0x9c, 0x4e, 0x63, 0x02, 0x00, 0x45, 0x46, 0xf4, 0x9c, 0xbf, 0xf7, 0x6c, 0x00, 0x2f, 0x9e, 0xf7, 0xd4, 0x00, 0x3d, 0x0e, 0xe4, 0x00, 0x13, 0x9e, 0x70, 0x00, 0x2f, 0xdf, 0xff, 0x6c, 0x00, 0x1b, 0xaf, 0x8f, 0x6b, 0x35, 0xa5, 0xf8, 0xbd, 0x35, 0xa5, 0x8f, 0x6b, 0x70, 0x00, 0x1b, 0x11, 0xdf, 0x6e, 0x00, 0x1f, 0xd4, 0x44, 0x01, 0x1a, 0x42, 0x31, 0x84, 0x7d, 0xef, 0xa6, 0x00, 0x4f, 0x7d, 0xef, 0x11, 0x84, 0x3a, 0x00, 0x19, 0x20, 0xd4, 0x9c, 0x34, 0x00, 0x0f, 0x12, 0x01, 0x1f, 0x60, 0xdb, 0xde, 0x15, 0xa5, 0xdb, 0xde, 0x82, 0x01, 0x1f, 0xb0, 0x16, 0x01, 0x1a, 0x2f, 0x7d, 0xef, 0x1e, 0x02, 0x1b, 0xff, 0x03, 0x9a, 0xd6, 0xff, 0xff, 0x9a, 0xd6, 0xcd, 0x5a, 0x2e, 0x63, 0x4e, 0x63, 0xbb, 0xd6, 0xff, 0xff, 0x7a, 0xce, 0x2e, 0x02, 0x1b, 0x0f, 0x7e, 0x01, 0x19, 0x91, 0x72, 0x8c, 0xff, 0xff, 0xbe, 0xf7, 0x2e, 0x63, 0x2e, 0x0e, 0x00, 0x8f, 0xb0, 0x73, 0xbe, 0xf7, 0xff, 0xff, 0x32, 0x84, 0xf2, 0x01, 0x19, 0x0f, 0xda, 0x00, 0x1d, 0x44, 0x35, 0xa5, 0x0d, 0x5b, 0x10, 0x00, 0x7f, 0x76, 0xad, 0xff, 0xff, 0x5a, 0xce, 0x2e, 0xc6, 0x02, 0x44, 0x00, 0xc0, 0x02, 0x19, 0x0e, 0xac, 0x00, 0x00, 0x68, 0x02, 0x2f, 0x8f, 0x6b, 0x6e, 0x00, 0x41, 0x00, 0xca, 0x00, 0x48, 0x18, 0xc6, 0xed, 0x5a, 0x14, 0x00, 0x6f, 0x39, 0xc6, 0xff, 0xff, 0x15, 0xa5, 0x6e, 0x00, 0x41, 0x20, 0xdb, 0xde, 0xa6, 0x01, 0x0a, 0x38, 0x01, 0x6f, 0xb3, 0x94, 0xff, 0xff, 0xbb, 0xd6, 0x4c, 0x01, 0x3f, 0x11, 0x6f, 0x36, 0x01, 0x2c, 0xed, 0x5a, 0x16, 0x00, 0x00, 0x5e, 0x01, 0x0f, 0x6e, 0x00, 0x3f, 0x20, 0x93, 0x8c, 0x68, 0x03, 0x0c, 0x6e, 0x00, 0x04, 0xf2, 0x00, 0x0f, 0x56, 0x00, 0x27, 0xf2, 0x01, 0x18, 0xbe, 0xbb, 0xd6, 0xfc, 0xde, 0xfc, 0xde, 0xbb, 0xd6, 0x39, 0xc6, 0x76, 0xad, 0x93, 0x94, 0x06, 0x02, 0x7d, 0xb7, 0xb5, 0xff, 0xff, 0x76, 0xad, 0x0e, 0x30, 0x00, 0x02, 0x18, 0x00, 0x06, 0x38, 0x02, 0xcf, 0x31, 0x84, 0xb3, 0x94, 0xf4, 0x9c, 0xd4, 0x9c, 0x93, 0x8c, 0xf0, 0x7b, 0x10, 0x03, 0x0d, 0x4e, 0xdb, 0xd6, 0xff, 0xff, 0x01, 0x00, 0x5e, 0x1c, 0xe7, 0xd7, 0xb5, 0xfb, 0xc4, 0x00, 0x05, 0xba, 0x01, 0xaa, 0x5a, 0xce, 0x11, 0x84, 0x76, 0xad, 0x7a, 0xce, 0x7d, 0xef, 0x38, 0x00, 0x4e, 0x5d, 0xef, 0x15, 0x9d, 0x6e, 0x00, 0x08, 0x62, 0x02, 0xf6, 0x03, 0xbe, 0xf7, 0x76, 0xad, 0x32, 0x84, 0xd1, 0x7b, 0xf1, 0x7b, 0x32, 0x84, 0xf4, 0x9c, 0xb7, 0xb5, 0xdb, 0xde, 0x3e, 0x00, 0x4c, 0xf8, 0xbd, 0x31, 0x84, 0xb8, 0x01, 0x28, 0x15, 0xa5, 0x60, 0x00, 0xc2, 0xdf, 0xff, 0x1c, 0xe7, 0x7a, 0xce, 0x39, 0xc6, 0x59, 0xce, 0xbb, 0xd6, 0x86, 0x05, 0x2f, 0x96, 0xad, 0x08, 0x02, 0x07, 0x66, 0xdf, 0xff, 0x4f, 0x6b, 0x0d, 0x5b, 0xf6, 0x01, 0xa4, 0x2e, 0x63, 0x0e, 0x63, 0x2e, 0x63, 0x52, 0x8c, 0xd8, 0xbd, 0x50, 0x00, 0x51, 0xfc, 0xde, 0x15, 0x9d, 0x6f, 0x5c, 0x01, 0x64, 0x52, 0x84, 0x18, 0xbe, 0xbe, 0xf7, 0xa2, 0x05, 0xf0, 0x01, 0xf8, 0xbd, 0xb3, 0x94, 0x90, 0x73, 0xcd, 0x5a, 0xed, 0x5a, 0x0d, 0x5b, 0x0e, 0x5b, 0x0e, 0x63, 0x04, 0x00, 0x20, 0xd4, 0x9c, 0x72, 0x00, 0x0e, 0x4c, 0x05, 0x02, 0x48, 0x01, 0x00, 0xfc, 0x00, 0x0e, 0x08, 0x02, 0x02, 0xfa, 0x05, 0x82, 0xff, 0xff, 0x3c, 0xe7, 0xd8, 0xbd, 0xbe, 0xf7, 0x10, 0x07, 0x44, 0x7a, 0xce, 0x1c, 0xe7, 0x66, 0x01, 0x00, 0x40, 0x01, 0x28, 0xd0, 0x73, 0xa4, 0x00, 0x06, 0x02, 0x00, 0x6f, 0x7a, 0xce, 0xff, 0xff, 0x93, 0x94, 0xde, 0x00, 0x03, 0x00, 0xe0, 0x05, 0x1e, 0x6f, 0x1a, 0x04, 0x03, 0x9e, 0x01, 0x20, 0x39, 0xc6, 0xb4, 0x04, 0x44, 0x15, 0x9d, 0x7e, 0xef, 0x36, 0x01, 0xce, 0xd8, 0xbd, 0xb0, 0x73, 0xcd, 0x5a, 0x59, 0xce, 0xff, 0xff, 0x52, 0x8c, 0x52, 0x00, 0x04, 0x6e, 0x00, 0x0f, 0xb2, 0x02, 0x05, 0x28, 0x19, 0xc6, 0x60, 0x02, 0x08, 0x02, 0x00, 0xa2, 0x35, 0xa5, 0xff, 0xff, 0xb7, 0xb5, 0x4f, 0x6b, 0x97, 0xb5, 0xde, 0x00, 0x02, 0xfa, 0x07, 0x8f, 0xbe, 0xf7, 0x96, 0xad, 0x6f, 0x6b, 0xf8, 0xbd, 0x24, 0x07, 0x05, 0x11, 0xb0, 0x42, 0x07, 0x1f, 0x0e, 0x26, 0x02, 0x04, 0xaf, 0x11, 0x7c, 0xbd, 0xff, 0x6f, 0xfe, 0x48, 0xe5, 0x4a, 0xac, 0xe8, 0x02, 0x01, 0x22, 0x59, 0xce, 0xee, 0x07, 0xa2, 0xbb, 0xd6, 0x32, 0x84, 0xcd, 0x5a, 0xf1, 0x7b, 0x9a, 0xd6, 0x78, 0x02, 0x5d, 0x59, 0xc6, 0xff, 0xff, 0x56, 0xa4, 0x00, 0x9b, 0xec, 0x93, 0xc9, 0xcc, 0x6c, 0xdd, 0x9c, 0xff, 0x19, 0xec, 0x04, 0x08, 0x02, 0x00, 0x40, 0xca, 0xed, 0xa6, 0xfd, 0x02, 0x00, 0x1b, 0x0a, 0xac, 0x00, 0x02, 0x5a, 0x00, 0x00, 0xe0, 0x03, 0x22, 0x11, 0x84, 0xde, 0x06, 0x10, 0x4e, 0x3e, 0x02, 0x23, 0x84, 0xfc, 0xb2, 0x02, 0x2a, 0x39, 0xc6, 0xb6, 0x01, 0x22, 0xcc, 0x8b, 0x48, 0x00, 0x4f, 0x48, 0xe5, 0x4f, 0x6b, 0x6a, 0x04, 0x07, 0x22, 0xa6, 0xfd, 0x02, 0x00, 0x28, 0xc8, 0xcc, 0xfc, 0x05, 0x22, 0x7a, 0xce, 0xc6, 0x00, 0x24, 0x52, 0x8c, 0x6a, 0x00, 0x06, 0xb4, 0x02, 0x22, 0xd4, 0x9c, 0x5c, 0x01, 0x0a, 0x82, 0x01, 0x24, 0x8a, 0xb4, 0x4a, 0x00, 0x1f, 0x2c, 0x22, 0x06, 0x08, 0x22, 0x47, 0xe5, 0x24, 0x00, 0x26, 0x10, 0xe6, 0xb2, 0x01, 0x04, 0xe6, 0x02, 0x34, 0x11, 0x84, 0x0e, 0x26, 0x01, 0x58, 0x8b, 0x4b, 0xa4, 0xec, 0x8b, 0xd4, 0x04, 0x02, 0x1c, 0x03, 0x06, 0x8e, 0x03, 0x15, 0xac, 0x6e, 0x00, 0x1f, 0x2d, 0x4e, 0x04, 0x08, 0x20, 0xcc, 0x83, 0x70, 0x00, 0xc2, 0x6e, 0xfe, 0xfe, 0xff, 0x59, 0xce, 0x6f, 0x6b, 0xb0, 0x73, 0x9a, 0xd6, 0x28, 0x01, 0x00, 0xe4, 0x03, 0x12, 0xd1, 0x8a, 0x04, 0x32, 0x6b, 0x08, 0xd5, 0x48, 0x00, 0x33, 0x08, 0xd5, 0x4e, 0x78, 0x03, 0x00, 0x6a, 0x00, 0x00, 0xa4, 0x0a, 0x13, 0xdf, 0x7e, 0x06, 0x60, 0x52, 0x8c, 0x9d, 0xf7, 0x49, 0xdd, 0x24, 0x00, 0x2f, 0xea, 0x9b, 0xb2, 0x05, 0x0d, 0x00, 0xce, 0x03, 0x11, 0xdf, 0x4a, 0x03, 0x20, 0x9e, 0xf7, 0x5c, 0x03, 0x00, 0x40, 0x01, 0x24, 0xdb, 0xde, 0xa6, 0x03, 0x06, 0x24, 0x01, 0x44, 0xa6, 0xfd, 0x8a, 0xb4, 0x8c, 0x03, 0x00, 0x76, 0x06, 0x02, 0x02, 0x04, 0x60, 0x59, 0xce, 0x15, 0xa5, 0xdf, 0xff, 0xb2, 0x08, 0x4f, 0x0c, 0x6b, 0x0d, 0x63, 0x1e, 0x06, 0x13, 0x42, 0x11, 0x84, 0xbe, 0xf7, 0x16, 0x02, 0x20, 0x4e, 0x63, 0x66, 0x03, 0x00, 0xcc, 0x03, 0x11, 0x90, 0x6e, 0x00, 0x26, 0x28, 0xe5, 0x6e, 0x00, 0x22, 0x28, 0xe5, 0xca, 0x02, 0x00, 0xdc, 0x00, 0x20, 0x0d, 0x5b, 0x96, 0x03, 0x04, 0x14, 0x0b, 0x2c, 0x19, 0xc6, 0xe2, 0x01, 0x0f, 0xcc, 0x06, 0x09, 0x24, 0x59, 0xc6, 0xb2, 0x0b, 0x11, 0xd4, 0x0a, 0x04, 0x0f, 0x6e, 0x00, 0x13, 0x42, 0xd0, 0x73, 0xfc, 0xde, 0x88, 0x03, 0x2f, 0xd0, 0x7b, 0x6c, 0x00, 0x17, 0x20, 0xdb, 0xd6, 0x84, 0x01, 0x42, 0xb4, 0x94, 0x39, 0xc6, 0x8c, 0x05, 0x20, 0x6f, 0x6b, 0x4a, 0x01, 0x1f, 0xd0, 0x4a, 0x01, 0x0a, 0x51, 0x0d, 0x5b, 0xd4, 0x94, 0xbe, 0x7a, 0x01, 0x11, 0x1c, 0xc2, 0x01, 0x2f, 0x72, 0x8c, 0x6c, 0x00, 0x14, 0x10, 0xde, 0x9e, 0x00, 0x20, 0xf1, 0x7b, 0x96, 0x03, 0x31, 0xf5, 0x9c, 0xdf, 0xfc, 0x02, 0x00, 0x42, 0x00, 0x1f, 0xf1, 0x26, 0x02, 0x08, 0x20, 0xdb, 0xde, 0xc0, 0x04, 0x00, 0xae, 0x01, 0x00, 0x00, 0x0a, 0x20, 0x59, 0xce, 0x70, 0x00, 0x1f, 0x52, 0x64, 0x07, 0x10, 0x20, 0x59, 0xce, 0xa0, 0x00, 0x24, 0x90, 0x73, 0xc8, 0x09, 0x24, 0xf1, 0x7b, 0xc2, 0x03, 0x06, 0xf0, 0x04, 0x0e, 0x02, 0x03, 0x02, 0x40, 0x01, 0x24, 0xd4, 0x9c, 0xae, 0x01, 0x22, 0x7a, 0xce, 0xb2, 0x00, 0x0f, 0x6c, 0x00, 0x0b, 0x21, 0x56, 0xad, 0x86, 0x0c, 0x3c, 0x7b, 0x0d, 0x5b, 0x16, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0x1c, 0x07, 0x01, 0x44, 0xb4, 0x94, 0x7d, 0xef, 0x4e, 0x04, 0x26, 0x0d, 0x5b, 0x22, 0x01, 0x20, 0x9a, 0xd6, 0x36, 0x06, 0x1f, 0x6f, 0xdc, 0x03, 0x08, 0x20, 0xf0, 0x7b, 0x38, 0x01, 0x4e, 0x72, 0x8c, 0xed, 0x5a, 0xf2, 0x00, 0x04, 0x60, 0x06, 0x17, 0x73, 0x90, 0x01, 0x24, 0x73, 0x8c, 0xf8, 0x00, 0x2c, 0x7a, 0xce, 0x84, 0x02, 0x20, 0x8f, 0x6b, 0x7e, 0x01, 0x2f, 0xd8, 0xbd, 0x46, 0x01, 0x0b, 0x3e, 0xd8, 0xbd, 0xcd, 0x46, 0x05, 0x01, 0x96, 0x05, 0x42, 0x19, 0xc6, 0x5d, 0xef, 0x96, 0x05, 0x00, 0x92, 0x01, 0x22, 0x93, 0x94, 0xd6, 0x07, 0x40, 0x7e, 0xef, 0x59, 0xce, 0x96, 0x05, 0x2e, 0x2e, 0x63, 0xe4, 0x05, 0x00, 0xbc, 0x00, 0x2f, 0xd0, 0x7b, 0x96, 0x08, 0x05, 0x02, 0x0c, 0x0b, 0x1f, 0x2e, 0x72, 0x06, 0x06, 0x00, 0x54, 0x01, 0x0a, 0x72, 0x06, 0x51, 0x56, 0xad, 0xed, 0x5a, 0xd8, 0x72, 0x06, 0x0e, 0x36, 0x00, 0x02, 0xa4, 0x00, 0x2f, 0xf8, 0xbd, 0xc4, 0x09, 0x07, 0x2e, 0x59, 0xce, 0x20, 0x06, 0x06, 0x4e, 0x07, 0x62, 0x2e, 0x63, 0x32, 0x84, 0x18, 0xbe, 0x70, 0x08, 0x00, 0xd6, 0x00, 0x11, 0xf5, 0x64, 0x00, 0x1e, 0x7a, 0x4e, 0x07, 0x05, 0xe0, 0x06, 0x00, 0x72, 0x02, 0x0a, 0x04, 0x02, 0x08, 0xce, 0x0d, 0x1f, 0x59, 0x44, 0x0c, 0x04, 0x20, 0x32, 0x84, 0x7c, 0x08, 0x15, 0x3c, 0x1e, 0x08, 0x04, 0xec, 0x06, 0x40, 0xbf, 0xf7, 0x18, 0xbe, 0x22, 0x05, 0x0f, 0xde, 0x0e, 0x05, 0x00, 0x42, 0x02, 0x1f, 0x2e, 0x56, 0x0c, 0x08, 0x2c, 0xf4, 0x9c, 0x7e, 0x01, 0x64, 0x15, 0x9d, 0x39, 0xc6, 0x7e, 0xef, 0xa2, 0x0f, 0x70, 0xd7, 0xbd, 0xd0, 0x7b, 0xcd, 0x5a, 0x0e, 0x9e, 0x00, 0x25, 0x94, 0xfb, 0x90, 0x09, 0x4e, 0xd8, 0xbd, 0xb3, 0x94, 0x80, 0x02, 0x20, 0xd0, 0x7b, 0x58, 0x09, 0x0f, 0x4e, 0x07, 0x05, 0x22, 0x97, 0xb5, 0x70, 0x08, 0xb9, 0xdb, 0xde, 0x7a, 0xce, 0x7a, 0xce, 0xbb, 0xd6, 0x3d, 0xe7, 0xdf, 0x20, 0x0a, 0x4a, 0xb4, 0x94, 0xed, 0x5a, 0x92, 0x09, 0x20, 0xd0, 0x7b, 0x28, 0x08, 0x06, 0x90, 0x09, 0x00, 0x90, 0x0f, 0x91, 0x93, 0x8c, 0x52, 0x84, 0x52, 0x84, 0xb3, 0x94, 0xd7, 0x56, 0x08, 0x2e, 0xf8, 0xbd, 0xbc, 0x07, 0x06, 0x4e, 0x01, 0x0c, 0xde, 0x10, 0x8e, 0x7d, 0xef, 0x59, 0xce, 0x35, 0xa5, 0xb0, 0x73, 0x9e, 0x01, 0x08, 0x78, 0x0c, 0x4e, 0x76, 0xad, 0x1c, 0xe7, 0xf8, 0x0a, 0x00, 0xc8, 0x0e, 0x0e, 0x76, 0x02, 0x0a, 0x70, 0x06, 0xe4, 0x8f, 0x73, 0x32, 0x84, 0x73, 0x8c, 0x73, 0x8c, 0x32, 0x84, 0xb0, 0x73, 0x0e, 0x63, 0xce, 0x00, 0x0a, 0x82, 0x0b, 0x0c, 0x9a, 0x0b, 0x00, 0x78, 0x0a, 0x00, 0xde, 0x01, 0x00, 0x6e, 0x10, 0xa6, 0x9a, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x9a, 0xd6, 0xd7, 0xbd, 0x56, 0x08, 0x0f, 0x76, 0x0c, 0x23, 0x0e, 0x3c, 0x00, 0x00, 0xbc, 0x01, 0x08, 0x5c, 0x10, 0x00, 0x78, 0x00, 0x20, 0x0d, 0x5b, 0x02, 0x00, 0x0f, 0xd6, 0x00, 0x0b, 0x0f, 0x86, 0x06, 0x0e, 0x5e, 0xff, 0xd2, 0xfe, 0x0b, 0x9c, 0x52, 0x0d, 0x0e, 0x08, 0x02, 0x0f, 0x02, 0x00, 0x2f, 0x22, 0xec, 0x93, 0xfa, 0x05, 0x2e, 0x69, 0xb4, 0xb6, 0x01, 0x0f, 0x6e, 0x00, 0x3f, 0x22, 0xe9, 0xcc, 0x6e, 0x00, 0x28, 0x86, 0xfd, 0xae, 0x03, 0x11, 0x59, 0x0a, 0x0f, 0x1f, 0x0e, 0x2e, 0x0e, 0x3e, 0x22, 0xc9, 0xc4, 0x6e, 0x00, 0x4a, 0x67, 0xf5, 0x0d, 0x5b, 0xe6, 0x0f, 0x0f, 0x9e, 0x01, 0x19, 0x0f, 0x2c, 0x00, 0x15, 0xa6, 0xad, 0x7b, 0x87, 0xf5, 0xa6, 0xfd, 0xc6, 0xfd, 0x70, 0xc5, 0x32, 0x00, 0x11, 0x96, 0xc2, 0x10, 0x2f, 0xed, 0x5a, 0x6c, 0x00, 0x17, 0x1f, 0x6f, 0x80, 0x10, 0x16, 0x84, 0x6e, 0x6b, 0x8e, 0xa4, 0xbc, 0xff, 0xbe, 0xf7, 0xb2, 0x10, 0x02, 0x9e, 0x11, 0x3f, 0xf1, 0x7b, 0x2e, 0x6a, 0x02, 0x18, 0x2f, 0xd3, 0x94, 0x50, 0x01, 0x19, 0x20, 0x7a, 0xce, 0xb2, 0x03, 0x24, 0x6e, 0x6b, 0xbe, 0x08, 0x3f, 0x5a, 0xce, 0xcd, 0x22, 0x02, 0x18, 0x5f, 0xd3, 0x94, 0x9e, 0xf7, 0x2e, 0x56, 0x13, 0x1e, 0x51, 0xfb, 0xde, 0x76, 0xad, 0xfc, 0x56, 0x13, 0x3f, 0x4e, 0x6b, 0x2e, 0xb4, 0x01, 0x18, 0x00, 0x3c, 0x00, 0x1f, 0xb3, 0xde, 0x00, 0x1a, 0x26, 0x11, 0x7c, 0x32, 0x14, 0x15, 0xb0, 0xbe, 0x08, 0x0f, 0x02, 0x00, 0x11, 0x22, 0xb3, 0x94, 0x38, 0x00, 0x2f, 0x6e, 0x6b, 0xe8, 0x03, 0x1b, 0x71, 0xd4, 0x9c, 0xb7, 0xb5, 0xd4, 0x9c, 0xed, 0x0a, 0x06, 0x0f, 0xf6, 0x01, 0x17, 0x06, 0xea, 0x15, 0x1f, 0x4e, 0xac, 0x12, 0x1c, 0x1f, 0x2e, 0x96, 0x04, 0x1d, 0x38, 0x6b, 0x9e, 0xf7, 0x0c, 0x10, 0x4f, 0x92, 0x94, 0xed, 0x5a, 0x54, 0x16, 0x43, 0x4a, 0xed, 0x5a, 0x92, 0x94, 0xba, 0x06, 0x02, 0xa0, 0x0d, 0x6f, 0xb3, 0x94, 0x2d, 0x63, 0xcc, 0x52, 0x02, 0x00, 0x39, 0x42, 0x2d, 0x63, 0xb3, 0x94, 0x3c, 0x09, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 1858, false);
+
+const Escher::Image * const ImageStore::ElementsIcon = &image;
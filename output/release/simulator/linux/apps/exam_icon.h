@@ -0,0 +1,13 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#ifndef IMAGE_STORE_EXAM_ICON_H
+#define IMAGE_STORE_EXAM_ICON_H
+
+#include <escher/image.h>
+
+namespace ImageStore {
+
+extern const Escher::Image * const ExamIcon;
+
+};
+
+#endif
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "finance_icon.h"
+
+// Compressed 3080 pixels into 1366 bytes (22.18% compression ratio)/
+const uint8_t compressedPixelData[1366] = {0x15, 0xff, 0x01, 0x00, 0x8f, 0x9a, 0xd6, 0x4d, 0x6b, 0x29, 0x42, 0xe8, 0x39, 0x02, 0x00, 0x39, 0x7b, 0x29, 0x42, 0x4d, 0x6b, 0x9a, 0xd6, 0xff, 0x01, 0x00, 0x7f, 0x9e, 0xf7, 0x0c, 0x63, 0x09, 0x42, 0x08, 0x02, 0x00, 0x42, 0x66, 0x09, 0x42, 0x0c, 0x63, 0x9e, 0xf7, 0x6c, 0x00, 0x4f, 0xfc, 0xde, 0x49, 0x4a, 0x6c, 0x00, 0x45, 0x02, 0x70, 0x00, 0x42, 0x49, 0x4a, 0xfc, 0xde, 0x6c, 0x00, 0x6f, 0xbe, 0xf7, 0x49, 0x4a, 0x08, 0x42, 0x02, 0x00, 0x4d, 0x31, 0x49, 0x4a, 0xbe, 0xe0, 0x00, 0x4f, 0x2d, 0x63, 0x08, 0x42, 0x02, 0x00, 0x51, 0x6f, 0x2d, 0x63, 0xff, 0xff, 0xba, 0xd6, 0x44, 0x01, 0x49, 0x0a, 0x50, 0x01, 0x6f, 0xba, 0xd6, 0x6e, 0x6b, 0x08, 0x42, 0x02, 0x00, 0x55, 0x4f, 0x6e, 0x6b, 0x29, 0x42, 0x6e, 0x00, 0x57, 0x00, 0x60, 0x03, 0x0f, 0x3a, 0x00, 0x23, 0x4e, 0xe9, 0x39, 0xc9, 0x31, 0x02, 0x00, 0x3f, 0xe9, 0x39, 0xe9, 0x50, 0x00, 0x08, 0x2f, 0xe8, 0x39, 0x68, 0x00, 0x24, 0xd0, 0x39, 0xc8, 0x6a, 0xc7, 0x9b, 0x46, 0xbc, 0xa6, 0xcc, 0xc6, 0xd4, 0xe6, 0xdc, 0x02, 0x00, 0xa2, 0xc6, 0xd4, 0x86, 0xcc, 0x46, 0xbc, 0xa7, 0x9b, 0xa8, 0x62, 0x76, 0x00, 0x0f, 0x0e, 0x01, 0x32, 0xf0, 0x00, 0x3a, 0xc9, 0x31, 0xe8, 0x72, 0x86, 0xc4, 0x06, 0xe5, 0x46, 0xed, 0x86, 0xf5, 0xa6, 0xfd, 0x02, 0x00, 0x11, 0xc6, 0x02, 0x00, 0x02, 0x0c, 0x00, 0xcf, 0x86, 0xf5, 0x46, 0xed, 0x06, 0xdd, 0x67, 0xbc, 0x88, 0x62, 0xc9, 0x31, 0x6e, 0x00, 0x2f, 0x64, 0x28, 0x42, 0x86, 0xc4, 0x46, 0xed, 0x62, 0x00, 0x04, 0x64, 0x00, 0x04, 0x02, 0x00, 0x06, 0x16, 0x00, 0x4f, 0x46, 0xed, 0x47, 0xb4, 0xe0, 0x00, 0x2f, 0x3e, 0xa7, 0xcc, 0xa6, 0x66, 0x00, 0x0d, 0x02, 0x00, 0x02, 0x22, 0x00, 0x2f, 0x27, 0xb4, 0x6e, 0x00, 0x2d, 0x1f, 0xa6, 0x6a, 0x00, 0x0e, 0x06, 0x72, 0x00, 0x2f, 0x46, 0xf5, 0x6e, 0x00, 0x2d, 0x2f, 0x45, 0xf5, 0xda, 0x00, 0x0f, 0x04, 0xde, 0x00, 0x2f, 0xe5, 0xdc, 0x6e, 0x00, 0x2d, 0x5e, 0xe4, 0xec, 0x25, 0xf5, 0x86, 0xb6, 0x01, 0x0d, 0xba, 0x01, 0x6f, 0x86, 0xfd, 0x25, 0xf5, 0x65, 0xcc, 0x6e, 0x00, 0x2e, 0xa7, 0xe4, 0xe4, 0xec, 0x04, 0xed, 0x25, 0xf5, 0x65, 0xf5, 0x86, 0x5c, 0x00, 0x17, 0xc6, 0x80, 0x00, 0xcf, 0x86, 0xfd, 0x45, 0xf5, 0x25, 0xf5, 0x04, 0xed, 0xe4, 0xec, 0x85, 0xd4, 0x4a, 0x01, 0x2f, 0x40, 0xe4, 0xec, 0xe4, 0xec, 0x72, 0x00, 0x00, 0x02, 0x00, 0x55, 0x25, 0xed, 0x25, 0xf5, 0x45, 0x02, 0x00, 0x31, 0x25, 0xf5, 0x25, 0x16, 0x00, 0x22, 0xe4, 0xec, 0x02, 0x00, 0x2f, 0x25, 0xed, 0x6e, 0x00, 0x2d, 0x9f, 0x65, 0xf5, 0x65, 0xfd, 0x04, 0xed, 0xc4, 0xec, 0xe4, 0x02, 0x00, 0x0a, 0x8f, 0xc4, 0xec, 0x25, 0xed, 0x86, 0xfd, 0x05, 0xe5, 0x6e, 0x00, 0x2d, 0x20, 0x04, 0xed, 0x44, 0x01, 0x13, 0x65, 0x2c, 0x01, 0x0e, 0x02, 0x00, 0x00, 0xf6, 0x00, 0x31, 0x45, 0xf5, 0x65, 0x50, 0x01, 0x1f, 0x85, 0xb8, 0x01, 0x2e, 0x22, 0xc4, 0xe4, 0xb6, 0x01, 0x40, 0x65, 0xf5, 0x85, 0xfd, 0x76, 0x00, 0x17, 0x65, 0x4a, 0x01, 0x11, 0x65, 0x66, 0x00, 0x31, 0x65, 0xfd, 0x65, 0x56, 0x01, 0x2f, 0xe4, 0xec, 0x26, 0x02, 0x2f, 0x13, 0x25, 0x46, 0x01, 0x19, 0x04, 0xb2, 0x01, 0x08, 0x02, 0x00, 0x06, 0xf6, 0x00, 0x0f, 0x4a, 0x01, 0x22, 0x52, 0x3a, 0x09, 0x3a, 0xe9, 0x39, 0x02, 0x00, 0x6c, 0x09, 0x3a, 0xa5, 0xfd, 0x45, 0xf5, 0x3a, 0x01, 0x04, 0x02, 0x00, 0x0a, 0x18, 0x00, 0x4f, 0x65, 0xf5, 0x26, 0xed, 0xee, 0x05, 0x1f, 0x20, 0xc8, 0x39, 0x28, 0x06, 0x40, 0x28, 0x4a, 0x48, 0x4a, 0x7a, 0x00, 0x40, 0x46, 0xbc, 0x85, 0xfd, 0x72, 0x00, 0x0e, 0xb6, 0x01, 0x0a, 0xba, 0x01, 0x00, 0x52, 0x01, 0x1f, 0xa5, 0x02, 0x03, 0x18, 0xf5, 0x10, 0xe8, 0x39, 0xc9, 0x31, 0x48, 0x52, 0x47, 0x83, 0x07, 0xac, 0x47, 0xb4, 0x46, 0xbc, 0x66, 0xc4, 0x46, 0xbc, 0x06, 0xb4, 0xc6, 0xab, 0xa6, 0x9b, 0x87, 0x93, 0x66, 0xc4, 0xa5, 0xfd, 0x85, 0xa0, 0x01, 0x02, 0xf8, 0x02, 0x00, 0x0c, 0x03, 0x11, 0x25, 0xbc, 0x01, 0x01, 0x1a, 0x00, 0x01, 0x90, 0x00, 0x0f, 0xb8, 0x01, 0x17, 0x00, 0xc0, 0x05, 0x91, 0x87, 0x8b, 0x87, 0xc4, 0x46, 0xed, 0xc6, 0xfd, 0xe6, 0x02, 0x00, 0xe3, 0xc5, 0xfd, 0xa5, 0xfd, 0x65, 0xfd, 0x85, 0xd4, 0xc6, 0xab, 0x66, 0x93, 0xa6, 0x9b, 0x16, 0x02, 0x0e, 0x02, 0x00, 0x07, 0xba, 0x01, 0x2f, 0xe5, 0xdc, 0xd8, 0x00, 0x15, 0x77, 0x48, 0x52, 0x27, 0xb4, 0x86, 0xfd, 0xe6, 0xa0, 0x04, 0x02, 0x0a, 0x00, 0xa4, 0x65, 0xfd, 0x24, 0xf5, 0x65, 0xcc, 0x66, 0x93, 0x66, 0x93, 0xb4, 0x01, 0x12, 0x25, 0xd8, 0x00, 0x1a, 0xed, 0xda, 0x03, 0x00, 0xe2, 0x04, 0x2f, 0x46, 0xed, 0x18, 0x02, 0x13, 0x5e, 0x48, 0x52, 0x87, 0xc4, 0xe6, 0x08, 0x05, 0x01, 0x72, 0x00, 0x00, 0x70, 0x00, 0x6f, 0xc4, 0xe4, 0x46, 0x8b, 0xc6, 0xa3, 0xbc, 0x01, 0x07, 0x02, 0xda, 0x04, 0x1f, 0xc5, 0xdc, 0x00, 0x14, 0x3f, 0x67, 0xbc, 0xe6, 0xde, 0x05, 0x08, 0x01, 0x4e, 0x04, 0x65, 0xe4, 0x07, 0x7b, 0xa5, 0xd4, 0x25, 0x8e, 0x02, 0x08, 0xca, 0x04, 0x20, 0x65, 0xf5, 0xba, 0x01, 0x4f, 0x25, 0xf5, 0x45, 0xcc, 0x46, 0x01, 0x11, 0x3f, 0x68, 0x83, 0xc6, 0x4e, 0x06, 0x0c, 0x00, 0x04, 0x02, 0x40, 0x45, 0xc4, 0x47, 0x83, 0x2a, 0x02, 0x0d, 0x02, 0x00, 0x01, 0x96, 0x05, 0x00, 0xbe, 0x04, 0x2f, 0xa5, 0xdc, 0x0c, 0x08, 0x10, 0x3f, 0x4a, 0x46, 0xe5, 0xc2, 0x06, 0x0f, 0x8e, 0xe4, 0xec, 0x04, 0xf5, 0x07, 0x7b, 0xc5, 0xd4, 0x96, 0x05, 0x07, 0x08, 0x03, 0x1f, 0xed, 0x6e, 0x00, 0x10, 0x2f, 0x7b, 0xc6, 0x2c, 0x07, 0x10, 0x00, 0xbe, 0x00, 0x4e, 0x45, 0xc4, 0x66, 0x93, 0x72, 0x03, 0x04, 0x6a, 0x04, 0x4f, 0x85, 0xfd, 0x25, 0xed, 0xb4, 0x01, 0x11, 0x0f, 0x08, 0x08, 0x11, 0x20, 0x85, 0xfd, 0x56, 0x00, 0x2e, 0xc7, 0x6a, 0x58, 0x04, 0x02, 0xba, 0x01, 0x00, 0x96, 0x05, 0x1f, 0xa4, 0x4a, 0x01, 0x10, 0x2f, 0x46, 0xed, 0x78, 0x08, 0x13, 0x00, 0x5e, 0x00, 0x48, 0xe7, 0x72, 0x25, 0xed, 0x24, 0x05, 0x02, 0xb8, 0x01, 0x13, 0x85, 0x6c, 0x04, 0x0e, 0x6e, 0x00, 0x0e, 0xc2, 0x09, 0x2f, 0xa6, 0xfd, 0x6e, 0x00, 0x17, 0x42, 0x47, 0x8b, 0x06, 0xe5, 0x60, 0x00, 0x2a, 0x65, 0xfd, 0xda, 0x03, 0x00, 0xd8, 0x01, 0x2f, 0xc5, 0xab, 0x6e, 0x00, 0x0d, 0x2f, 0x48, 0x4a, 0x54, 0x09, 0x15, 0x00, 0x56, 0x00, 0x40, 0x86, 0x93, 0x45, 0xcc, 0x7e, 0x02, 0x28, 0xc4, 0xec, 0x60, 0x07, 0x02, 0x14, 0x03, 0x4f, 0x05, 0xbc, 0x48, 0x52, 0x92, 0x02, 0x0f, 0x0f, 0x6e, 0x00, 0x19, 0x48, 0x66, 0x93, 0x85, 0xd4, 0x70, 0x03, 0x02, 0x0c, 0x00, 0x8f, 0xc4, 0xe4, 0x44, 0xcc, 0xa5, 0xa3, 0x48, 0x52, 0xbe, 0x0a, 0x11, 0x2f, 0x86, 0xf5, 0x4a, 0x01, 0x17, 0x62, 0x07, 0x7b, 0x64, 0xd4, 0xc4, 0xe4, 0x02, 0x00, 0xff, 0x00, 0xa4, 0xe4, 0x84, 0xdc, 0x64, 0xd4, 0x25, 0xc4, 0xe5, 0xb3, 0x65, 0x93, 0x87, 0x62, 0xe9, 0x0a, 0x0c, 0x14, 0x2f, 0xe7, 0xd4, 0x6c, 0x00, 0x11, 0x11, 0x86, 0x6e, 0x00, 0x80, 0xa7, 0x62, 0x25, 0x8b, 0x45, 0x93, 0x65, 0x9b, 0x02, 0x00, 0xaf, 0x45, 0x93, 0x06, 0x7b, 0xa7, 0x72, 0x67, 0x5a, 0xe8, 0x39, 0x74, 0x0c, 0x19, 0x2f, 0xc7, 0x9b, 0x4c, 0x01, 0x11, 0x20, 0x45, 0xf5, 0x74, 0x02, 0x2e, 0x48, 0x52, 0x50, 0x0d, 0x2f, 0x09, 0x3a, 0x42, 0x07, 0x19, 0x2f, 0xa8, 0x62, 0xb6, 0x01, 0x15, 0x3f, 0xa6, 0xa3, 0x28, 0x1e, 0x10, 0x2e, 0x5f, 0xe9, 0x39, 0x87, 0xc4, 0xc6, 0xdc, 0x03, 0x10, 0x4f, 0xc4, 0xe4, 0x68, 0x5a, 0xa4, 0x0d, 0x31, 0x5f, 0x88, 0x5a, 0x66, 0xed, 0xc6, 0xda, 0x00, 0x0e, 0x1f, 0xc6, 0xda, 0x00, 0x30, 0x02, 0xde, 0x00, 0x5f, 0x48, 0x83, 0x66, 0xf5, 0xc6, 0xb4, 0x01, 0x0a, 0x6f, 0x45, 0xc4, 0x28, 0x4a, 0x08, 0x3a, 0x8e, 0x0f, 0x33, 0x6f, 0xc9, 0x39, 0xa7, 0x93, 0x66, 0xed, 0x58, 0x0c, 0x03, 0x11, 0x45, 0x2a, 0x0a, 0x0e, 0xba, 0x03, 0x0f, 0x70, 0x00, 0x2a, 0x7c, 0x31, 0x28, 0x7b, 0x07, 0xdd, 0x66, 0xf5, 0x86, 0x0e, 0x7f, 0x25, 0xf5, 0xa4, 0xdc, 0x25, 0xbc, 0x48, 0x3c, 0x12, 0x3e, 0x01, 0x08, 0x09, 0xff, 0x08, 0x93, 0xe6, 0xd4, 0x46, 0xed, 0x66, 0xed, 0x86, 0xf5, 0x86, 0xf5, 0x66, 0xf5, 0x05, 0xed, 0xa4, 0xdc, 0x65, 0xcc, 0x27, 0x83, 0x28, 0x42, 0xe6, 0x02, 0x1b, 0x0f, 0x56, 0x10, 0x14, 0xf1, 0x04, 0x3a, 0xe9, 0x39, 0xe8, 0x39, 0x48, 0x4a, 0xe7, 0x72, 0xa6, 0x9b, 0xa6, 0xa3, 0x86, 0x9b, 0x26, 0x8b, 0x88, 0x5a, 0x1a, 0x02, 0x0f, 0x6c, 0x00, 0x28, 0x0f, 0x52, 0x13, 0x0e, 0x01, 0x2a, 0x0b, 0x04, 0x30, 0x0b, 0x2f, 0x08, 0x3a, 0x5a, 0x13, 0x2b, 0x2f, 0xef, 0x7b, 0x0c, 0x12, 0x57, 0x4f, 0xef, 0x7b, 0x3c, 0xe7, 0x6e, 0x00, 0x57, 0x6f, 0x3c, 0xe7, 0xff, 0xff, 0xaf, 0x73, 0x6c, 0x00, 0x53, 0x20, 0xae, 0x73, 0xa0, 0x14, 0x3f, 0xdf, 0xff, 0x69, 0x0e, 0x15, 0x50, 0x33, 0x69, 0x4a, 0xdf, 0xea, 0x15, 0x4f, 0x7d, 0xef, 0x69, 0x4a, 0x6c, 0x00, 0x4d, 0x26, 0x7d, 0xef, 0x5a, 0x16, 0x6f, 0xdf, 0xff, 0xcf, 0x7b, 0xc7, 0x39, 0x6a, 0x00, 0x43, 0x6c, 0xc7, 0x39, 0xcf, 0x7b, 0xdf, 0xff, 0x01, 0x00, 0x9f, 0xfb, 0xde, 0x30, 0x84, 0x49, 0x4a, 0xa7, 0x31, 0xa6, 0x02, 0x00, 0x36, 0xf0, 0x03, 0xa7, 0x31, 0x49, 0x4a, 0x30, 0x84, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 1366, false);
+
+const Escher::Image * const ImageStore::FinanceIcon = &image;
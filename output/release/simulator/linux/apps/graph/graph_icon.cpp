@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "graph_icon.h"
+
+// Compressed 3080 pixels into 621 bytes (10.08% compression ratio)/
+const uint8_t compressedPixelData[621] = {0x19, 0xff, 0x01, 0x00, 0x4f, 0xdf, 0xff, 0xbe, 0xf7, 0x02, 0x00, 0x39, 0x2f, 0xdf, 0xff, 0x01, 0x00, 0x05, 0x2f, 0xbe, 0xf7, 0x02, 0x00, 0x45, 0x2f, 0xff, 0xff, 0xd4, 0x00, 0x4b, 0x0e, 0xe4, 0x00, 0x0f, 0x6c, 0x00, 0x57, 0x0a, 0x70, 0x00, 0x2f, 0xbe, 0xf7, 0x02, 0x00, 0x51, 0x0f, 0x6c, 0x00, 0x59, 0x02, 0x70, 0x00, 0x1f, 0xdf, 0x6e, 0x00, 0x6a, 0x2f, 0xab, 0x52, 0xbc, 0x01, 0x49, 0x0c, 0x12, 0x00, 0x2f, 0x08, 0x42, 0xec, 0x00, 0x57, 0x0f, 0x6e, 0x00, 0xff, 0x7c, 0x9f, 0x9d, 0xf7, 0x9c, 0xf7, 0x9c, 0xf7, 0x9d, 0xf7, 0x9e, 0x6e, 0x00, 0x46, 0x99, 0x9c, 0xf7, 0x38, 0xff, 0xd4, 0xfe, 0x91, 0xfe, 0x6f, 0x02, 0x00, 0x0f, 0x6e, 0x00, 0x3f, 0x5b, 0x5a, 0xff, 0xd4, 0xfe, 0x70, 0x66, 0x00, 0x0f, 0x6e, 0x00, 0x41, 0x3e, 0x9d, 0xf7, 0xf6, 0x68, 0x00, 0x0f, 0x6e, 0x00, 0x42, 0x3e, 0x9d, 0xf7, 0xd4, 0x68, 0x00, 0x0f, 0x6e, 0x00, 0x44, 0x1e, 0xf6, 0x6a, 0x00, 0x0f, 0x6e, 0x00, 0x14, 0x2a, 0x7d, 0xef, 0x02, 0x00, 0x2c, 0x08, 0x42, 0x12, 0x00, 0x0a, 0x02, 0x00, 0x2f, 0x3a, 0xf7, 0x3e, 0x01, 0x0b, 0x08, 0x02, 0x00, 0x0e, 0x4a, 0x00, 0x0f, 0x6e, 0x00, 0x1b, 0x2f, 0xd6, 0xf6, 0x5a, 0x00, 0x05, 0xf1, 0x00, 0x4e, 0xfe, 0x2c, 0xfe, 0x0b, 0xfe, 0xe9, 0xfd, 0xe8, 0xfd, 0xc7, 0xfd, 0xc6, 0xfd, 0xa6, 0x02, 0x00, 0x0f, 0x6e, 0x00, 0x29, 0x3f, 0x5c, 0xef, 0x92, 0x68, 0x00, 0x02, 0x7e, 0x4d, 0xfe, 0x0a, 0xfe, 0xc8, 0xfd, 0xa6, 0x02, 0x00, 0x0f, 0x6e, 0x00, 0x28, 0x2e, 0x5b, 0xef, 0x42, 0x01, 0x3e, 0x4f, 0xfe, 0x0b, 0x68, 0x00, 0x0f, 0x6e, 0x00, 0x30, 0x0e, 0x6c, 0x00, 0x00, 0x6a, 0x00, 0x1e, 0xc7, 0x6a, 0x00, 0x0f, 0x6e, 0x00, 0x30, 0x1d, 0x5c, 0x6c, 0x00, 0x1e, 0x2c, 0x6a, 0x00, 0x0f, 0x6e, 0x00, 0x34, 0x0c, 0x6c, 0x00, 0x3e, 0x4e, 0xfe, 0xe9, 0x6a, 0x00, 0x0f, 0x6e, 0x00, 0x36, 0x0a, 0x1c, 0x02, 0x1e, 0x2d, 0xd6, 0x00, 0x0f, 0x6e, 0x00, 0x38, 0x19, 0xd5, 0xf4, 0x02, 0x2e, 0x0b, 0xfe, 0x6a, 0x00, 0x0f, 0x6e, 0x00, 0x37, 0x28, 0x39, 0xf7, 0x6c, 0x00, 0x0e, 0x42, 0x01, 0x0f, 0x6e, 0x00, 0x39, 0x2e, 0x5d, 0xef, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x47, 0x1e, 0xb3, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x46, 0x2e, 0x3b, 0xef, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x47, 0x06, 0xf8, 0x02, 0x3f, 0x0a, 0xfe, 0xa6, 0x6e, 0x00, 0x4c, 0x26, 0x18, 0xf7, 0xca, 0x03, 0x2f, 0xa6, 0xfd, 0x6e, 0x00, 0x4d, 0x06, 0x74, 0x05, 0x2f, 0xc6, 0xfd, 0x6e, 0x00, 0x4d, 0x24, 0x19, 0xf7, 0x0e, 0x05, 0x0e, 0xcc, 0x03, 0x0f, 0x6e, 0x00, 0x3f, 0x1e, 0x70, 0x1e, 0x02, 0x0f, 0x6e, 0x00, 0x32, 0x2a, 0xdb, 0xde, 0x02, 0x00, 0x7f, 0x08, 0x42, 0xdb, 0xde, 0xb9, 0xde, 0x4f, 0xb2, 0x01, 0x2c, 0x02, 0x02, 0x00, 0x2e, 0xdb, 0xde, 0x02, 0x00, 0x0e, 0x6e, 0x00, 0x22, 0x51, 0xf6, 0x7e, 0x05, 0x2f, 0xc7, 0xfd, 0x6e, 0x00, 0x51, 0x1e, 0x4e, 0x46, 0x01, 0x0f, 0x6e, 0x00, 0x46, 0x22, 0x95, 0xe6, 0xec, 0x05, 0x1f, 0xa6, 0x6e, 0x00, 0x52, 0x11, 0x4f, 0x48, 0x01, 0x2f, 0xc8, 0xfd, 0x6e, 0x00, 0x53, 0x1e, 0x4e, 0x5a, 0x06, 0x0f, 0x6e, 0x00, 0x48, 0x0e, 0x20, 0x02, 0x0f, 0x6e, 0x00, 0x4b, 0x0e, 0x18, 0x05, 0x0f, 0x6e, 0x00, 0x47, 0x1e, 0x4d, 0x6c, 0x00, 0x0f, 0x6e, 0x00, 0x48, 0x2f, 0xe8, 0xfd, 0x6e, 0x00, 0x57, 0x3f, 0x09, 0x42, 0x08, 0x02, 0x00, 0x38, 0x4f, 0x8b, 0x52, 0xdb, 0xde, 0x02, 0x00, 0x67, 0x2f, 0xba, 0xd6, 0x6c, 0x00, 0x57, 0x2f, 0x9a, 0xd6, 0xdc, 0x00, 0x5b, 0x4f, 0xff, 0xff, 0x59, 0xce, 0x6a, 0x00, 0x53, 0x20, 0x38, 0xc6, 0xc4, 0x13, 0x1f, 0xfb, 0x4e, 0x01, 0x52, 0x42, 0x9a, 0xd6, 0xfb, 0xde, 0x34, 0x14, 0x4f, 0x59, 0xce, 0xba, 0xd6, 0x6c, 0x00, 0x4d, 0x26, 0x59, 0xce, 0x7e, 0x15, 0x4f, 0x38, 0xc6, 0x38, 0xc6, 0x6c, 0x00, 0x47, 0x4a, 0x18, 0xc6, 0x38, 0xc6, 0x5a, 0x16, 0x6f, 0xfb, 0xde, 0x55, 0xad, 0x38, 0xc6, 0xae, 0x01, 0x41, 0x24, 0x55, 0xad, 0x44, 0x01, 0x0a, 0x01, 0x00, 0x9f, 0xdb, 0xde, 0xd7, 0xbd, 0x34, 0xa5, 0xf3, 0x9c, 0xd3, 0x02, 0x00, 0x32, 0x74, 0xf3, 0x9c, 0x34, 0xa5, 0xd7, 0xbd, 0xdb, 0x6a, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 621, false);
+
+const Escher::Image * const ImageStore::GraphIcon = &image;
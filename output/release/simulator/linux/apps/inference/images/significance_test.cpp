@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "significance_test.h"
+
+// Compressed 1215 pixels into 1121 bytes (30.75% compression ratio)/
+const uint8_t compressedPixelData[1121] = {0x1f, 0xff, 0x01, 0x00, 0x08, 0xaf, 0x38, 0xc6, 0xb2, 0x94, 0xb2, 0x94, 0xd7, 0xbd, 0xbe, 0xf7, 0x1e, 0x00, 0x1f, 0x0f, 0x01, 0x00, 0x09, 0xef, 0xb6, 0xb5, 0x55, 0xad, 0x9e, 0xf7, 0xbe, 0xf7, 0x18, 0xc6, 0xf3, 0x9c, 0x9e, 0xf7, 0x1e, 0x00, 0x05, 0x1e, 0x38, 0x1e, 0x00, 0x0f, 0x01, 0x00, 0x0c, 0x55, 0x79, 0xce, 0x34, 0xa5, 0xdf, 0x9e, 0x00, 0x2f, 0x55, 0xad, 0x1e, 0x00, 0x07, 0x4f, 0x59, 0xce, 0x55, 0xad, 0x58, 0x00, 0x17, 0x66, 0xbe, 0xf7, 0xb2, 0x94, 0x7d, 0xef, 0x10, 0x00, 0x4f, 0x34, 0xa5, 0x9a, 0xd6, 0x1e, 0x00, 0x07, 0x4f, 0x55, 0xad, 0x9a, 0xd6, 0x5a, 0x00, 0x15, 0x48, 0xd7, 0xbd, 0x18, 0xc6, 0x10, 0x00, 0x4f, 0x1c, 0xe7, 0xf3, 0x9c, 0x1e, 0x00, 0x07, 0x4f, 0x3c, 0xe7, 0xd3, 0x9c, 0x58, 0x00, 0x13, 0x4c, 0x9e, 0xf7, 0xb2, 0x94, 0x98, 0x01, 0x4f, 0x55, 0xad, 0xdb, 0xde, 0x1e, 0x00, 0x11, 0x0f, 0x01, 0x00, 0x0b, 0x4c, 0x18, 0xc6, 0xf7, 0xbd, 0x14, 0x00, 0x44, 0xdb, 0xde, 0x75, 0xad, 0x1e, 0x00, 0x2c, 0x18, 0xc6, 0x1e, 0x00, 0x3f, 0xba, 0xd6, 0x75, 0x6c, 0x01, 0x10, 0x2a, 0xdf, 0xff, 0x46, 0x01, 0x06, 0x16, 0x00, 0x22, 0xbe, 0xf7, 0x08, 0x00, 0x0e, 0x0c, 0x02, 0x0f, 0x16, 0x00, 0x03, 0x0f, 0x80, 0x00, 0x15, 0x4f, 0xb6, 0xb5, 0x9a, 0xd6, 0x1e, 0x00, 0x09, 0x2e, 0x79, 0xce, 0x5a, 0x00, 0x0f, 0x34, 0x01, 0x13, 0x4f, 0xdb, 0xde, 0x55, 0xad, 0x1e, 0x00, 0x0d, 0x0f, 0xbe, 0x01, 0x0d, 0x0f, 0x26, 0x01, 0x05, 0x4f, 0x92, 0x94, 0x7d, 0xef, 0x1e, 0x00, 0x09, 0x1f, 0xdf, 0x5a, 0x00, 0x0a, 0x2e, 0x59, 0xce, 0xbe, 0x01, 0x06, 0xce, 0x00, 0x2f, 0xb6, 0xb5, 0x1e, 0x00, 0x07, 0x3f, 0x75, 0xad, 0xfb, 0x20, 0x02, 0x0a, 0x4f, 0x14, 0xa5, 0x3c, 0xe7, 0x76, 0x00, 0x07, 0x2f, 0xb2, 0x94, 0x1e, 0x00, 0x07, 0x1e, 0x79, 0x94, 0x00, 0x07, 0x01, 0x00, 0x2e, 0x5d, 0xef, 0xf4, 0x02, 0x08, 0x4c, 0x01, 0x2f, 0x71, 0x8c, 0x3c, 0x00, 0x09, 0x1f, 0xf3, 0x3c, 0x00, 0x08, 0x0e, 0xac, 0x02, 0x0a, 0x1e, 0x00, 0x1e, 0x92, 0x90, 0x02, 0x07, 0x01, 0x00, 0x2e, 0xd3, 0x9c, 0x1e, 0x00, 0x06, 0x1c, 0x00, 0x1f, 0x5d, 0x3a, 0x00, 0x0a, 0x2e, 0x54, 0xb5, 0x22, 0x04, 0x08, 0xf6, 0x03, 0x0e, 0x1e, 0x00, 0x04, 0x00, 0x04, 0x2e, 0x14, 0xa5, 0x38, 0x00, 0x07, 0x3c, 0x04, 0x5f, 0xa4, 0xaf, 0xd5, 0x96, 0xb5, 0x0a, 0x03, 0x09, 0x0f, 0x1e, 0x00, 0x05, 0x4f, 0xf7, 0xbd, 0x59, 0xce, 0x92, 0x00, 0x09, 0x4e, 0xb2, 0xcd, 0x87, 0xf5, 0x76, 0x02, 0x0a, 0x04, 0x05, 0x0f, 0x1a, 0x00, 0x03, 0x0e, 0xa2, 0x03, 0x0a, 0x1e, 0x00, 0x8f, 0x71, 0xee, 0xa6, 0xfd, 0xd1, 0xa4, 0x1c, 0xe7, 0x66, 0x03, 0x09, 0x2f, 0xfb, 0xde, 0xd6, 0x03, 0x17, 0x04, 0x1e, 0x00, 0xaf, 0x33, 0xad, 0xb1, 0xfe, 0xa6, 0xfd, 0x2b, 0xcd, 0xb5, 0xbd, 0x30, 0x06, 0x09, 0x1d, 0xd7, 0x1e, 0x00, 0x00, 0xde, 0x05, 0x0f, 0x0a, 0x05, 0x09, 0x40, 0x34, 0xad, 0xf1, 0xd5, 0x5a, 0x00, 0x3d, 0x87, 0xf5, 0x91, 0x44, 0x05, 0x0a, 0x10, 0x01, 0x0c, 0x1e, 0x00, 0x0a, 0xdc, 0x05, 0x0e, 0xdc, 0x01, 0x40, 0xd2, 0x9c, 0x91, 0xfe, 0x5a, 0x00, 0x5f, 0xa6, 0xfd, 0xed, 0xbc, 0x16, 0x8e, 0x01, 0x0a, 0x2f, 0x38, 0xc6, 0xb2, 0x00, 0x19, 0x53, 0x75, 0xb5, 0xb1, 0xcd, 0xb1, 0x5a, 0x00, 0x4f, 0x88, 0xed, 0x91, 0x9c, 0x22, 0x04, 0x07, 0x2a, 0x7d, 0xef, 0xb6, 0x00, 0x2e, 0x9a, 0xd6, 0xaa, 0x04, 0x08, 0xb2, 0x00, 0x43, 0xb2, 0x9c, 0x91, 0xf6, 0x5a, 0x00, 0x00, 0xb6, 0x00, 0x3f, 0xb4, 0xd4, 0xc5, 0xea, 0x06, 0x13, 0x00, 0xd4, 0x03, 0x0f, 0x5c, 0x03, 0x09, 0x66, 0x13, 0xa5, 0xd1, 0xd5, 0xb1, 0xfe, 0x5a, 0x00, 0x00, 0x6c, 0x01, 0x0e, 0x30, 0x00, 0x08, 0x6c, 0x01, 0x22, 0x5d, 0xef, 0x38, 0x05, 0x4f, 0xf3, 0x9c, 0xba, 0xd6, 0xd0, 0x08, 0x09, 0x48, 0x12, 0xad, 0xb1, 0xfe, 0x5a, 0x00, 0x6e, 0xa6, 0xfd, 0x2b, 0xd5, 0xf2, 0xa4, 0x32, 0x00, 0x06, 0x02, 0x01, 0x20, 0x34, 0xa5, 0xea, 0x00, 0x2e, 0xf3, 0x9c, 0xb2, 0x03, 0x08, 0x86, 0x04, 0x00, 0xc8, 0x02, 0x0c, 0x5a, 0x00, 0x5e, 0xa6, 0xfd, 0xcf, 0xac, 0x37, 0xc8, 0x01, 0x07, 0x52, 0x05, 0x38, 0x38, 0xc6, 0x00, 0x01, 0x00, 0x6f, 0x03, 0x7e, 0xe9, 0xf0, 0xa0, 0x17, 0x0f, 0x00, 0x05, 0x0a, 0x01, 0x00, 0x85, 0x01, 0xa2, 0xc0, 0x20, 0x16, 0x86, 0xdf, 0x1c, 0x0f, 0x00, 0x45, 0xbf, 0x1f, 0x16, 0x84, 0x0f, 0x00, 0x0b, 0x01, 0x00, 0x92, 0x6b, 0xc9, 0x0a, 0x00, 0x00, 0x00, 0x7e, 0xc3, 0x02, 0x0f, 0x00, 0x20, 0x6d, 0xc8, 0x0f, 0x00, 0x14, 0x7a, 0x0f, 0x00, 0x0a, 0x01, 0x00, 0x31, 0x16, 0xe9, 0x29, 0x7d, 0x00, 0x21, 0xc6, 0x63, 0x0f, 0x00, 0x31, 0x17, 0xe9, 0x28, 0x0f, 0x00, 0x2f, 0xc3, 0x63, 0x2d, 0x00, 0x01, 0x22, 0x98, 0x8b, 0x08, 0x00, 0x31, 0x3d, 0xdf, 0x04, 0x0f, 0x00, 0x12, 0x8a, 0x0f, 0x00, 0x3e, 0x3c, 0xe0, 0x04, 0x2c, 0x00, 0x33, 0x1a, 0xed, 0x14, 0x0a, 0x00, 0x83, 0xc0, 0x51, 0x00, 0x00, 0x00, 0x1c, 0xeb, 0x13, 0x0f, 0x00, 0x2e, 0xbf, 0x52, 0x2d, 0x00, 0x24, 0x8b, 0x92, 0x0a, 0x00, 0x20, 0x57, 0xb8, 0x0f, 0x00, 0x14, 0x8b, 0x0f, 0x00, 0x2d, 0x5a, 0xba, 0x2c, 0x00, 0x34, 0x09, 0xec, 0x24, 0x0b, 0x00, 0x75, 0x08, 0xee, 0x18, 0x00, 0x09, 0xed, 0x1f, 0x0f, 0x00, 0x2c, 0xed, 0x19, 0x2d, 0x00, 0x26, 0x5c, 0xb4, 0x0c, 0x00, 0x47, 0xa2, 0x6a, 0x00, 0x5f, 0x0f, 0x00, 0x2c, 0xa1, 0x6c, 0x2d, 0x00, 0x26, 0xc2, 0x51, 0x0c, 0x00, 0x56, 0x51, 0xbd, 0x00, 0xc2, 0x50, 0x0f, 0x00, 0x2b, 0x4f, 0xbe, 0x2c, 0x00, 0x36, 0x1f, 0xea, 0x06, 0x0d, 0x00, 0x57, 0x0b, 0xf2, 0x2a, 0xea, 0x05, 0xa2, 0x00, 0x2a, 0xf2, 0x0c, 0x2d, 0x00, 0x28, 0x78, 0x96, 0x0e, 0x00, 0x29, 0xbc, 0xa3, 0x0f, 0x00, 0x2a, 0xba, 0x4d, 0x2d, 0x00, 0x28, 0xd2, 0x3c, 0x0e, 0x00, 0x38, 0x75, 0xee, 0x39, 0x0f, 0x00, 0x29, 0x73, 0x96, 0x2c, 0x00, 0x38, 0x2d, 0xe0, 0x01, 0x0f, 0x00, 0x29, 0x55, 0xfb, 0x0f, 0x00, 0x29, 0x2c, 0xdc, 0x2d, 0x00, 0x29, 0x87, 0x87, 0x0f, 0x00, 0x39, 0x8a, 0xf3, 0x22, 0x10, 0x00, 0x28, 0xe3, 0x24, 0x70, 0x02, 0x28, 0xe0, 0x2e, 0x1c, 0x00, 0x49, 0x02, 0xe7, 0xc3, 0x68, 0x2d, 0x00, 0x27, 0x9e, 0x6a, 0x0d, 0x00, 0x29, 0x3c, 0xd2, 0x1c, 0x00, 0x49, 0x3f, 0xe6, 0xd0, 0xad, 0x11, 0x00, 0x27, 0x59, 0xb0, 0x0d, 0x00, 0x29, 0x96, 0x78, 0x1c, 0x00, 0x49, 0x99, 0xe9, 0xff, 0xf1, 0x3e, 0x02, 0x26, 0x15, 0xee, 0x4a, 0x01, 0x38, 0x06, 0xea, 0x1f, 0x1b, 0x00, 0x69, 0x06, 0xf0, 0xff, 0xff, 0xed, 0x44, 0x3f, 0x00, 0x26, 0xc4, 0x48, 0x66, 0x00, 0x19, 0xbb, 0x1a, 0x00, 0x69, 0x5a, 0xe8, 0xff, 0xff, 0xfe, 0xac, 0x13, 0x00, 0x25, 0x70, 0x9f, 0x0b, 0x00, 0x29, 0xc7, 0x4f, 0x1a, 0x00, 0x78, 0xca, 0xfc, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x13, 0x00, 0x15, 0x14, 0xc0, 0x02, 0x29, 0x41, 0xda, 0x3a, 0x03, 0x21, 0x34, 0xf3, 0xcf, 0x03, 0x1a, 0x95, 0x10, 0x01, 0x13, 0x7e, 0x38, 0x01, 0x39, 0xcc, 0x55, 0x00, 0xec, 0x01, 0x11, 0xfc, 0x2d, 0x00, 0x28, 0xfa, 0x0d, 0x15, 0x00, 0x22, 0x24, 0xea, 0x6a, 0x00, 0x29, 0x67, 0xc4, 0xaf, 0x01, 0x23, 0x38, 0xf6, 0x2a, 0x04, 0x19, 0xa9, 0x43, 0x00, 0x20, 0x9a, 0x8c, 0x06, 0x00, 0x39, 0x2b, 0xe8, 0x24, 0x3c, 0x04, 0x14, 0xdb, 0x57, 0x04, 0x29, 0xfc, 0x2c, 0x3e, 0x01, 0x7a, 0xea, 0x2d, 0x00, 0x00, 0x1f, 0xdd, 0x5a, 0xf9, 0x01, 0x15, 0xf9, 0x85, 0x04, 0x28, 0xe2, 0x03, 0x19, 0x00, 0x69, 0x66, 0xcd, 0x05, 0x3c, 0xdf, 0x66, 0x2c, 0x00, 0x26, 0x58, 0xf9, 0xb2, 0x04, 0x26, 0xfd, 0x88, 0x18, 0x00, 0x50, 0x00, 0x00, 0x01, 0xb9, 0x83, 
+};
+
+constexpr Escher::Image image = Escher::Image(45, 27, compressedPixelData, 1121, true);
+
+const Escher::Image * const ImageStore::SignificanceTest = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "settings_icon.h"
+
+// Compressed 3080 pixels into 577 bytes (9.37% compression ratio)/
+const uint8_t compressedPixelData[577] = {0x17, 0xff, 0x01, 0x00, 0xaf, 0xdc, 0xde, 0xb8, 0xb5, 0x16, 0x9d, 0xb4, 0x94, 0x94, 0x8c, 0x02, 0x00, 0x31, 0x88, 0xb4, 0x8c, 0xf5, 0x9c, 0xd8, 0xb5, 0xdc, 0xde, 0x62, 0x00, 0x06, 0x6a, 0x00, 0x4f, 0x16, 0x9d, 0x94, 0x8c, 0x02, 0x00, 0x41, 0x3b, 0x16, 0x9d, 0xfc, 0x72, 0x00, 0x4f, 0x19, 0xc6, 0x94, 0x8c, 0x02, 0x00, 0x49, 0x26, 0x39, 0xc6, 0x6c, 0x00, 0x2f, 0xf9, 0xbd, 0x6c, 0x00, 0x4b, 0x08, 0x70, 0x00, 0x4f, 0xdc, 0xd6, 0x94, 0x8c, 0x02, 0x00, 0x51, 0x02, 0x50, 0x01, 0x2f, 0xf5, 0x94, 0x6e, 0x00, 0x53, 0x5f, 0xf5, 0x9c, 0xff, 0xff, 0xbb, 0xda, 0x00, 0x54, 0x00, 0x02, 0x00, 0x4f, 0xdb, 0xd6, 0xb8, 0xb5, 0x6e, 0x00, 0x57, 0x4f, 0xb8, 0xb5, 0xf5, 0x9c, 0x6e, 0x00, 0x57, 0x1f, 0x15, 0x64, 0x03, 0x0e, 0x40, 0x74, 0x8c, 0x73, 0x84, 0x02, 0x00, 0x1f, 0x74, 0xf0, 0x03, 0x32, 0x0f, 0x6a, 0x00, 0x0b, 0x00, 0xba, 0x02, 0x82, 0x7e, 0xef, 0xff, 0xff, 0x7e, 0xef, 0x39, 0xc6, 0x10, 0x00, 0x0f, 0x02, 0x00, 0x45, 0x00, 0x5c, 0x00, 0x26, 0x1c, 0xe7, 0x96, 0x03, 0x2f, 0x1c, 0xe7, 0x70, 0x00, 0x49, 0x4b, 0x73, 0x84, 0x19, 0xc6, 0x72, 0x04, 0x3f, 0xbe, 0x73, 0x84, 0xda, 0x00, 0x45, 0x4a, 0x53, 0x84, 0x7e, 0xef, 0x6e, 0x00, 0x4f, 0x7e, 0xef, 0x53, 0x84, 0xde, 0x00, 0x3b, 0x40, 0xfb, 0xde, 0x3c, 0xe7, 0x02, 0x00, 0x4e, 0x1c, 0xe7, 0x9a, 0xd6, 0xbc, 0x05, 0x5f, 0x9a, 0xd6, 0x1c, 0xe7, 0x3c, 0x02, 0x00, 0x18, 0x2f, 0xfb, 0xde, 0x6e, 0x00, 0x0b, 0x31, 0x2f, 0x5b, 0x0e, 0x02, 0x00, 0x6a, 0xed, 0x52, 0xcd, 0x52, 0x3d, 0xe7, 0x6c, 0x00, 0x8f, 0x5d, 0xe7, 0xcd, 0x52, 0xed, 0x52, 0x0e, 0x5b, 0x02, 0x00, 0x17, 0x2f, 0x2f, 0x5b, 0xb6, 0x01, 0x15, 0x4a, 0x32, 0x7c, 0xf8, 0xbd, 0x6e, 0x00, 0x6f, 0xf8, 0xbd, 0x32, 0x7c, 0x73, 0x84, 0xb8, 0x01, 0x45, 0x28, 0x12, 0x7c, 0x9a, 0x06, 0x4f, 0xfc, 0xde, 0x12, 0x7c, 0xb8, 0x01, 0x3d, 0x0a, 0xde, 0x00, 0xef, 0x12, 0x7c, 0xd8, 0xb5, 0x5d, 0xef, 0xff, 0xff, 0x5d, 0xef, 0xd8, 0xb5, 0x12, 0x7c, 0xda, 0x00, 0x45, 0x04, 0xde, 0x00, 0xdf, 0x32, 0x7c, 0xf2, 0x73, 0xd1, 0x73, 0xb1, 0x73, 0xd1, 0x73, 0xf2, 0x73, 0x32, 0xda, 0x00, 0x48, 0x04, 0xb6, 0x04, 0x00, 0x72, 0x00, 0x00, 0x02, 0x00, 0x1f, 0x53, 0xbe, 0x04, 0x34, 0x0f, 0x28, 0x05, 0x57, 0x0f, 0x02, 0x00, 0xab, 0x0f, 0x0a, 0x01, 0x57, 0x0f, 0x32, 0x06, 0xff, 0x6c, 0x04, 0x04, 0x06, 0x0f, 0x02, 0x00, 0x1b, 0x0f, 0x32, 0x06, 0x05, 0x2f, 0xbb, 0xd6, 0x04, 0x06, 0x13, 0x0f, 0x02, 0x00, 0x1b, 0x0f, 0x32, 0x06, 0x05, 0x2f, 0x0e, 0x5b, 0x54, 0x05, 0x45, 0x0f, 0x32, 0x06, 0xff, 0xff, 0xfe, 0x0f, 0x52, 0x06, 0xff, 0xfe, 0x0f, 0x76, 0x0c, 0x32, 0x0f, 0x52, 0x06, 0x13, 0x1f, 0x1c, 0x76, 0x0c, 0x34, 0x0e, 0x52, 0x06, 0x0f, 0x84, 0x0c, 0x21, 0x2f, 0x2f, 0x5b, 0x52, 0x06, 0x67, 0x00, 0x90, 0x01, 0x0f, 0x52, 0x06, 0x57, 0x4f, 0x53, 0x84, 0x33, 0x84, 0x52, 0x06, 0x57, 0x2f, 0x53, 0x84, 0x52, 0x06, 0x59, 0x2e, 0xb4, 0x8c, 0x36, 0x03, 0x0f, 0x52, 0x06, 0x45, 0x8f, 0x53, 0x84, 0x39, 0xc6, 0xdf, 0xff, 0xd1, 0x73, 0x28, 0x05, 0x53, 0xaf, 0xd1, 0x73, 0xdf, 0xff, 0xff, 0xff, 0x59, 0xc6, 0xf1, 0x73, 0xd0, 0x05, 0x4f, 0x33, 0xd1, 0x73, 0x5a, 0x8c, 0x04, 0x4f, 0x36, 0xa5, 0xf1, 0x73, 0x6c, 0x00, 0x4d, 0x26, 0x56, 0xa5, 0xd0, 0x02, 0x5f, 0x15, 0x9d, 0x90, 0x6b, 0x53, 0xf6, 0x04, 0x44, 0x6a, 0x53, 0x84, 0x90, 0x6b, 0x15, 0x9d, 0xac, 0x03, 0x8f, 0x59, 0xc6, 0xb0, 0x6b, 0x90, 0x6b, 0x12, 0x7c, 0x74, 0x00, 0x39, 0x00, 0xa4, 0x03, 0x6e, 0x90, 0x6b, 0xb0, 0x6b, 0x59, 0xc6, 0xf6, 0x04, 0xbf, 0xdf, 0xff, 0x19, 0xc6, 0x93, 0x8c, 0xb0, 0x6b, 0x2e, 0x5b, 0x0e, 0x02, 0x00, 0x34, 0x60, 0x90, 0x6b, 0xb4, 0x94, 0x59, 0xc6, 0x1c, 0x02, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(55, 56, compressedPixelData, 577, false);
+
+const Escher::Image * const ImageStore::SettingsIcon = &image;
@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "cartesian_grid_icon.h"
+
+// Compressed 441 pixels into 62 bytes (4.69% compression ratio)/
+const uint8_t compressedPixelData[62] = {0x1f, 0xff, 0x01, 0x00, 0x1a, 0x2f, 0x34, 0xa5, 0x08, 0x00, 0x13, 0x0f, 0x2a, 0x00, 0x3f, 0x2f, 0x34, 0xa5, 0x02, 0x00, 0x15, 0x0f, 0xa8, 0x00, 0xff, 0xff, 0x65, 0x0f, 0x01, 0x00, 0x17, 0x1f, 0x00, 0x01, 0x00, 0x03, 0x1e, 0xff, 0x04, 0x00, 0x0f, 0x15, 0x00, 0x17, 0x0f, 0x69, 0x00, 0x04, 0x0f, 0x54, 0x00, 0xff, 0x27, 0x0c, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(21, 21, compressedPixelData, 62, true);
+
+const Escher::Image * const ImageStore::CartesianGridIcon = &image;
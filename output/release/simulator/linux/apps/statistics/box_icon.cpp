@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "box_icon.h"
+
+// Compressed 217 pixels into 67 bytes (10.29% compression ratio)/
+const uint8_t compressedPixelData[67] = {0x35, 0x80, 0xfd, 0xff, 0x01, 0x00, 0x2c, 0x80, 0xfd, 0x02, 0x00, 0x0e, 0x14, 0x00, 0x0c, 0x30, 0x00, 0x0f, 0x3e, 0x00, 0x69, 0x0f, 0x02, 0x00, 0x09, 0x0f, 0x22, 0x00, 0x11, 0x0f, 0xf8, 0x00, 0xa3, 0x20, 0xff, 0x00, 0x01, 0x00, 0x05, 0x11, 0x00, 0x07, 0x0a, 0x00, 0x02, 0x18, 0x00, 0x0f, 0x1f, 0x00, 0x2b, 0x0a, 0x01, 0x00, 0x0e, 0x11, 0x00, 0x0f, 0x7c, 0x00, 0x43, 0x50, 0x00, 0x00, 0x00, 0x00, 0xff, 
+};
+
+constexpr Escher::Image image = Escher::Image(31, 7, compressedPixelData, 67, true);
+
+const Escher::Image * const ImageStore::BoxIcon = &image;
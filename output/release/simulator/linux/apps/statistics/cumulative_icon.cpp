@@ -0,0 +1,10 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "cumulative_icon.h"
+
+// Compressed 589 pixels into 399 bytes (22.58% compression ratio)/
+const uint8_t compressedPixelData[399] = {0x1f, 0xff, 0x01, 0x00, 0x1e, 0x8f, 0x56, 0xff, 0xc2, 0xfd, 0xc2, 0xfd, 0x56, 0xff, 0x01, 0x00, 0x21, 0x51, 0x78, 0xff, 0xa1, 0xfd, 0x80, 0x02, 0x00, 0x4f, 0xa2, 0xfd, 0x80, 0xfd, 0x6e, 0x00, 0x17, 0x82, 0xae, 0xfe, 0x4a, 0xfe, 0xa1, 0xfd, 0x06, 0xfe, 0x3e, 0x00, 0x3f, 0xc3, 0xfd, 0xde, 0x70, 0x00, 0x14, 0x11, 0xc3, 0x30, 0x00, 0x40, 0xa0, 0xfd, 0x14, 0xff, 0x32, 0x00, 0x11, 0x35, 0x4c, 0x00, 0x1f, 0x36, 0x3c, 0x00, 0x14, 0x33, 0xbc, 0xff, 0xa0, 0x6e, 0x00, 0x0f, 0xe8, 0x00, 0x1f, 0x6f, 0x79, 0xff, 0xc3, 0xfd, 0x6b, 0xfe, 0x6e, 0x00, 0x19, 0x08, 0x24, 0x01, 0x0f, 0x5e, 0x01, 0x25, 0x20, 0x56, 0xff, 0x56, 0x01, 0x3f, 0xd0, 0xfe, 0xff, 0x01, 0x00, 0x22, 0x1f, 0xc2, 0xee, 0x00, 0x26, 0x00, 0x01, 0x00, 0x1f, 0xa1, 0x3e, 0x00, 0x28, 0x11, 0x57, 0x98, 0x01, 0x0f, 0x2c, 0x01, 0x21, 0x00, 0x01, 0x00, 0x4f, 0x05, 0xfe, 0x35, 0xff, 0x01, 0x00, 0x25, 0x3f, 0x13, 0xff, 0x07, 0x2e, 0x01, 0x22, 0x02, 0x96, 0x02, 0x3f, 0xa2, 0xfd, 0x79, 0x76, 0x00, 0x22, 0x02, 0x96, 0x02, 0x2f, 0xa1, 0xfd, 0x72, 0x03, 0x23, 0x0f, 0xa8, 0x01, 0x1b, 0x13, 0xdd, 0x30, 0x00, 0xbf, 0xc2, 0xfd, 0x99, 0xff, 0x13, 0xff, 0x6a, 0xfe, 0xa1, 0xfd, 0xa1, 0x6a, 0x01, 0x18, 0x33, 0xe4, 0xfd, 0x80, 0x02, 0x00, 0x7f, 0x06, 0xfe, 0x8c, 0xfe, 0x13, 0xff, 0xdd, 0xea, 0x00, 0x1c, 0x2f, 0x35, 0xff, 0xd8, 0x01, 0x27, 0x1f, 0x00, 0x01, 0x00, 0x05, 0x4f, 0x4e, 0xe9, 0xea, 0x4e, 0x1d, 0x00, 0x06, 0x8f, 0x07, 0x3c, 0xf2, 0xff, 0xff, 0xfb, 0xee, 0xff, 0x37, 0x00, 0x02, 0xae, 0x89, 0xae, 0xf2, 0xc8, 0xf5, 0xff, 0xff, 0xe5, 0x0e, 0x00, 0x01, 0x00, 0xce, 0xe7, 0xff, 0xff, 0xf9, 0x5d, 0x0f, 0x00, 0x50, 0xeb, 0xea, 0x4f, 0x00, 0x01, 0x00, 0x5f, 0x1a, 0xf9, 0xff, 0xff, 0xe0, 0x75, 0x00, 0x06, 0x3e, 0x35, 0xe2, 0xa4, 0x37, 0x00, 0x05, 0x01, 0x00, 0x4f, 0x3b, 0xe8, 0x4b, 0x00, 0xcd, 0x00, 0x07, 0x4f, 0xed, 0xfd, 0x7e, 0x00, 0x01, 0x00, 0x07, 0x4f, 0xe8, 0xff, 0xff, 0xe6, 0x1f, 0x00, 0x08, 0x1f, 0xf6, 0x96, 0x00, 0x09, 0x4f, 0x00, 0x42, 0xe8, 0xec, 0x96, 0x00, 0x07, 0x5f, 0x00, 0x02, 0xd0, 0x52, 0x00, 0x01, 0x00, 0x08, 0x3f, 0x61, 0xc2, 0x00, 0x82, 0x01, 0x08, 0x3e, 0xeb, 0xed, 0x35, 0x1f, 0x00, 0x07, 0x4b, 0x01, 0x1f, 0xf4, 0xb9, 0x01, 0x08, 0x5e, 0xea, 0xff, 0xff, 0xe1, 0x00, 0x01, 0x00, 0xbf, 0x15, 0xe8, 0xff, 0xff, 0xe9, 0x33, 0x63, 0xa9, 0xf4, 0xf6, 0xeb, 0xb5, 0x00, 0x01, 0x9f, 0xd8, 0xfe, 0xff, 0xff, 0xfc, 0xce, 0x9f, 0x63, 0x14, 0x75, 0x00, 0x04, 0x1f, 0x50, 0x82, 0x01, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+constexpr Escher::Image image = Escher::Image(31, 19, compressedPixelData, 399, true);
+
+const Escher::Image * const ImageStore::CumulativeIcon = &image;
@@ -0,0 +1,240 @@
+// This file is auto-generated by layout.py
+
+#include <ion/src/simulator/shared/layout.h>
+#include <ion/src/simulator/shared/window.h>
+#include <ion/src/simulator/shared/platform.h>
+#include <ion.h>
+#include <limits.h>
+#include <cmath>
+namespace Ion {
+namespace Simulator {
+namespace Layout {
+#if !EPSILON_SDL_SCREEN_ONLY
+constexpr static int backgroundWidth = 1160;
+constexpr static int backgroundHeight = 2220;
+constexpr static float X(int x) { return static_cast<float>(x)/static_cast<float>(backgroundWidth); }
+constexpr static float Y(int y) { return static_cast<float>(y)/static_cast<float>(backgroundHeight); }
+constexpr static SDL_FRect areaOfInterest = {X(100), Y(30), X(960), Y(2150)};
+constexpr static SDL_FRect screenRect = {X(171), Y(175), X(818), Y(596)};
+static SDL_Rect sFrame;
+static void makeAbsolute(const SDL_FRect f, SDL_Rect * r) {
+  r->x = std::round(f.x * static_cast<float>(sFrame.w) + static_cast<float>(sFrame.x));
+  r->y = std::round(f.y * static_cast<float>(sFrame.h) + static_cast<float>(sFrame.y));
+  r->w = std::round(f.w * static_cast<float>(sFrame.w));
+  r->h = std::round(f.h * static_cast<float>(sFrame.h));
+}
+static void makeAbsolute(const SDL_FPoint f, SDL_Point * p) {
+  p->x = f.x * sFrame.w + sFrame.x;
+  p->y = f.y * sFrame.h + sFrame.y;
+}
+void recompute(int width, int height) {
+  float windowWidth = static_cast<float>(width);
+  float windowHeight = static_cast<float>(height);
+  float aoiRatio = (areaOfInterest.w / areaOfInterest.h) * (static_cast<float>(backgroundWidth)/static_cast<float>(backgroundHeight));
+  float windowRatio = windowWidth/windowHeight;
+  if (aoiRatio > windowRatio) {
+    // Area of interest is wider than the window (e.g. aoe 16:9, window 4:3)
+    // There will be "black bars" above and below
+    // We want the areaOfInterest's rect in pixels to be
+    // aoiInPixels.w = windowWidth
+    // aoiInPixels.x = 0
+    // aoiInPixels.h = windowWidth / (aoiRatio*deviceRatio)
+    // aoiInPixels.y = (windowHeight - aoiInPixels.h)/2
+    // But we also know that
+    // aoiInPixels.x = sFrame.x + areaOfInterest.x*sFrame.w
+    // aoiInPixels.y = sFrame.y + areaOfInterest.y*sFrame.h
+    // aoiInPixels.w = sFrame.w * areaOfInterest.w
+    // aoiInPixels.h = sFrame.h * areaOfInterest*h
+    sFrame.w = windowWidth / areaOfInterest.w;
+    sFrame.h = (windowWidth / aoiRatio) / areaOfInterest.h;
+    sFrame.x = - areaOfInterest.x * sFrame.w;
+    sFrame.y = (windowHeight - windowWidth/aoiRatio)/2 - areaOfInterest.y * sFrame.h;
+  } else {
+    // Area of interest is taller than the window (e.g. window 16:9, aoe 4:3)
+    // There will be "black bars" on the sides
+    // We want the areaOfInterest's rect in pixels to be
+    // aoiInPixels.h = windowHeight
+    // aoiInPixels.y = 0
+    // aoiInPixels.x = windowHeight * aoiRatio
+    // aoiInPixels.w = (windowWidth - aoiInPixels.w)/2;
+    // But we also know that
+    // aoiInPixels.x = sFrame.x + areaOfInterest.x*sFrame.w
+    // aoiInPixels.y = sFrame.y + areaOfInterest.y*sFrame.h
+    // aoiInPixels.w = sFrame.w * areaOfInterest.w
+    // aoiInPixels.h = sFrame.h * areaOfInterest*h
+    sFrame.h = windowHeight / areaOfInterest.h;
+    sFrame.w = (windowHeight * aoiRatio) / areaOfInterest.w;
+    sFrame.y = - areaOfInterest.y * sFrame.h;
+    sFrame.x = (windowWidth - windowHeight*aoiRatio)/2.0f - areaOfInterest.x * sFrame.w;
+  }
+}
+void getScreenRect(SDL_Rect * rect) {
+  makeAbsolute(screenRect, rect);
+}
+void getBackgroundRect(SDL_Rect * rect) {
+  rect->x = sFrame.x;
+  rect->y = sFrame.y;
+  rect->w = sFrame.w;
+  rect->h = sFrame.h;
+}
+class KeyLayout {
+public:
+  enum class Shape : uint8_t {
+    HorizontalArrow,
+    VerticalArrow,
+    Round,
+    SmallSquircle,
+    LargeSquircle,
+    NumberOfShapes
+  };
+  constexpr static size_t NumberOfShapes = (size_t)Shape::NumberOfShapes;
+  constexpr static const char * assetName[KeyLayout::NumberOfShapes] = {
+    "horizontal_arrow.png",
+    "vertical_arrow.png",
+    "round.png",
+    "small_squircle.png",
+    "large_squircle.png"
+  };
+  constexpr KeyLayout(float x, float y, Shape shape) :
+    m_center{X(x), Y(y)},
+    m_shape(shape) {}
+  SDL_FPoint center() const { return m_center; }
+  Shape shape() const { return m_shape; }
+private:
+  SDL_FPoint m_center;
+  Shape m_shape;
+};
+constexpr const char * const KeyLayout::assetName[KeyLayout::NumberOfShapes];
+constexpr static KeyLayout sKeyLayouts[Keyboard::NumberOfValidKeys] = {
+  KeyLayout(180, 1026, KeyLayout::Shape::HorizontalArrow),
+  KeyLayout(262, 948, KeyLayout::Shape::VerticalArrow),
+  KeyLayout(262, 1102, KeyLayout::Shape::VerticalArrow),
+  KeyLayout(340, 1026, KeyLayout::Shape::HorizontalArrow),
+  KeyLayout(818, 1028, KeyLayout::Shape::Round),
+  KeyLayout(979, 1028, KeyLayout::Shape::Round),
+  KeyLayout(581, 958, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(581, 1096, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(182, 1256, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(340, 1256, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(500, 1256, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(658, 1256, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(820, 1256, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(978, 1256, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(182, 1380, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(340, 1380, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(500, 1380, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(658, 1380, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(820, 1380, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(978, 1380, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(182, 1504, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(340, 1504, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(500, 1504, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(658, 1504, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(820, 1504, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(978, 1504, KeyLayout::Shape::SmallSquircle),
+  KeyLayout(198, 1637, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(389, 1637, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(581, 1637, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(772, 1637, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(966, 1637, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(198, 1777, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(389, 1777, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(581, 1777, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(772, 1777, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(966, 1777, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(198, 1915, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(389, 1915, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(581, 1915, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(772, 1915, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(966, 1915, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(198, 2053, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(389, 2053, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(581, 2053, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(772, 2053, KeyLayout::Shape::LargeSquircle),
+  KeyLayout(966, 2053, KeyLayout::Shape::LargeSquircle),
+};
+static void getKeyCenter(int validKeyIndex, SDL_Point * point) {
+  assert(validKeyIndex >= 0 && validKeyIndex < Keyboard::NumberOfValidKeys);
+  makeAbsolute(sKeyLayouts[validKeyIndex].center(), point);
+}
+static void getKeyRectangle(int validKeyIndex, SDL_Texture * texture, SDL_Rect * rect) {
+  assert(validKeyIndex >= 0 && validKeyIndex < Keyboard::NumberOfValidKeys);
+  SDL_FPoint point = sKeyLayouts[validKeyIndex].center();
+  int w, h;
+  SDL_QueryTexture(texture, NULL, NULL, &w, &h);
+  SDL_FRect fRect;
+  fRect.w = X(w);
+  fRect.h = Y(h);
+  fRect.x = point.x - fRect.w/2.0f;
+  fRect.y = point.y - fRect.h/2.0f;
+  makeAbsolute(fRect, rect);
+}
+static SDL_Texture * sBackgroundTexture = nullptr;
+static SDL_Texture * sKeyLayoutTextures[KeyLayout::NumberOfShapes];
+
+void init(SDL_Renderer * renderer) {
+  sBackgroundTexture = Platform::loadImage(renderer, "background.jpg");
+  for (size_t i = 0; i < KeyLayout::NumberOfShapes; i++) {
+    sKeyLayoutTextures[i] = Platform::loadImage(renderer, KeyLayout::assetName[i]);
+  }
+}
+static int sHighlightedKeyIndex = -1;
+Keyboard::Key getHighlightedKey() {
+  Keyboard::Key k = Keyboard::Key::None;
+  if (sHighlightedKeyIndex >= 0) {
+    k = Keyboard::ValidKeys[sHighlightedKeyIndex];
+  }
+  return k;
+}
+void highlightKeyAt(SDL_Point * p) {
+  int newHighlightedKeyIndex = -1;
+  int minSquaredDistance = INT_MAX;
+  /* The closenessThreshold is apportioned to the size of the frame. As the
+   * width and the height have a constant ratio, we can compute the
+   * closenessThreshold from the frame width exclusively. */
+  int closenessThreshold = sFrame.w/6;
+  int squaredClosenessThreshold = closenessThreshold*closenessThreshold;
+  for (int i=0; i<Keyboard::NumberOfValidKeys; i++) {
+    SDL_Point keyCenter;
+    getKeyCenter(i, &keyCenter);
+    int dx = keyCenter.x - p->x;
+    int dy = keyCenter.y - p->y;
+    int squaredDistance = dx*dx + dy*dy;
+    if (squaredDistance < squaredClosenessThreshold && squaredDistance < minSquaredDistance) {
+      minSquaredDistance = squaredDistance;
+      newHighlightedKeyIndex = i;
+    }
+  }
+  if (newHighlightedKeyIndex != sHighlightedKeyIndex) {
+    sHighlightedKeyIndex = newHighlightedKeyIndex;
+    Window::setNeedsRefresh();
+  }
+}
+void unhighlightKey() {
+  sHighlightedKeyIndex = -1;
+  Window::setNeedsRefresh();
+}
+void drawHighlightedKey(SDL_Renderer * renderer) {
+  if (sHighlightedKeyIndex < 0) {
+    return;
+  }
+  int shape = static_cast<int>(sKeyLayouts[sHighlightedKeyIndex].shape());
+  SDL_Texture * keyTexture = sKeyLayoutTextures[shape];
+  SDL_Rect rect;
+  getKeyRectangle(sHighlightedKeyIndex, keyTexture, &rect);
+  SDL_RenderCopy(renderer, keyTexture, nullptr, &rect);
+}
+void draw(SDL_Renderer * renderer) {
+  SDL_Rect backgroundRect;
+  getBackgroundRect(&backgroundRect);
+  SDL_RenderCopy(renderer, sBackgroundTexture, nullptr, &backgroundRect);
+  drawHighlightedKey(renderer);
+}
+void shutdown() {
+  SDL_DestroyTexture(sBackgroundTexture);
+  sBackgroundTexture = nullptr;
+}
+#endif
+}
+}
+}
@@ -0,0 +1,606 @@
+/* This file is auto-generated by the rasterizer */
+
+#include "LargeFont.h"
+#include <kandinsky/font.h>
+
+constexpr static KDCoordinate numberOfCodePoints = 153;
+constexpr static uint16_t glyphDataOffset[numberOfCodePoints + 1] = {
+  0x0000, 0x000b, 0x0020, 0x0034, 0x0077, 0x00be, 0x0102, 0x0146, 0x0159,
+  0x01a4, 0x01e5, 0x0211, 0x022b, 0x0248, 0x025a, 0x0269, 0x029b, 0x02de,
+  0x02f8, 0x0337, 0x0378, 0x03b2, 0x03e5, 0x0428, 0x0460, 0x04a3, 0x04e6,
+  0x04f8, 0x0520, 0x0551, 0x0566, 0x0597, 0x05d0, 0x0620, 0x0663, 0x06a4,
+  0x06e2, 0x0724, 0x0746, 0x0768, 0x07a7, 0x07c5, 0x07e2, 0x0808, 0x084b,
+  0x0861, 0x089d, 0x08dc, 0x0912, 0x093b, 0x0987, 0x09ca, 0x0a09, 0x0a23,
+  0x0a48, 0x0a8c, 0x0ad1, 0x0b16, 0x0b4d, 0x0b8d, 0x0ba6, 0x0be3, 0x0bfd,
+  0x0c28, 0x0c3e, 0x0c5e, 0x0c94, 0x0cc7, 0x0cf9, 0x0d31, 0x0d67, 0x0d8e,
+  0x0dcc, 0x0def, 0x0e0b, 0x0e2b, 0x0e63, 0x0e86, 0x0ea8, 0x0ece, 0x0f01,
+  0x0f38, 0x0f6d, 0x0f92, 0x0fc7, 0x0feb, 0x1012, 0x1047, 0x107d, 0x10ae,
+  0x10f1, 0x1123, 0x1153, 0x1162, 0x1191, 0x11b0, 0x11d5, 0x11f6, 0x1214,
+  0x1224, 0x124a, 0x128d, 0x12c3, 0x12ef, 0x1336, 0x1363, 0x13a9, 0x13e0,
+  0x142e, 0x144a, 0x147f, 0x14b0, 0x14d0, 0x14f3, 0x1515, 0x152c, 0x1540,
+  0x1552, 0x156a, 0x1580, 0x15b7, 0x15d1, 0x1615, 0x1650, 0x1694, 0x16ca,
+  0x171e, 0x1759, 0x17a0, 0x17d2, 0x1823, 0x184d, 0x1890, 0x18d7, 0x1900,
+  0x191d, 0x1953, 0x1986, 0x19c9, 0x1a00, 0x1a22, 0x1a53, 0x1a85, 0x1ab7,
+  0x1afd, 0x1b59, 0x1b82, 0x1bab, 0x1bdd, 0x1c16, 0x1c4c, 0x1c88, 0x1cc4,
+  0x1d07
+};
+
+/* Rasterized  = 27540 bytes (153 glyphs x 180 pixels)
+ * Downsampled = 13770 bytes (1/2 of rasterized)
+ * Compressed  =  7431 bytes (26.98% of rasterized) */
+constexpr static uint8_t glyphData[7431] = {
+  0x1f, 0x00, 0x01, 0x00, 0x41, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x01, 0x00, 0x1f, 0xf0, 0x05, 0x00, 0x14, 0x0b, 0x32, 0x00, 0x09, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x2f, 0xf0, 0x0f,
+  0x05, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x1d, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x01, 0xe0, 0x1e, 0x00, 0x00, 0x04, 0xc0,
+  0x4c, 0x00, 0x00, 0x07, 0x90, 0x79, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x00,
+  0x0e, 0x20, 0xe2, 0x00, 0x00, 0x2e, 0x02, 0xf0, 0x00, 0x00, 0x6a, 0x06, 0xb0,
+  0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xc4, 0x0c, 0x40, 0x00, 0x00, 0xf1,
+  0x0f, 0x10, 0x00, 0x03, 0xd0, 0x3d, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0x10, 0x08, 0x05, 0x00, 0x14, 0x0f, 0x05,
+  0x00, 0xb0, 0x3b, 0xff, 0xc3, 0x00, 0x00, 0xe5, 0x00, 0x4d, 0x00, 0x00, 0xf1,
+  0x13, 0x00, 0x80, 0xad, 0x20, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0x10, 0x1a, 0x00,
+  0x10, 0xe3, 0x11, 0x00, 0xf8, 0x01, 0x5d, 0x00, 0x00, 0x20, 0x00, 0x0f, 0x00,
+  0x01, 0xe7, 0x10, 0x6d, 0x00, 0x00, 0x1a, 0xff, 0xd4, 0x3c, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf2,
+  0x24, 0x3e, 0xe3, 0x00, 0x00, 0x3e, 0xe2, 0x2e, 0x00, 0x02, 0xe4, 0xe3, 0x3e,
+  0x00, 0x1d, 0x50, 0x3e, 0xd3, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x0b, 0x80, 0x00,
+  0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x08, 0xb0, 0x00, 0x00, 0x00, 0x7c, 0x00,
+  0x3e, 0xd3, 0x05, 0xd1, 0x00, 0xe2, 0x2e, 0x4e, 0x20, 0x00, 0xe2, 0x2e, 0xe3,
+  0x35, 0x00, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x01, 0x00, 0xfb, 0x27, 0x1b, 0xfc, 0x20, 0x00, 0x00, 0xc6, 0x04, 0xd0, 0x00,
+  0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xd5, 0x08, 0xb0, 0x00, 0x00, 0x7d, 0xae,
+  0x20, 0x00, 0x00, 0x5f, 0xe1, 0x00, 0x00, 0x05, 0xd5, 0xf8, 0x00, 0xd7, 0x0e,
+  0x20, 0x4f, 0x78, 0xd0, 0x0f, 0x00, 0x05, 0xff, 0x30, 0x09, 0x70, 0x04, 0xff,
+  0xc0, 0x00, 0x9e, 0xfc, 0x41, 0x90, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x05, 0x0f, 0x01, 0x00,
+  0x1e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0xf4, 0x0f,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0xc5, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x00, 0x00,
+  0x00, 0xb4, 0x00, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x0b, 0x40, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x05, 0x00, 0xc0, 0x0e, 0x10, 0x00, 0x00, 0x00, 0x09,
+  0x50, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x10, 0x00, 0x20, 0x96, 0x00, 0x24, 0x00,
+  0x10, 0x50, 0x06, 0x00, 0xc0, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x10, 0x0a, 0x05, 0x00, 0x20,
+  0x06, 0xc1, 0x06, 0x00, 0x70, 0x3c, 0x10, 0x00, 0x00, 0x00, 0x04, 0xb0, 0x0b,
+  0x00, 0x10, 0xa5, 0x05, 0x00, 0x10, 0x3b, 0x05, 0x00, 0x15, 0x0f, 0x05, 0x00,
+  0x10, 0x1e, 0x05, 0x00, 0x10, 0x59, 0x05, 0x00, 0x10, 0xc3, 0x33, 0x00, 0x50,
+  0x90, 0x00, 0x00, 0x00, 0x4b, 0x09, 0x00, 0x13, 0xb0, 0x46, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x14, 0x0f, 0x05, 0x00,
+  0xff, 0x09, 0xba, 0x3f, 0x39, 0xa0, 0x00, 0x07, 0xef, 0xe6, 0x00, 0x00, 0x01,
+  0xdd, 0xc1, 0x00, 0x00, 0x1d, 0x80, 0x8d, 0x10, 0x00, 0x98, 0x00, 0x08, 0x90,
+  0x3a, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x07, 0x19, 0x0f, 0x05, 0x00, 0x4c, 0xff, 0xff, 0xff, 0xf0, 0x14, 0x00, 0x0f,
+  0x01, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x2f, 0x10, 0x5e, 0x05, 0x00, 0xf0, 0x03, 0xd7, 0x00, 0x00, 0x00, 0x0b, 0xb0,
+  0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x15, 0x3f, 0xff, 0xff, 0xff, 0x2c, 0x00, 0x16, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x2f, 0x1d, 0xff, 0x12, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x00, 0x10, 0x3c, 0x05,
+  0x00, 0x10, 0x96, 0x05, 0x00, 0xf0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x06, 0xa0,
+  0x00, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x3d, 0x13, 0x00, 0x10, 0x97,
+  0x05, 0x00, 0x15, 0xe1, 0x18, 0x00, 0x1f, 0x40, 0x18, 0x00, 0x08, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x2b, 0xff, 0xb2,
+  0x00, 0x00, 0xe8, 0x00, 0x7e, 0x10, 0x07, 0xb0, 0x00, 0x09, 0x80, 0x0c, 0x40,
+  0x00, 0x03, 0xd0, 0x0e, 0x10, 0x75, 0x01, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0,
+  0x0f, 0x00, 0x78, 0x00, 0xf0, 0x0c, 0x20, 0x00, 0x03, 0xd0, 0x08, 0x80, 0x00,
+  0x08, 0x90, 0x01, 0xd5, 0x00, 0x5e, 0x20, 0x00, 0x2c, 0xff, 0xc3, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x21, 0x0f, 0xff,
+  0x06, 0x00, 0x0f, 0x05, 0x00, 0x18, 0x4b, 0xff, 0xff, 0xff, 0xf0, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xd0, 0x4c, 0xfe,
+  0x90, 0x00, 0x05, 0xd3, 0x01, 0x9a, 0x00, 0x00, 0x10, 0x00, 0x0f, 0x11, 0x00,
+  0x01, 0x05, 0x00, 0x10, 0x4b, 0x05, 0x00, 0xf0, 0x04, 0xc4, 0x00, 0x00, 0x00,
+  0x07, 0xa0, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00,
+  0x00, 0x7c, 0x17, 0x00, 0x4b, 0xff, 0xff, 0xff, 0xf0, 0x45, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x80, 0x4c, 0xfe, 0x91, 0x00,
+  0x03, 0xd4, 0x02, 0xcb, 0x0c, 0x00, 0x10, 0x1f, 0x05, 0x00, 0xf0, 0x01, 0x2e,
+  0x00, 0x00, 0x00, 0x16, 0xe6, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00,
+  0x03, 0xbc, 0x14, 0x00, 0xfc, 0x01, 0x0c, 0x60, 0x00, 0x00, 0x00, 0x0b, 0x70,
+  0x0a, 0x92, 0x01, 0x7f, 0x20, 0x02, 0x9e, 0xff, 0xc4, 0x45, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x60, 0x05, 0xf0, 0x00, 0x00,
+  0x00, 0x2d, 0x05, 0x00, 0xf0, 0x0c, 0xc6, 0xf0, 0x00, 0x00, 0x07, 0xa0, 0xf0,
+  0x00, 0x00, 0x3d, 0x10, 0xf0, 0x00, 0x00, 0xd3, 0x00, 0xf0, 0x00, 0x0a, 0x60,
+  0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x29, 0xf0, 0x00, 0x05,
+  0x00, 0x08, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0x88, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x05, 0x00, 0x30,
+  0xff, 0xfe, 0xb3, 0x07, 0x00, 0x74, 0x5d, 0x30, 0x00, 0x00, 0x00, 0x04, 0xc0,
+  0x17, 0x00, 0xbc, 0x02, 0xe0, 0x00, 0x00, 0x00, 0x3c, 0x70, 0x00, 0xff, 0xff,
+  0xc6, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0xfc, 0x26, 0x04, 0xcf, 0xff, 0xf0, 0x00, 0x7b, 0x30, 0x00, 0x00, 0x02, 0xc0,
+  0x00, 0x00, 0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x0d, 0x6c, 0xff, 0xc7, 0x00,
+  0x0f, 0xf5, 0x00, 0x2c, 0x80, 0x0f, 0x50, 0x00, 0x02, 0xe0, 0x0d, 0x20, 0x00,
+  0x00, 0xf0, 0x08, 0x70, 0x00, 0x03, 0xe0, 0x01, 0xd7, 0x10, 0x3d, 0x70, 0x00,
+  0x19, 0xef, 0xd5, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x06, 0x90,
+  0x00, 0x00, 0x00, 0x3c, 0x12, 0x00, 0xa0, 0xd2, 0x00, 0x00, 0x00, 0x07, 0x70,
+  0x00, 0x00, 0x00, 0x0d, 0x0e, 0x00, 0x10, 0x5a, 0x05, 0x00, 0x14, 0xa5, 0x18,
+  0x00, 0x25, 0x00, 0xf0, 0x05, 0x00, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x09, 0xef, 0xa1, 0x00, 0x00,
+  0x9a, 0x10, 0x8a, 0x00, 0x00, 0xf1, 0x00, 0x0f, 0x00, 0x00, 0xe2, 0x00, 0x1f,
+  0x00, 0x00, 0x6e, 0x50, 0x7a, 0x00, 0x00, 0x0c, 0xee, 0xf1, 0x00, 0x03, 0xc3,
+  0x04, 0x9d, 0x30, 0x0d, 0x20, 0x00, 0x04, 0xd0, 0x0f, 0x10, 0x00, 0x00, 0xf0,
+  0x08, 0xc3, 0x00, 0x3b, 0x80, 0x00, 0x6c, 0xff, 0xc6, 0x45, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26, 0x3c, 0xff, 0xb3,
+  0x00, 0x03, 0xe4, 0x01, 0x7e, 0x20, 0x0c, 0x40, 0x00, 0x07, 0x90, 0x0f, 0x00,
+  0x00, 0x01, 0xd0, 0x0c, 0x30, 0x00, 0x01, 0xf0, 0x03, 0xc3, 0x00, 0x5e, 0xf0,
+  0x00, 0x3b, 0xff, 0xc5, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00,
+  0x05, 0xb0, 0x09, 0xa4, 0x00, 0x4e, 0x50, 0x01, 0x7c, 0xff, 0xd5, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0c, 0x3f, 0xff,
+  0x00, 0x00, 0x23, 0x00, 0x1f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x0c, 0x2f, 0xff, 0x10, 0x1e, 0x00, 0x09, 0x10, 0x08, 0x05, 0x00,
+  0xf0, 0x08, 0x8d, 0x00, 0x00, 0x00, 0x03, 0xf3, 0x00, 0x00, 0x00, 0x1e, 0x60,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x03, 0xf0, 0x04, 0x1a, 0x00, 0x00, 0x00, 0x05, 0xe8, 0x00,
+  0x00, 0x01, 0xad, 0x30, 0x00, 0x00, 0x5e, 0x80, 0x00, 0x00, 0x00, 0xf5, 0x17,
+  0x00, 0x33, 0x5e, 0x70, 0x00, 0x14, 0x00, 0x34, 0x00, 0x05, 0xe9, 0x28, 0x00,
+  0x0e, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x10, 0x3e, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x10, 0xa1, 0x05, 0x00,
+  0xd0, 0x8e, 0x50, 0x00, 0x00, 0x00, 0x03, 0xda, 0x10, 0x00, 0x00, 0x00, 0x09,
+  0xe5, 0x11, 0x00, 0x63, 0x6f, 0x00, 0x00, 0x00, 0x07, 0xe5, 0x14, 0x00, 0x24,
+  0x9e, 0x50, 0x28, 0x00, 0x1e, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x00, 0x01, 0x00, 0x80, 0x5d, 0xff, 0xa1, 0x00, 0x01, 0xe6, 0x01,
+  0x9b, 0x0c, 0x00, 0x10, 0x0f, 0x05, 0x00, 0xf0, 0x00, 0x4d, 0x00, 0x00, 0x00,
+  0x01, 0xe4, 0x00, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0xab, 0x13, 0x00,
+  0x10, 0xf2, 0x05, 0x00, 0x15, 0x50, 0x33, 0x00, 0x2c, 0xf0, 0x00, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf0, 0x3b, 0x09,
+  0xef, 0xd4, 0x00, 0x00, 0xbc, 0x30, 0x4f, 0x30, 0x04, 0xf1, 0x00, 0x08, 0xa0,
+  0x0a, 0x80, 0x00, 0x02, 0xe0, 0x0d, 0x40, 0x00, 0x00, 0xf0, 0x0f, 0x10, 0x3b,
+  0xef, 0xf0, 0x0f, 0x00, 0xe4, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x0d,
+  0x30, 0xc4, 0x1a, 0xf0, 0x0a, 0x80, 0x3e, 0xe7, 0xf0, 0x04, 0xf2, 0x00, 0x00,
+  0xf0, 0x00, 0x9e, 0x40, 0x00, 0x00, 0x00, 0x06, 0xdf, 0xff, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xfb,
+  0x26, 0xbb, 0x00, 0x00, 0x00, 0x01, 0xdd, 0x10, 0x00, 0x00, 0x05, 0x99, 0x50,
+  0x00, 0x00, 0x0a, 0x44, 0xa0, 0x00, 0x00, 0x0e, 0x00, 0xe0, 0x00, 0x00, 0x4b,
+  0x00, 0xc4, 0x00, 0x00, 0x9f, 0xff, 0xf9, 0x00, 0x00, 0xe3, 0x00, 0x1e, 0x00,
+  0x03, 0xe0, 0x00, 0x0c, 0x30, 0x08, 0x80, 0x00, 0x07, 0x80, 0x0d, 0x20, 0x00,
+  0x02, 0xd0, 0x44, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01,
+  0x00, 0xe0, 0x0f, 0xff, 0xfe, 0xa1, 0x00, 0x0f, 0x00, 0x01, 0x9b, 0x00, 0x0f,
+  0x00, 0x00, 0x0f, 0x05, 0x00, 0xb0, 0x1e, 0x00, 0x0f, 0x00, 0x03, 0xc8, 0x00,
+  0x0f, 0xff, 0xff, 0xf4, 0x0f, 0x00, 0xb0, 0x5d, 0x50, 0x0f, 0x00, 0x00, 0x02,
+  0xe0, 0x0f, 0x00, 0x00, 0x01, 0x05, 0x00, 0x7b, 0x3c, 0x80, 0x0f, 0xff, 0xff,
+  0xc6, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xf4, 0x0b, 0x06, 0xcf, 0xfc, 0x50, 0x00, 0x9d, 0x40, 0x17, 0x80, 0x04,
+  0xe1, 0x00, 0x00, 0x00, 0x0b, 0x60, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x0a, 0x00, 0x70, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x04, 0xd1,
+  0x10, 0x00, 0x9b, 0x9d, 0x40, 0x07, 0x90, 0x00, 0x06, 0xdf, 0xfb, 0x20, 0x45,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x0f,
+  0x0f, 0xff, 0xfd, 0x80, 0x00, 0x0f, 0x00, 0x02, 0xac, 0x00, 0x0f, 0x00, 0x00,
+  0x0b, 0x60, 0x0f, 0x00, 0x00, 0x04, 0xc0, 0x0f, 0x00, 0x00, 0x01, 0xf0, 0x0f,
+  0x00, 0x00, 0x00, 0xf0, 0x0a, 0x00, 0x50, 0xe0, 0x0f, 0x00, 0x00, 0x05, 0x14,
+  0x00, 0x60, 0x0c, 0x60, 0x0f, 0x00, 0x02, 0xab, 0x32, 0x00, 0x2b, 0x70, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x61,
+  0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x0a, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x19,
+  0x00, 0x0d, 0x14, 0x00, 0x05, 0x32, 0x00, 0x0b, 0x46, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x61, 0x0f, 0xff, 0xff, 0xff, 0xf0,
+  0x0f, 0x0a, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x19, 0x00, 0x0d, 0x14, 0x00, 0x05,
+  0x05, 0x00, 0x0b, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x01, 0x00, 0xf2, 0x0b, 0x07, 0xdf, 0xfc, 0x50, 0x00, 0xbc, 0x30, 0x18, 0x70,
+  0x06, 0xd0, 0x00, 0x00, 0x00, 0x0c, 0x50, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x20, 0xff, 0xf0, 0x14, 0x00, 0x10, 0xf0,
+  0x1e, 0x00, 0xbb, 0xf0, 0x00, 0xcc, 0x30, 0x07, 0xc0, 0x00, 0x08, 0xef, 0xfb,
+  0x10, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff,
+  0xf0, 0x1e, 0x00, 0x06, 0x0b, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x01, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x05, 0x00, 0x16, 0x02, 0x32, 0x00, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x40, 0xff, 0xff, 0xff, 0xf0, 0x08,
+  0x00, 0x0f, 0x05, 0x00, 0x0c, 0xec, 0x01, 0x20, 0x00, 0x05, 0xe0, 0x05, 0xe4,
+  0x01, 0x6f, 0x70, 0x00, 0x5d, 0xff, 0xc5, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0, 0x18, 0x0f, 0x00, 0x00, 0x7c, 0x00,
+  0x0f, 0x00, 0x05, 0xe1, 0x00, 0x0f, 0x00, 0x4e, 0x20, 0x00, 0x0f, 0x02, 0xe4,
+  0x00, 0x00, 0x0f, 0x2e, 0xf4, 0x00, 0x00, 0x0f, 0xd7, 0x7d, 0x00, 0x00, 0x0f,
+  0x90, 0x0d, 0x80, 0x00, 0x0f, 0x00, 0x03, 0xf2, 0x28, 0x00, 0x10, 0x9b, 0x05,
+  0x00, 0x40, 0x0e, 0x50, 0x0f, 0x00, 0x2e, 0x00, 0x0a, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x1f,
+  0x4b, 0xff, 0xff, 0xff, 0xf0, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x01, 0x00, 0xf8, 0x1c, 0x0f, 0xa0, 0x00, 0x0a, 0xf0, 0x0f, 0xc1,
+  0x00, 0x1d, 0xf0, 0x0f, 0x76, 0x00, 0x68, 0xf0, 0x0f, 0x2c, 0x00, 0xc2, 0xf0,
+  0x0f, 0x0c, 0x11, 0xd0, 0xf0, 0x0f, 0x07, 0x77, 0x70, 0xf0, 0x0f, 0x01, 0xdd,
+  0x20, 0xf0, 0x0f, 0x00, 0xcc, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x0b,
+  0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x70,
+  0x0f, 0x90, 0x00, 0x00, 0xf0, 0x0f, 0xd3, 0x05, 0x00, 0x10, 0x4d, 0x05, 0x00,
+  0xc0, 0x0b, 0x70, 0x00, 0xf0, 0x0f, 0x02, 0xe1, 0x00, 0xf0, 0x0f, 0x00, 0x8a,
+  0x05, 0x00, 0xc0, 0x0e, 0x40, 0xf0, 0x0f, 0x00, 0x05, 0xd0, 0xf0, 0x0f, 0x00,
+  0x00, 0xc8, 0x05, 0x00, 0x10, 0x3f, 0x05, 0x00, 0x2b, 0x09, 0xf0, 0x46, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xf6, 0x09, 0x3c,
+  0xff, 0xc3, 0x00, 0x02, 0xe5, 0x00, 0x5e, 0x20, 0x09, 0x70, 0x00, 0x07, 0x90,
+  0x0d, 0x20, 0x00, 0x02, 0xd0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x01,
+  0x14, 0x00, 0x01, 0x1e, 0x00, 0x01, 0x28, 0x00, 0x4c, 0x00, 0x2b, 0xff, 0xb2,
+  0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf4,
+  0x00, 0x0f, 0xff, 0xff, 0xd8, 0x00, 0x0f, 0x00, 0x00, 0x18, 0xa0, 0x0f, 0x00,
+  0x00, 0x00, 0xf0, 0x05, 0x00, 0x24, 0x18, 0x90, 0x19, 0x00, 0x1e, 0x00, 0x05,
+  0x00, 0x0e, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xf0, 0x0b, 0x1a, 0xff, 0xb2, 0x00, 0x00, 0xd8, 0x00, 0x7e, 0x10, 0x07,
+  0xa0, 0x00, 0x0a, 0x80, 0x0c, 0x40, 0x00, 0x03, 0xc0, 0x0f, 0x10, 0x00, 0x00,
+  0xf0, 0x0f, 0x00, 0x05, 0x00, 0x90, 0x10, 0x00, 0x01, 0xf0, 0x0c, 0x40, 0x00,
+  0x04, 0xc0, 0x1e, 0x00, 0x62, 0x70, 0x00, 0xd8, 0x00, 0x8e, 0x10, 0x32, 0x00,
+  0xf0, 0x04, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x00, 0x05, 0xd2, 0x00, 0x00, 0x00,
+  0x00, 0x7e, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf0,
+  0x05, 0x0f, 0xff, 0xff, 0xd7, 0x00, 0x0f, 0x00, 0x00, 0x2a, 0xa0, 0x0f, 0x00,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x01, 0xf0, 0x0f, 0x00, 0xf0, 0x00, 0xb0,
+  0x0f, 0xff, 0xff, 0xea, 0x10, 0x0f, 0x00, 0x0b, 0x70, 0x00, 0x0f, 0x00, 0x02,
+  0xe1, 0x23, 0x00, 0x10, 0x79, 0x05, 0x00, 0x7b, 0x0d, 0x20, 0x0f, 0x00, 0x00,
+  0x04, 0xb0, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01,
+  0x00, 0xb0, 0x1a, 0xff, 0xc4, 0x00, 0x00, 0xc9, 0x10, 0x3c, 0x30, 0x00, 0xf0,
+  0x0f, 0x00, 0x10, 0xc6, 0x05, 0x00, 0x20, 0x2d, 0xc4, 0x06, 0x00, 0x20, 0x5c,
+  0xd6, 0x06, 0x00, 0xfc, 0x06, 0x2b, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x02,
+  0x00, 0x00, 0x01, 0xe0, 0x08, 0xe6, 0x10, 0x2c, 0x80, 0x00, 0x3a, 0xef, 0xd7,
+  0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x9f,
+  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x1c, 0x09,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x5f,
+  0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x10, 0xeb, 0x0d, 0x40, 0x00, 0x03,
+  0xd0, 0x06, 0xe4, 0x00, 0x2d, 0x60, 0x00, 0x5c, 0xff, 0xc5, 0x45, 0x00, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xfc, 0x27, 0x0d,
+  0x20, 0x00, 0x02, 0xd0, 0x08, 0x70, 0x00, 0x07, 0x80, 0x04, 0xc0, 0x00, 0x0c,
+  0x40, 0x00, 0xe1, 0x00, 0x1e, 0x00, 0x00, 0xa5, 0x00, 0x5a, 0x00, 0x00, 0x5a,
+  0x00, 0xa5, 0x00, 0x00, 0x1e, 0x00, 0xe1, 0x00, 0x00, 0x0c, 0x44, 0xc0, 0x00,
+  0x00, 0x07, 0x88, 0x70, 0x00, 0x00, 0x02, 0xdd, 0x20, 0x00, 0x00, 0x00, 0xdd,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00,
+  0xfb, 0x28, 0xc0, 0x00, 0x00, 0x00, 0x0d, 0xb2, 0x00, 0x00, 0x00, 0x2c, 0x94,
+  0x00, 0x00, 0x00, 0x4b, 0x85, 0x00, 0xdd, 0x00, 0x59, 0x77, 0x03, 0xdd, 0x30,
+  0x78, 0x68, 0x08, 0x77, 0x80, 0x87, 0x5a, 0x0d, 0x11, 0xd0, 0xa5, 0x4c, 0x2c,
+  0x00, 0xc2, 0xc4, 0x2d, 0x86, 0x00, 0x68, 0xd3, 0x1f, 0xc1, 0x00, 0x1c, 0xf2,
+  0x0f, 0xa0, 0x00, 0x0a, 0xf0, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x01, 0x00, 0xfb, 0x28, 0x0a, 0x80, 0x00, 0x08, 0xa0, 0x01, 0xe2,
+  0x00, 0x3e, 0x10, 0x00, 0x6b, 0x00, 0xc6, 0x00, 0x00, 0x0b, 0x56, 0xb0, 0x00,
+  0x00, 0x02, 0xee, 0x20, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x05, 0xdd,
+  0x50, 0x00, 0x00, 0x0d, 0x43, 0xd0, 0x00, 0x00, 0x8a, 0x00, 0xa8, 0x00, 0x02,
+  0xe2, 0x00, 0x1e, 0x20, 0x0b, 0x80, 0x00, 0x06, 0xb0, 0x46, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfe, 0x17, 0xc3, 0x00, 0x03,
+  0xd0, 0x00, 0x5a, 0x00, 0x0a, 0x60, 0x00, 0x0e, 0x20, 0x2e, 0x00, 0x00, 0x08,
+  0x80, 0x88, 0x00, 0x00, 0x01, 0xe1, 0xe1, 0x00, 0x00, 0x00, 0xad, 0xa0, 0x00,
+  0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x05, 0x00, 0x09, 0x01,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf7, 0x20,
+  0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x05, 0xf3, 0x00, 0x00, 0x00, 0x1e, 0x70, 0x00, 0x00,
+  0x00, 0xbb, 0x00, 0x00, 0x00, 0x07, 0xe1, 0x00, 0x00, 0x00, 0x3f, 0x50, 0x00,
+  0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0xd0, 0x32, 0x00, 0x08, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x8f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x05, 0x00, 0x2b, 0x80, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x10, 0xe1, 0x05, 0x00,
+  0x10, 0x96, 0x05, 0x00, 0x10, 0x3c, 0x05, 0x00, 0xc5, 0x0e, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0x60, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x1f, 0x00, 0x15, 0x87, 0x1f,
+  0x00, 0x70, 0x0d, 0x20, 0x00, 0x00, 0x00, 0x08, 0x70, 0x1f, 0x00, 0x10, 0xd0,
+  0x10, 0x00, 0x15, 0xd2, 0x1f, 0x00, 0x70, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x01, 0x00, 0x30, 0x1f, 0xff, 0xff, 0x07, 0x00, 0x1f, 0x0f,
+  0x05, 0x00, 0x2b, 0xa0, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0x00, 0x01, 0x00, 0xff, 0x0d, 0xee, 0x00, 0x00, 0x00, 0x04, 0xbb,
+  0x40, 0x00, 0x00, 0x0a, 0x55, 0xa0, 0x00, 0x00, 0x1e, 0x00, 0xe1, 0x00, 0x00,
+  0x69, 0x00, 0x96, 0x00, 0x00, 0xd3, 0x00, 0x3d, 0x00, 0x01, 0x00, 0x15, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x37, 0xf0, 0x00, 0x0f,
+  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x00, 0x01, 0x00, 0x10, 0x04, 0x05, 0x00, 0x20, 0x2f, 0x70, 0x0a,
+  0x00, 0x10, 0xf5, 0x0b, 0x00, 0x24, 0x7f, 0x20, 0x15, 0x00, 0x0f, 0x01, 0x00,
+  0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xfb,
+  0x18, 0x3a, 0xff, 0xc4, 0x00, 0x01, 0xd4, 0x00, 0x5e, 0x60, 0x00, 0x00, 0x00,
+  0x02, 0xe0, 0x00, 0x4a, 0xce, 0xff, 0xf0, 0x08, 0xa2, 0x00, 0x00, 0xf0, 0x0f,
+  0x10, 0x00, 0x00, 0xf0, 0x0d, 0x61, 0x01, 0x5c, 0xf0, 0x01, 0x9e, 0xfe, 0xb4,
+  0xf0, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00,
+  0x1f, 0x0f, 0x05, 0x00, 0x01, 0xe0, 0x6d, 0xff, 0xb3, 0x00, 0x0f, 0xd4, 0x00,
+  0x6e, 0x30, 0x0f, 0x10, 0x00, 0x05, 0xc0, 0x14, 0x00, 0x12, 0xf0, 0x05, 0x00,
+  0x01, 0x0f, 0x00, 0x9b, 0xd4, 0x00, 0x5f, 0x50, 0x0f, 0x5b, 0xef, 0xd5, 0x00,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b,
+  0xf0, 0x00, 0x3b, 0xff, 0xb3, 0x00, 0x03, 0xd4, 0x00, 0x5e, 0x30, 0x0b, 0x40,
+  0x00, 0x01, 0x10, 0x0f, 0x13, 0x00, 0x01, 0x05, 0x00, 0xec, 0x0c, 0x60, 0x00,
+  0x01, 0x10, 0x03, 0xe6, 0x00, 0x5e, 0x40, 0x00, 0x3c, 0xff, 0xb3, 0x36, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x01, 0x00, 0x1c, 0xf0, 0x05,
+  0x00, 0xf0, 0x00, 0x3b, 0xff, 0xd6, 0xf0, 0x03, 0xe6, 0x00, 0x4d, 0xf0, 0x0b,
+  0x60, 0x00, 0x01, 0xf0, 0x0f, 0x14, 0x00, 0x01, 0x05, 0x00, 0xe1, 0x0c, 0x50,
+  0x00, 0x01, 0xf0, 0x04, 0xf5, 0x00, 0x4d, 0xf0, 0x00, 0x5d, 0xff, 0xc5, 0x2d,
+  0x00, 0x07, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x0b, 0xf0, 0x05, 0x2a, 0xef, 0xd6, 0x00, 0x02, 0xd5, 0x00, 0x3d, 0x70,
+  0x0b, 0x40, 0x00, 0x03, 0xd0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x18, 0x00,
+  0xfb, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x10, 0x02, 0xe6, 0x10, 0x28, 0xf1, 0x00,
+  0x2a, 0xef, 0xe9, 0x30, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x01, 0x00, 0xc3, 0x09, 0xef, 0xf0, 0x00, 0x00, 0xaa, 0x10, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x05, 0x00, 0x47, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0x0f,
+  0x05, 0x00, 0x07, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0b, 0xf2, 0x03, 0x2b, 0xff, 0xd7, 0xf0, 0x02, 0xe6, 0x00,
+  0x4d, 0xf0, 0x0b, 0x60, 0x00, 0x01, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x01, 0x0f, 0x00, 0xf0, 0x0f, 0x02, 0xe5, 0x00, 0x4c, 0xf0, 0x00, 0x2b, 0xff,
+  0xd6, 0xf0, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x03, 0x8f, 0x50, 0x00,
+  0xff, 0xed, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00,
+  0x2e, 0xf0, 0x00, 0x05, 0x00, 0x90, 0xf9, 0xef, 0xfb, 0x20, 0x00, 0xf9, 0x10,
+  0x08, 0xb0, 0x0f, 0x00, 0x1f, 0xf0, 0x05, 0x00, 0x07, 0x0a, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x19, 0x0f, 0x0d, 0x00,
+  0x25, 0xff, 0xff, 0x14, 0x00, 0x0f, 0x05, 0x00, 0x07, 0x2b, 0xff, 0xf0, 0x44,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x18, 0x1e,
+  0x0d, 0x00, 0x30, 0xff, 0xff, 0xff, 0x07, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x14,
+  0xc0, 0x2e, 0x00, 0x00, 0x00, 0x05, 0xe6, 0x00, 0x0f, 0xff, 0xfb, 0x40, 0x00,
+  0x15, 0x00, 0x01, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x03, 0xf0, 0x11, 0x0b, 0xb0,
+  0x0f, 0x00, 0x01, 0xda, 0x00, 0x0f, 0x00, 0x3e, 0x80, 0x00, 0x0f, 0x04, 0xff,
+  0x40, 0x00, 0x0f, 0x6f, 0x56, 0xe2, 0x00, 0x0f, 0xd2, 0x00, 0x8d, 0x10, 0x0f,
+  0x00, 0x00, 0x09, 0xb0, 0x28, 0x00, 0x2a, 0xb9, 0x00, 0x01, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x30, 0x0f, 0xff, 0xf0, 0x07,
+  0x00, 0x0f, 0x05, 0x00, 0x15, 0x10, 0xf1, 0x05, 0x00, 0x10, 0xa9, 0x05, 0x00,
+  0x12, 0x1a, 0x39, 0x00, 0x07, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x0a, 0xff, 0x00, 0x0f, 0x8f, 0xe8, 0xee, 0x50, 0x0f,
+  0x80, 0x2f, 0x32, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x05, 0x00, 0x06, 0x0b,
+  0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a,
+  0xff, 0x04, 0x0f, 0x1b, 0xff, 0xd7, 0x00, 0x0f, 0xd6, 0x00, 0x3b, 0x90, 0x0f,
+  0x40, 0x00, 0x01, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x0b, 0x37,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xf1,
+  0x04, 0x3b, 0xff, 0xb3, 0x00, 0x03, 0xd4, 0x00, 0x5e, 0x30, 0x0b, 0x40, 0x00,
+  0x05, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0xec, 0x0c, 0x60, 0x00,
+  0x05, 0xc0, 0x03, 0xe6, 0x00, 0x5e, 0x30, 0x00, 0x3c, 0xff, 0xb3, 0x36, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf2, 0x05,
+  0x0f, 0x6c, 0xff, 0xd6, 0x00, 0x0f, 0xd4, 0x00, 0x5e, 0x50, 0x0f, 0x10, 0x00,
+  0x05, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0xe0, 0x10, 0x00, 0x06,
+  0xb0, 0x0f, 0xd5, 0x00, 0x6f, 0x30, 0x0f, 0x4b, 0xef, 0xc3, 0x00, 0x14, 0x00,
+  0x07, 0x05, 0x00, 0x50, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x0b, 0xf2, 0x03, 0x4c, 0xff, 0xd8, 0xf0, 0x04, 0xf5, 0x00, 0x4d, 0xf0, 0x0c,
+  0x60, 0x00, 0x01, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x0b, 0x0f,
+  0x00, 0xa0, 0x03, 0xe6, 0x00, 0x4d, 0xf0, 0x00, 0x3b, 0xff, 0xd6, 0xf0, 0x2b,
+  0x00, 0x07, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x01,
+  0x00, 0x0b, 0xf0, 0x01, 0xf1, 0xae, 0xfd, 0x70, 0x00, 0xfe, 0x60, 0x04, 0xf0,
+  0x00, 0xf7, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x14, 0x00, 0x0e, 0x05, 0x00, 0x0c,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b,
+  0xb0, 0x2a, 0xef, 0xea, 0x00, 0x00, 0xe5, 0x00, 0x27, 0x00, 0x00, 0xd3, 0x0f,
+  0x00, 0xfb, 0x09, 0x2c, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x15, 0x9d, 0x50, 0x00,
+  0x00, 0x00, 0x02, 0xe0, 0x02, 0xd5, 0x10, 0x04, 0xd0, 0x00, 0x5b, 0xef, 0xfb,
+  0x20, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00,
+  0x19, 0x0f, 0x05, 0x00, 0x5b, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x14, 0x00, 0x08,
+  0x05, 0x00, 0x8b, 0x40, 0x00, 0x00, 0x00, 0x05, 0xdf, 0xff, 0xf0, 0x45, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0x5f, 0x0f,
+  0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x01, 0xfb, 0x00, 0x0d, 0x40, 0x00, 0x02,
+  0xf0, 0x04, 0xf6, 0x10, 0x5d, 0xf0, 0x00, 0x4c, 0xff, 0xc3, 0xf0, 0x37, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfd, 0x17,
+  0x0c, 0x30, 0x00, 0x03, 0xc0, 0x05, 0xa0, 0x00, 0x0a, 0x50, 0x00, 0xe1, 0x00,
+  0x1e, 0x00, 0x00, 0x88, 0x00, 0x78, 0x00, 0x00, 0x1e, 0x00, 0xe1, 0x00, 0x00,
+  0x0a, 0x55, 0xa0, 0x00, 0x00, 0x03, 0xcc, 0x30, 0x00, 0x00, 0x00, 0xcc, 0x37,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfc,
+  0x18, 0x0e, 0x10, 0x00, 0x01, 0xe0, 0x0c, 0x30, 0x00, 0x03, 0xc0, 0x09, 0x50,
+  0x00, 0x05, 0x90, 0x06, 0x80, 0x66, 0x08, 0x60, 0x04, 0xa1, 0xee, 0x1a, 0x40,
+  0x01, 0xc6, 0x78, 0x6c, 0x10, 0x00, 0xec, 0x11, 0xce, 0x00, 0x00, 0xc8, 0x00,
+  0xac, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x0a, 0xf3, 0x04, 0x09, 0xa0, 0x00, 0x0a, 0x90, 0x00, 0xb7, 0x00, 0x7b, 0x00,
+  0x00, 0x0c, 0x44, 0xc0, 0x00, 0x00, 0x01, 0xdd, 0x10, 0x05, 0x00, 0x40, 0x0d,
+  0x44, 0xd0, 0x00, 0x19, 0x00, 0x00, 0x23, 0x00, 0x2b, 0x0b, 0x90, 0x37, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf0, 0x2d,
+  0x0c, 0x40, 0x00, 0x03, 0xd0, 0x04, 0xb0, 0x00, 0x09, 0x70, 0x00, 0xc3, 0x00,
+  0x0e, 0x10, 0x00, 0x4b, 0x00, 0x6b, 0x00, 0x00, 0x0b, 0x30, 0xc5, 0x00, 0x00,
+  0x04, 0xb2, 0xe0, 0x00, 0x00, 0x00, 0xcc, 0x90, 0x00, 0x00, 0x00, 0x4f, 0x30,
+  0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x01, 0xe3, 0x00, 0x00, 0x00, 0x2d,
+  0x80, 0x00, 0x00, 0x0c, 0xe8, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a,
+  0xf7, 0x11, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x1d, 0x70, 0x00,
+  0x00, 0x02, 0xe6, 0x00, 0x00, 0x00, 0x3e, 0x50, 0x00, 0x00, 0x04, 0xe4, 0x00,
+  0x00, 0x00, 0x5e, 0x30, 0x00, 0x00, 0x07, 0xe2, 0x23, 0x00, 0x08, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x60, 0x5d, 0xff,
+  0xf0, 0x00, 0x00, 0xe6, 0x0a, 0x00, 0x1e, 0xf0, 0x05, 0x00, 0xcf, 0x03, 0xd0,
+  0x00, 0x00, 0x00, 0xff, 0x60, 0x00, 0x00, 0x00, 0x02, 0xc0, 0x23, 0x00, 0x04,
+  0xe0, 0x00, 0xd8, 0x10, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x1f, 0x0f, 0x05, 0x00, 0x35, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x30, 0x0f, 0xff, 0xc4, 0x07,
+  0x00, 0x11, 0x7e, 0x0c, 0x00, 0x1e, 0x00, 0x05, 0x00, 0xcf, 0x0c, 0x20, 0x00,
+  0x00, 0x00, 0x05, 0xff, 0x00, 0x00, 0x00, 0x0d, 0x30, 0x23, 0x00, 0x04, 0x10,
+  0x6e, 0x46, 0x00, 0x80, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x00, 0x01, 0x00, 0x0f, 0xff, 0x00, 0x01, 0xbf, 0xb0, 0x05, 0xf0, 0x0a, 0xb0,
+  0xbb, 0x1c, 0xb0, 0x0f, 0x50, 0x1c, 0xfc, 0x20, 0x32, 0x00, 0x10, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x20, 0x5d, 0xf8, 0x06, 0x00,
+  0xff, 0x02, 0x2f, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x00, 0x00, 0x00, 0xe3, 0x0f,
+  0x00, 0x00, 0x00, 0xaf, 0xbf, 0x00, 0x01, 0x00, 0x20, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xff, 0x03, 0x6e, 0xe6, 0x00, 0x00, 0x00,
+  0xe3, 0x2e, 0x00, 0x00, 0x00, 0xf2, 0x2f, 0x00, 0x00, 0x00, 0x7f, 0xf7, 0x00,
+  0x01, 0x00, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x07, 0x19, 0x0f, 0x05, 0x00, 0x4c, 0xff, 0xff, 0xff, 0xf0, 0x14, 0x00, 0x25,
+  0x00, 0x00, 0x19, 0x00, 0x09, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x16, 0x1f, 0x0f, 0x2b, 0x00, 0x17, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x01, 0x3d, 0xfd, 0x40, 0x00,
+  0x00, 0xd6, 0x05, 0xd0, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xd5, 0x0a,
+  0x00, 0x10, 0x4d, 0x14, 0x00, 0x0f, 0x01, 0x00, 0x1e, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0xfb, 0x26, 0xef, 0xff, 0xf0, 0x00, 0x04,
+  0xcf, 0x00, 0x00, 0x00, 0x0a, 0x6f, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00,
+  0x00, 0x7a, 0x0f, 0x00, 0x00, 0x00, 0xd4, 0x0f, 0xff, 0xf0, 0x03, 0xe0, 0x0f,
+  0x00, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x00, 0x1f, 0x10, 0x0f, 0x00, 0x00, 0x6a,
+  0x00, 0x0f, 0x00, 0x00, 0xc3, 0x00, 0x0f, 0xff, 0xf0, 0x44, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xe0, 0xff, 0xff, 0xc6, 0x00,
+  0x00, 0xf0, 0x00, 0x4c, 0xa0, 0x00, 0xf0, 0x00, 0x00, 0xc5, 0x05, 0x00, 0x10,
+  0x5b, 0x05, 0x00, 0x60, 0x1f, 0x3e, 0xff, 0xfb, 0x00, 0x0f, 0x0a, 0x00, 0x15,
+  0x1e, 0x14, 0x00, 0x12, 0xd5, 0x28, 0x00, 0x01, 0x32, 0x00, 0x0a, 0x01, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xff, 0x0d,
+  0x88, 0x00, 0x88, 0x00, 0x00, 0x1d, 0x88, 0xd1, 0x00, 0x00, 0x01, 0xee, 0x10,
+  0x00, 0x00, 0x08, 0xdd, 0x80, 0x00, 0x00, 0x7d, 0x11, 0xd7, 0x00, 0x00, 0x21,
+  0x00, 0x12, 0x36, 0x00, 0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x01, 0x00, 0xf0, 0x0e, 0x10, 0x00, 0x3c, 0xff, 0xc5, 0x70, 0x02, 0xe5, 0x00,
+  0x5f, 0x30, 0x09, 0x70, 0x00, 0x4a, 0xa0, 0x0d, 0x20, 0x01, 0x72, 0xd0, 0x0f,
+  0x00, 0x07, 0x00, 0xf0, 0x0f, 0x00, 0x43, 0x05, 0x00, 0xfa, 0x09, 0x60, 0x00,
+  0xf0, 0x0d, 0x37, 0x00, 0x02, 0xd0, 0x09, 0xb3, 0x00, 0x07, 0x90, 0x03, 0xf5,
+  0x00, 0x5e, 0x20, 0x06, 0x4c, 0xff, 0xb2, 0x00, 0x01, 0x47, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x15, 0xf0, 0x05, 0x00, 0xe4,
+  0xff, 0xff, 0xe9, 0x10, 0x00, 0xf0, 0x00, 0x2a, 0xb0, 0x00, 0xf0, 0x00, 0x01,
+  0xf0, 0x05, 0x00, 0x68, 0x3b, 0x90, 0x00, 0xff, 0xff, 0xd8, 0x28, 0x00, 0x2d,
+  0xf0, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xf0, 0x12, 0x3d, 0xff, 0x70, 0x00, 0x00, 0xc5, 0x03, 0xe0, 0x00, 0x00,
+  0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x04, 0x90, 0x00, 0x00, 0xf0, 0x0c, 0x40,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0d, 0x40, 0x14, 0x00, 0x10,
+  0xe6, 0x1e, 0x00, 0x41, 0x29, 0xa0, 0x00, 0xf0, 0x26, 0x00, 0x9a, 0xe7, 0x01,
+  0xf0, 0x00, 0xf0, 0x3a, 0xff, 0x80, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xfb, 0x19, 0x2b, 0xfe, 0x65, 0xdf,
+  0xc2, 0x14, 0x01, 0xcf, 0x80, 0x8a, 0x00, 0x00, 0x3f, 0x20, 0x1e, 0x04, 0xae,
+  0xff, 0xff, 0xff, 0x7c, 0x41, 0x0f, 0x00, 0x00, 0xf1, 0x00, 0x0f, 0x10, 0x00,
+  0xd2, 0x01, 0x9f, 0x80, 0x02, 0x2c, 0xfe, 0x62, 0x9f, 0xe7, 0x37, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0xf0, 0x03, 0x03, 0x30,
+  0x01, 0x10, 0x00, 0x00, 0x57, 0x67, 0x00, 0x00, 0x00, 0x46, 0x80, 0x00, 0x00,
+  0x03, 0x10, 0x48, 0x16, 0x00, 0xfb, 0x1b, 0x0b, 0x20, 0x00, 0x4c, 0xfe, 0x76,
+  0x80, 0x04, 0xe5, 0x00, 0x59, 0xc0, 0x0c, 0x50, 0x00, 0x02, 0xf0, 0x0f, 0x00,
+  0x00, 0x00, 0xf0, 0x0f, 0x10, 0x00, 0x01, 0xe0, 0x0b, 0x60, 0x00, 0x07, 0xa0,
+  0x02, 0xe6, 0x00, 0x5e, 0x20, 0x00, 0x2b, 0xff, 0xb3, 0x00, 0x01, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x07, 0x15, 0xff, 0x05,
+  0x00, 0x06, 0x13, 0x00, 0x2f, 0xff, 0xff, 0x23, 0x00, 0x0d, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xfc,
+  0x17, 0x4c, 0xfe, 0x62, 0x90, 0x04, 0xf5, 0x00, 0x6c, 0x00, 0x0c, 0x60, 0x00,
+  0x76, 0x70, 0x0f, 0x00, 0x07, 0x00, 0xe0, 0x0e, 0x00, 0x80, 0x00, 0xf0, 0x06,
+  0x68, 0x00, 0x05, 0xc0, 0x00, 0xc6, 0x00, 0x5f, 0x40, 0x09, 0x26, 0xef, 0xc4,
+  0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x1f,
+  0xf0, 0x05, 0x00, 0x01, 0xd0, 0x8f, 0xe8, 0x00, 0x00, 0xf8, 0x40, 0x2d, 0x70,
+  0x00, 0xf0, 0x00, 0x03, 0xd0, 0x14, 0x00, 0x14, 0xf0, 0x05, 0x00, 0xbc, 0x05,
+  0xb0, 0x00, 0xf8, 0x20, 0x4e, 0x40, 0x00, 0xf1, 0xbf, 0xd4, 0x37, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0x00, 0x10, 0x04, 0x05, 0x00,
+  0x20, 0x2f, 0x70, 0x0a, 0x00, 0x10, 0xf5, 0x0b, 0x00, 0x24, 0x7f, 0x20, 0x15,
+  0x00, 0x0f, 0x01, 0x00, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x01, 0x00, 0xf0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xf3, 0x00, 0x00, 0x00,
+  0x5f, 0x50, 0x00, 0x00, 0x01, 0xf7, 0x13, 0x00, 0x2f, 0x20, 0x00, 0x01, 0x00,
+  0x25, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0xff, 0x04,
+  0x02, 0xee, 0x20, 0x00, 0x00, 0x2e, 0x87, 0xe3, 0x00, 0x00, 0xd8, 0x00, 0x7f,
+  0x10, 0x00, 0x20, 0x00, 0x02, 0x00, 0x01, 0x00, 0x24, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x01, 0x00, 0x9f, 0x3d, 0xe3, 0x1e, 0x00, 0x00, 0xd4,
+  0x2d, 0xe6, 0x00, 0x01, 0x00, 0x2e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0x01, 0x00, 0x6f, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x00, 0x2d,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x4f, 0x0f, 0x00,
+  0xf0, 0x00, 0x01, 0x00, 0x2e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x01, 0x00, 0x74, 0x8f, 0x80, 0x00, 0x00, 0x00, 0xf3, 0xf0, 0x0a, 0x00, 0x0f,
+  0x01, 0x00, 0x27, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x34, 0x10, 0xf0, 0x05, 0x00, 0x10, 0xfb, 0x05, 0x00, 0x80, 0x1f, 0x00, 0x00,
+  0x00, 0x0f, 0xd5, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x03, 0xff, 0x18, 0x4f,
+  0x20, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x00, 0x00, 0x00,
+  0x0e, 0x70, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xf5, 0x00, 0x00,
+  0x00, 0x0a, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x00, 0x00, 0x00, 0xca, 0x3e,
+  0x00, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x60,
+  0xff, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x0a, 0x00, 0x0f, 0x05, 0x00, 0x1a, 0x0a,
+  0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfb,
+  0x27, 0x01, 0xff, 0x20, 0x00, 0x00, 0x05, 0xdd, 0x70, 0x00, 0x00, 0x0a, 0x88,
+  0xc0, 0x00, 0x00, 0x0f, 0x22, 0xf1, 0x00, 0x00, 0x4d, 0x00, 0xd5, 0x00, 0x00,
+  0x98, 0x00, 0x8a, 0x00, 0x00, 0xe2, 0x00, 0x2f, 0x00, 0x03, 0xd0, 0x00, 0x0d,
+  0x40, 0x08, 0x80, 0x00, 0x08, 0x90, 0x0d, 0x20, 0x00, 0x02, 0xd0, 0x0f, 0xff,
+  0xff, 0xff, 0xf0, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0x00, 0x70, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x09, 0xb0, 0x0b, 0x00, 0x10,
+  0xb8, 0x05, 0x00, 0x70, 0x1d, 0x60, 0x00, 0x00, 0x00, 0x02, 0xe4, 0x0b, 0x00,
+  0x50, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x10, 0x0d, 0x14, 0x00, 0x32,
+  0xb9, 0x00, 0x00, 0x28, 0x00, 0x00, 0x32, 0x00, 0x1b, 0xf0, 0x46, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfb, 0x27, 0x2b, 0xff,
+  0xb2, 0x00, 0x01, 0xd5, 0x00, 0x6d, 0x00, 0x0a, 0x60, 0x00, 0x09, 0x70, 0x0f,
+  0x10, 0x00, 0x04, 0xc0, 0x1f, 0x00, 0x00, 0x02, 0xe0, 0x1f, 0x00, 0x00, 0x01,
+  0xe0, 0x0e, 0x10, 0x00, 0x03, 0xb0, 0x09, 0x60, 0x00, 0x08, 0x50, 0x01, 0xe1,
+  0x00, 0x2d, 0x00, 0x00, 0x79, 0x00, 0xb4, 0x00, 0x0f, 0xff, 0x01, 0xff, 0xd0,
+  0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b,
+  0xfb, 0x18, 0x1a, 0xff, 0x90, 0xf3, 0x01, 0xd4, 0x02, 0xba, 0xd0, 0x0a, 0x50,
+  0x00, 0x2f, 0x60, 0x0e, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x0e, 0x00,
+  0x0d, 0x20, 0x00, 0x1f, 0x10, 0x06, 0xb2, 0x00, 0x9d, 0x90, 0x00, 0x7d, 0xfe,
+  0x75, 0xf8, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0xf0, 0x30, 0x1a, 0xff, 0xa0, 0x00, 0x00, 0x9a, 0x22, 0x9a, 0x00, 0x00,
+  0xe1, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0x03, 0xb8,
+  0x00, 0x00, 0xf0, 0xef, 0x90, 0x00, 0x00, 0xf0, 0x35, 0xdc, 0x10, 0x00, 0xf0,
+  0x00, 0x0c, 0xa0, 0x00, 0xf0, 0x00, 0x04, 0xf0, 0x00, 0xf0, 0x00, 0x01, 0xf0,
+  0x00, 0xf2, 0x00, 0x02, 0xd0, 0x00, 0xff, 0x61, 0x2b, 0x80, 0x00, 0xf6, 0xff,
+  0xfb, 0x2d, 0x00, 0xc0, 0x10, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xf7, 0x1d, 0x0c, 0x70, 0x00,
+  0x01, 0xf0, 0x01, 0xe3, 0x00, 0x05, 0xd0, 0x00, 0x7c, 0x00, 0x09, 0x90, 0x00,
+  0x0d, 0x40, 0x0d, 0x50, 0x00, 0x04, 0xb0, 0x2f, 0x00, 0x00, 0x00, 0xc1, 0x98,
+  0x00, 0x00, 0x00, 0x58, 0xe1, 0x00, 0x00, 0x00, 0x1f, 0x50, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x01,
+  0x00, 0x60, 0x6d, 0xff, 0xff, 0xe0, 0x01, 0xf2, 0x0a, 0x00, 0x10, 0xe2, 0x05,
+  0x00, 0xfb, 0x1d, 0x2b, 0x60, 0x00, 0x00, 0x00, 0x03, 0xbb, 0x81, 0x00, 0x00,
+  0xa9, 0x10, 0x8f, 0x30, 0x09, 0x80, 0x00, 0x09, 0xb0, 0x0f, 0x10, 0x00, 0x03,
+  0xe0, 0x1f, 0x00, 0x00, 0x01, 0xe0, 0x0e, 0x30, 0x00, 0x04, 0xc0, 0x04, 0xe6,
+  0x11, 0x4d, 0x50, 0x00, 0x3b, 0xff, 0xc4, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xb0, 0x4c, 0xff, 0xd8, 0x00,
+  0x00, 0xe9, 0x11, 0x36, 0x00, 0x00, 0xe2, 0x0f, 0x00, 0x60, 0x7f, 0xed, 0xa0,
+  0x00, 0x00, 0xc6, 0x0a, 0x00, 0x10, 0xf0, 0x05, 0x00, 0x9b, 0xd9, 0x10, 0x06,
+  0x40, 0x00, 0x2c, 0xff, 0xeb, 0x20, 0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x00, 0x01, 0x00, 0xf0, 0x06, 0x0f, 0xff, 0xff, 0xd0, 0x00, 0x00,
+  0x00, 0x6e, 0x40, 0x00, 0x00, 0x05, 0xa1, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00,
+  0x00, 0x05, 0x12, 0x00, 0x60, 0x2e, 0x20, 0x00, 0x00, 0x00, 0xa6, 0x23, 0x00,
+  0x60, 0xf1, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x0a, 0x00, 0x10, 0xf2, 0x05, 0x00,
+  0x80, 0x6c, 0x30, 0x00, 0x00, 0x00, 0x03, 0xcd, 0x92, 0x0c, 0x00, 0xf0, 0x02,
+  0x4a, 0x90, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xf0, 0x04, 0xf3, 0xcf,
+  0xfc, 0x20, 0x00, 0xfc, 0x30, 0x07, 0xb0, 0x00, 0xf1, 0x00, 0x01, 0xe0, 0x00,
+  0xf0, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x1c, 0xe0, 0x05, 0x00, 0x19, 0x00, 0x05,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x01, 0x00, 0xfc, 0x26,
+  0x4c, 0xff, 0xc3, 0x00, 0x05, 0xf8, 0x22, 0xaf, 0x20, 0x0d, 0xa0, 0x00, 0x0c,
+  0xa0, 0x1f, 0x30, 0x00, 0x06, 0xe0, 0x3f, 0x10, 0x00, 0x04, 0xf0, 0x3f, 0xee,
+  0xee, 0xef, 0xf0, 0x2f, 0x21, 0x11, 0x15, 0xf0, 0x0f, 0x20, 0x00, 0x05, 0xd0,
+  0x0c, 0x70, 0x00, 0x0a, 0x90, 0x04, 0xf8, 0x34, 0x9f, 0x20, 0x00, 0x5c, 0xff,
+  0xc3, 0x45, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x00,
+  0x80, 0x0c, 0xfc, 0x20, 0x00, 0x00, 0x01, 0x06, 0xd0, 0x0c, 0x00, 0x10, 0xb5,
+  0x05, 0x00, 0x10, 0x5b, 0x05, 0x00, 0x10, 0x9f, 0x15, 0x00, 0xf2, 0x10, 0xf9,
+  0x80, 0x00, 0x00, 0x08, 0xa2, 0xe0, 0x00, 0x00, 0x0e, 0x30, 0xc4, 0x00, 0x00,
+  0x6c, 0x00, 0x7a, 0x00, 0x00, 0xd5, 0x00, 0x1f, 0x10, 0x05, 0xe0, 0x00, 0x0b,
+  0x60, 0x0c, 0x80, 0x00, 0x34, 0x00, 0x07, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0x10, 0x0f, 0x03, 0x00, 0x0f, 0x05,
+  0x00, 0x02, 0xf3, 0x00, 0x30, 0x00, 0x4f, 0x20, 0x0f, 0xd4, 0x14, 0xdd, 0x70,
+  0x0f, 0x6d, 0xfd, 0x34, 0xe2, 0x0f, 0x2d, 0x00, 0x03, 0x05, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xaf, 0x0f, 0xff, 0xff,
+  0xff, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x05, 0x00, 0x0a, 0x1b, 0xf0, 0x37,
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xf2,
+  0x04, 0x08, 0xef, 0xd7, 0x00, 0x00, 0x8b, 0x10, 0x1a, 0x60, 0x00, 0xe2, 0x00,
+  0x01, 0xd0, 0x00, 0xf0, 0x00, 0x00, 0xe0, 0x05, 0x00, 0xe0, 0xf2, 0x00, 0x04,
+  0xb0, 0x00, 0xf9, 0x10, 0x3e, 0x40, 0x00, 0xf8, 0xdf, 0xc4, 0x00, 0x14, 0x00,
+  0x07, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00,
+  0x0b, 0xf1, 0x04, 0x5c, 0xff, 0xff, 0xfe, 0x06, 0xd3, 0x00, 0x4c, 0x20, 0x0d,
+  0x30, 0x00, 0x04, 0xb0, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x05, 0x00, 0xec, 0x0c,
+  0x40, 0x00, 0x04, 0xb0, 0x05, 0xd4, 0x00, 0x4e, 0x40, 0x00, 0x5c, 0xff, 0xc4,
+  0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a,
+  0xf0, 0x2d, 0x07, 0xfe, 0x00, 0x09, 0x90, 0x0c, 0x3b, 0x40, 0x4e, 0x00, 0x01,
+  0x05, 0x90, 0xd4, 0x00, 0x00, 0x01, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0xbe, 0x10,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x02, 0xde, 0x00, 0x00, 0x00, 0x0a,
+  0x6c, 0x20, 0x00, 0x00, 0x2f, 0x08, 0x70, 0x00, 0x00, 0x99, 0x02, 0xe4, 0xb0,
+  0x01, 0xf3, 0x00, 0x7f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01,
+  0x00, 0x0a, 0xfb, 0x19, 0x02, 0xb0, 0x00, 0x0c, 0x10, 0x0a, 0x60, 0x00, 0x0c,
+  0x80, 0x0f, 0x10, 0x00, 0x07, 0xc0, 0x2e, 0x00, 0xa7, 0x03, 0xe0, 0x2d, 0x00,
+  0xa6, 0x01, 0xe0, 0x1f, 0x00, 0x96, 0x01, 0xd0, 0x0e, 0x32, 0xbb, 0x35, 0x90,
+  0x05, 0xee, 0x47, 0xfd, 0x20, 0x37, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x01, 0x00, 0x0b, 0x60, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xf0, 0x0a,
+  0x00, 0x12, 0xf0, 0x0f, 0x00, 0x04, 0x0a, 0x00, 0x08, 0x14, 0x00, 0x1c, 0xf0,
+  0x36, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x02,
+  0x70, 0x0f, 0x40, 0x00, 0x00, 0x00, 0x04, 0xe5, 0x0b, 0x00, 0xc1, 0x2d, 0x60,
+  0x00, 0x00, 0x00, 0x01, 0xc7, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x03,
+  0x14, 0x00, 0x10, 0x03, 0x1e, 0x00, 0x2f, 0x0e, 0x40, 0x3f, 0x00, 0x02, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xff, 0x13, 0xff,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x4c, 0xf0, 0x00, 0x00, 0x04, 0xe2, 0xf0,
+  0x00, 0x00, 0x5e, 0x30, 0xf0, 0x00, 0x05, 0xf3, 0x00, 0xf0, 0x00, 0x6f, 0x40,
+  0x00, 0xf0, 0x00, 0xf4, 0x00, 0x00, 0xf0, 0x36, 0x00, 0x01, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0b, 0xff, 0x13, 0xf6, 0x00, 0x00,
+  0xf0, 0x00, 0x4f, 0x50, 0x00, 0xf0, 0x00, 0x04, 0xf5, 0x00, 0xf0, 0x00, 0x00,
+  0x3e, 0x40, 0xf0, 0x00, 0x00, 0x03, 0xe4, 0xf0, 0x00, 0x00, 0x00, 0x2c, 0xf0,
+  0x00, 0xff, 0xff, 0xff, 0xf0, 0x36, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x01, 0x00, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0a, 0xa0,
+  0x00, 0x00, 0x00, 0x01, 0xe5, 0x10, 0x00, 0x70, 0x4f, 0x20, 0x00, 0x00, 0x00,
+  0x08, 0xc0, 0x0b, 0x00, 0x11, 0xd8, 0x10, 0x00, 0xe0, 0x10, 0x00, 0x00, 0x00,
+  0xb9, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x00, 0x3e, 0x1e, 0x00, 0x64,
+  0xd5, 0x00, 0x00, 0x00, 0x0a, 0x90, 0x3c, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xb2,
+  0x00, 0x00, 0x00, 0x03, 0xf1, 0x00, 0x00, 0x00, 0x06, 0xe0, 0x00, 0x00, 0x00,
+  0x09, 0xa0, 0x00, 0x00, 0x00, 0x0b, 0x70, 0x00, 0x00, 0x00, 0x0e, 0x40, 0x00,
+  0x00, 0x00, 0x1f, 0x10, 0x00, 0x40, 0x00, 0x4e, 0x00, 0x09, 0xf4, 0x00, 0x7b,
+  0x00, 0x03, 0x8a, 0x00, 0xa8, 0x00, 0x00, 0x2f, 0x00, 0xd5, 0x00, 0x00, 0x0c,
+  0x50, 0xf2, 0x00, 0x00, 0x07, 0xb3, 0xf0, 0x00, 0x00, 0x01, 0xf7, 0xc0, 0x00,
+  0x00, 0x00, 0xbe, 0x90, 0x00, 0x00, 0x00, 0x6f, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x0a, 0xff,
+  0x0a, 0x2c, 0xfb, 0x11, 0xcf, 0xc2, 0xc5, 0x06, 0xcc, 0x50, 0x3c, 0xf0, 0x00,
+  0xab, 0x00, 0x0f, 0xd3, 0x05, 0xdc, 0x60, 0x4d, 0x4e, 0xfb, 0x21, 0xcf, 0xd3,
+  0x37, 0x00, 0x0b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+  0xb1, 0x5e, 0xfa, 0x00, 0x00, 0x00, 0xe5, 0x0f, 0xf0, 0x00, 0x00, 0xf0, 0x05,
+  0x00, 0x2f, 0x00, 0x00, 0x05, 0x00, 0x15, 0x24, 0x0f, 0xf0, 0x05, 0x00, 0x33,
+  0x00, 0xcf, 0xb0, 0x4e, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x01, 0x00, 0x06, 0xff, 0x13, 0xaf, 0xa0, 0x05, 0xf0, 0x08, 0xc1, 0xd9, 0x0b,
+  0xd0, 0x0e, 0x70, 0x3f, 0xcf, 0x70, 0x08, 0x20, 0x04, 0x85, 0x00, 0x01, 0xbf,
+  0xb0, 0x05, 0xf0, 0x0a, 0xb0, 0xbb, 0x1c, 0xb0, 0x0f, 0x50, 0x1c, 0xfd, 0x20,
+  0x3b, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x00,
+  0xf0, 0x04, 0x1a, 0x00, 0x00, 0x00, 0x05, 0xea, 0x00, 0x00, 0x01, 0xae, 0x40,
+  0x00, 0x00, 0x5e, 0xa1, 0x00, 0x00, 0x00, 0xf8, 0x17, 0x00, 0x80, 0x5e, 0x80,
+  0x00, 0x00, 0x00, 0x01, 0xad, 0x30, 0x1e, 0x00, 0x14, 0xe8, 0x28, 0x00, 0x00,
+  0x01, 0x00, 0x3c, 0xff, 0xff, 0xff, 0x43, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x00, 0x01, 0x00, 0x10, 0xa1, 0x05, 0x00, 0xd0, 0x9e, 0x50, 0x00,
+  0x00, 0x00, 0x04, 0xda, 0x10, 0x00, 0x00, 0x00, 0x08, 0xe5, 0x11, 0x00, 0xb3,
+  0x5f, 0x00, 0x00, 0x00, 0x07, 0xe5, 0x00, 0x00, 0x03, 0xda, 0x10, 0x1e, 0x00,
+  0x15, 0xa1, 0x32, 0x00, 0x3c, 0xff, 0xff, 0xff, 0x45, 0x00, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x10, 0x04, 0x05, 0x00, 0x10, 0x0c,
+  0x05, 0x00, 0x10, 0x59, 0x05, 0x00, 0xf0, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x06,
+  0x80, 0x00, 0x00, 0x00, 0x0d, 0x10, 0x00, 0x00, 0x00, 0x78, 0x13, 0x00, 0x24,
+  0xd2, 0x00, 0x0a, 0x00, 0x24, 0x0d, 0x10, 0x1e, 0x00, 0x25, 0x00, 0xd1, 0x32,
+  0x00, 0x13, 0x0c, 0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x01, 0x00, 0x10, 0x40, 0x05, 0x00, 0x10, 0xc0, 0x05, 0x00, 0x10, 0x95, 0x05,
+  0x00, 0x10, 0x1d, 0x05, 0x00, 0x70, 0x08, 0x60, 0x00, 0x00, 0x00, 0x01, 0xd0,
+  0x0b, 0x00, 0x10, 0x87, 0x05, 0x00, 0x14, 0x2d, 0x0a, 0x00, 0x24, 0x01, 0xd0,
+  0x1e, 0x00, 0x01, 0x28, 0x00, 0x15, 0x85, 0x3c, 0x00, 0x90, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0xf1, 0x23, 0x0f,
+  0xff, 0xff, 0xff, 0xf0, 0x0f, 0x80, 0x00, 0x18, 0xf0, 0x0f, 0x17, 0x00, 0x81,
+  0xf0, 0x0f, 0x06, 0x12, 0x60, 0xf0, 0x0f, 0x00, 0x99, 0x00, 0xf0, 0x0f, 0x00,
+  0x88, 0x00, 0xf0, 0x0f, 0x02, 0x88, 0x20, 0xf0, 0x0f, 0x08, 0x00, 0x80, 0xf0,
+  0x0f, 0x45, 0x00, 0x54, 0xf0, 0x0f, 0x90, 0x00, 0x09, 0xf0, 0x32, 0x00, 0x0b,
+  0x46, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const KDFont KDFont::privateLargeFont(LargeFont::k_glyphWidth, LargeFont::k_glyphHeight, glyphDataOffset, glyphData);
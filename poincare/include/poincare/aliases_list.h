@@ -40,6 +40,21 @@ class AliasesList {
   constexpr const char* mainAlias() const {
     return m_formattedAliasesList + hasMultipleAliases();
   }
+  constexpr int numberOfAliases() const {
+    if (!hasMultipleAliases()) {
+      return 1;
+    }
+    int result = 0;
+    const char* alias = mainAlias();
+    while (alias[0] != 0) {
+      result++;
+      while (alias[0] != 0) {
+        alias++;
+      }
+      alias++;
+    }
+    return result;
+  }
 
   bool contains(const char* alias, int aliasLen = -1) const {
     return maxDifferenceWith(alias, aliasLen > -1 ? aliasLen : strlen(alias)) ==
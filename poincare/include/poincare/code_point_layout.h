@@ -57,6 +57,9 @@ class CodePointLayoutNode : public LayoutNode {
     return KDPointZero;
   }
   bool protectedIsIdenticalTo(Layout l) override;
+  void signContent(Signature *signature) const override {
+    signature->append(m_codePoint);
+  }
   CodePoint m_codePoint;
 
  private:
@@ -49,6 +49,10 @@ class CombinedCodePointsLayoutNode final : public CodePointLayoutNode {
  private:
   void render(KDContext *ctx, KDPoint p, KDGlyph::Style style) override;
   bool protectedIsIdenticalTo(Layout l) override;
+  void signContent(Signature *signature) const override {
+    CodePointLayoutNode::signContent(signature);
+    signature->append(m_combinedCodePoint);
+  }
 
   CodePoint m_combinedCodePoint;
 };
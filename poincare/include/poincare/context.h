@@ -5,9 +5,11 @@
 #include <stdint.h>
 
 #include <cmath>
+#include <complex>
 
 namespace Poincare {
 
+class ApproximationContext;
 class Expression;
 class SymbolAbstract;
 class ContextWithParent;
@@ -33,6 +35,22 @@ class Context {
   virtual void tidyDownstreamPoolFrom(TreeNode* treePoolCursor = nullptr) {}
   virtual bool canRemoveUnderscoreToUnits() const { return true; }
 
+  /* Scalar approximations of constant symbols can be memoized by the context
+   * defining them, sparing the fetch and copy of their expression each time an
+   * expression depending on them is approximated (when plotting a function for
+   * instance). Contexts defining a symbol must not forward these calls to
+   * their parent for this symbol. */
+  virtual bool approximationForSymbol(
+      const SymbolAbstract& symbol,
+      const ApproximationContext& approximationContext, bool doublePrecision,
+      std::complex<double>* value) {
+    return false;
+  }
+  virtual void setApproximationForSymbol(
+      const SymbolAbstract& symbol,
+      const ApproximationContext& approximationContext, bool doublePrecision,
+      std::complex<double> value) {}
+
  protected:
   /* This is used by the ContextWithParent to pass itself to its parent.
    * When getting the expression for a sequences in GlobalContext, you need
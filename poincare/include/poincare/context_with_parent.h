@@ -22,6 +22,22 @@ class ContextWithParent : public Context {
     assert(m_parentContext);
     return m_parentContext->setExpressionForSymbolAbstract(expression, symbol);
   }
+  bool approximationForSymbol(const SymbolAbstract& symbol,
+                              const ApproximationContext& approximationContext,
+                              bool doublePrecision,
+                              std::complex<double>* value) override {
+    assert(m_parentContext);
+    return m_parentContext->approximationForSymbol(
+        symbol, approximationContext, doublePrecision, value);
+  }
+  void setApproximationForSymbol(
+      const SymbolAbstract& symbol,
+      const ApproximationContext& approximationContext, bool doublePrecision,
+      std::complex<double> value) override {
+    assert(m_parentContext);
+    m_parentContext->setApproximationForSymbol(symbol, approximationContext,
+                                               doublePrecision, value);
+  }
 
  protected:
   const Expression protectedExpressionForSymbolAbstract(
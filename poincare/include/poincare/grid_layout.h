@@ -126,6 +126,9 @@ class GridLayoutNode : public Array, public LayoutNode {
   KDSize computeSize(KDFont::Size font) override;
   KDCoordinate computeBaseline(KDFont::Size font) override;
   KDPoint positionOfChild(LayoutNode *l, KDFont::Size font) override;
+  void signContent(Signature *signature) const override {
+    signature->append(m_numberOfRows);
+  }
 
  private:
   // GridLayoutNode
@@ -95,6 +95,9 @@ class HorizontalLayoutNode final : public LayoutNode {
   KDPoint positionOfChild(LayoutNode *l, KDFont::Size font) override;
 
   void render(KDContext *ctx, KDPoint p, KDGlyph::Style style) override;
+  void signContent(Signature *signature) const override {
+    signature->append(static_cast<uint32_t>(m_emptyVisibility));
+  }
 
   bool shouldDrawEmptyRectangle() const;
 
@@ -58,6 +58,14 @@ class Layout : public TreeHandle {
   void invalidAllSizesPositionsAndBaselines() {
     return node()->invalidAllSizesPositionsAndBaselines();
   }
+  void sign(LayoutNode::Signature *signature) const {
+    node()->sign(signature);
+  }
+  uint32_t checksum() const {
+    LayoutNode::Signature signature;
+    sign(&signature);
+    return signature.checksum();
+  }
 
   // Serialization
   size_t serializeForParsing(char *buffer, size_t bufferSize) const {
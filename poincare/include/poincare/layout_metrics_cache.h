@@ -0,0 +1,64 @@
+#ifndef POINCARE_LAYOUT_METRICS_CACHE_H
+#define POINCARE_LAYOUT_METRICS_CACHE_H
+
+#include <ion/ring_buffer.h>
+#include <kandinsky/coordinate.h>
+#include <kandinsky/font.h>
+#include <kandinsky/size.h>
+#include <poincare/layout_node.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* Layout trees are rebuilt from scratch each time a cell is reloaded, losing
+ * the sizes and baselines memoized in their nodes. This cache keeps the
+ * metrics of the root of recently measured layouts, keyed by the layout
+ * signature, for both font sizes. It lives outside of the pool and is shared by
+ * all the views displaying layouts that are not edited in place.
+ * Signatures are compared byte by byte on lookup, their checksums only spare
+ * most of the comparisons. They are stored in a ring buffer, the oldest
+ * entries being dropped to make room for new ones. */
+
+class LayoutMetricsCache {
+ public:
+  // Larger signatures are not cached
+  constexpr static size_t k_maxSignatureSize = 256;
+
+  static LayoutMetricsCache* SharedCache();
+
+  LayoutMetricsCache() { reset(); }
+  bool find(const LayoutNode::Signature& signature, KDFont::Size font,
+            KDSize* size, KDCoordinate* baseline) const;
+  void store(const LayoutNode::Signature& signature, KDFont::Size font,
+             KDSize size, KDCoordinate baseline);
+  void reset() { m_entries.reset(); }
+
+ private:
+  constexpr static int k_numberOfEntries = 16;
+  constexpr static size_t k_signaturesSize = 1024;
+  constexpr static int k_numberOfFontSizes = 2;
+  static_assert(k_maxSignatureSize <= k_signaturesSize &&
+                    k_signaturesSize <= UINT16_MAX,
+                "Entry members are too small");
+
+  struct Entry {
+    uint32_t checksum;
+    uint16_t signatureStart;
+    uint16_t signatureSize;
+    KDCoordinate width[k_numberOfFontSizes];
+    KDCoordinate height[k_numberOfFontSizes];
+    KDCoordinate baseline[k_numberOfFontSizes];
+    bool isValid[k_numberOfFontSizes];
+  };
+
+  int indexOfEntry(const LayoutNode::Signature& signature) const;
+  // Return the start of a free area of size bytes, dropping old entries
+  size_t makeRoom(size_t size);
+
+  Ion::RingBuffer<Entry, k_numberOfEntries> m_entries;
+  uint8_t m_signatures[k_signaturesSize];
+};
+
+}  // namespace Poincare
+
+#endif
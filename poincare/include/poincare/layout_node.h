@@ -92,6 +92,42 @@ class LayoutNode : public TreeNode {
 
   // TODO: invalid cache when tempering with hierarchy
   virtual void invalidAllSizesPositionsAndBaselines();
+  /* Metrics computed for an identical layout can be memoized without measuring
+   * this layout again. */
+  bool hasMemoizedMetrics(KDFont::Size font) const {
+    return m_flags.m_sized && m_flags.m_sizeFontSize == font &&
+           m_flags.m_baselined && m_flags.m_baselineFontSize == font;
+  }
+  void memoizeMetrics(KDFont::Size font, KDSize size, KDCoordinate baseline);
+
+  /* The signature of a layout encodes its nodes in prefix order, with the
+   * values that their sizes depend on. Layouts with equal signatures are
+   * identical and have the same metrics. The checksum of the signature is
+   * always computed, whereas its bytes are only written if there is room in
+   * the buffer. */
+  class Signature {
+   public:
+    Signature(uint8_t *buffer = nullptr, size_t bufferSize = 0)
+        : m_buffer(buffer),
+          m_bufferSize(bufferSize),
+          m_size(0),
+          m_checksum(~0u) {}
+    void append(uint32_t value);
+    const uint8_t *bytes() const { return m_buffer; }
+    // The number of bytes of the signature, which can exceed the buffer size
+    size_t size() const { return m_size; }
+    bool fitsInBuffer() const {
+      return m_buffer != nullptr && m_size <= m_bufferSize;
+    }
+    uint32_t checksum() const { return m_checksum; }
+
+   private:
+    uint8_t *m_buffer;
+    size_t m_bufferSize;
+    size_t m_size;
+    uint32_t m_checksum;
+  };
+  void sign(Signature *signature);
   size_t serialize(char *buffer, size_t bufferSize,
                    Preferences::PrintFloatMode floatDisplayMode =
                        Preferences::PrintFloatMode::Decimal,
@@ -167,6 +203,9 @@ class LayoutNode : public TreeNode {
 
  protected:
   virtual bool protectedIsIdenticalTo(Layout l);
+  /* Append the data compared by protectedIsIdenticalTo to the signature.
+   * Children are handled by sign. */
+  virtual void signContent(Signature *signature) const {}
 
   // Tree
   Direct<LayoutNode> children() { return Direct<LayoutNode>(this); }
@@ -72,6 +72,10 @@ class Matrix final : public Expression {
   /* Cap the matrix's size for inverse and determinant computation.
    * TODO: Find another solution */
   constexpr static int k_maxNumberOfChildren = 100;
+  // Maximal dimension of square matrices
+  constexpr static int k_maxDimension = 10;
+  static_assert(k_maxDimension * k_maxDimension <= k_maxNumberOfChildren,
+                "k_maxDimension is too large");
 
   Matrix(const MatrixNode* node) : Expression(node) {}
   static Matrix Builder() {
@@ -99,6 +103,29 @@ class Matrix final : public Expression {
    * array[row_index][column_index] */
   template <typename T>
   static int ArrayInverse(T* array, int numberOfRows, int numberOfColumns);
+  /* Decompose the square array in-place into P*A = L*U using partial pivoting.
+   * L is unit lower triangular and stored below the diagonal, U is upper
+   * triangular and stored on and above the diagonal. At step k, row k was
+   * swapped with row pivots[k]. Return the determinant of A, which is NAN if A
+   * has undefined coefficients. */
+  template <typename T>
+  static T ArrayLUDecomposition(T* array, int dim, int* pivots);
+  /* Solve A*X = B in-place in b, b being a dim*numberOfColumnsB array, from
+   * the LU decomposition of A. */
+  template <typename T>
+  static void ArrayLUSolve(const T* lu, int dim, const int* pivots, T* b,
+                           int numberOfColumnsB);
+  /* Decompose the symmetric positive definite array in-place into A = L*Lt.
+   * L is stored on and below the diagonal, the upper part is left untouched.
+   * Return false if A is not positive definite. This needs half the flops of
+   * the LU decomposition. */
+  template <typename T>
+  static bool ArrayCholeskyDecomposition(T* array, int dim);
+  /* Solve A*X = B in-place in b, b being a dim*numberOfColumnsB array, from
+   * the Cholesky decomposition of A. */
+  template <typename T>
+  static void ArrayCholeskySolve(const T* l, int dim, T* b,
+                                 int numberOfColumnsB);
   static Matrix CreateIdentity(int dim);
   Matrix createTranspose() const;
   Expression createRef(const ReductionContext& reductionContext,
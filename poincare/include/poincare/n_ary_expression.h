@@ -39,6 +39,13 @@ class NAryExpressionNode
   /* With a pool of size < 120k and TreeNode of size 20, a node can't have more
    * than 6144 children which fit in uint16_t. */
   uint16_t m_numberOfChildren;
+
+ private:
+  /* Children are sorted through index arrays allocated on the stack. Longer
+   * lists of children are bubble sorted in place. */
+  constexpr static int k_maxNumberOfMergeSortedChildren = 64;
+  void bubbleSortChildrenInPlace(ExpressionOrder order, Context* context,
+                                 bool canSwapMatrices, bool canContainMatrices);
 };
 
 class NAryExpression : public Expression {
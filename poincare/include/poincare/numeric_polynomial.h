@@ -0,0 +1,69 @@
+#ifndef POINCARE_NUMERIC_POLYNOMIAL_H
+#define POINCARE_NUMERIC_POLYNOMIAL_H
+
+#include <poincare/computation_context.h>
+#include <poincare/expression.h>
+
+namespace Poincare {
+
+/* Polynomial of any degree up to k_maxDegree with real coefficients, stored by
+ * increasing degree. Unlike Polynomial, which solves equations of degree 3 at
+ * most with expressions in the pool, it is used to find the real roots of a
+ * polynomial numerically, without sampling it. */
+
+class NumericPolynomial {
+ public:
+  constexpr static int k_maxDegree = 10;
+
+  /* Return an undefined polynomial if e is not a polynomial of degree 1 to
+   * k_maxDegree in symbol, or if a coefficient does not approximate to a
+   * finite real. */
+  static NumericPolynomial FromExpression(
+      const Expression e, const char* symbol,
+      const ApproximationContext& approximationContext);
+
+  NumericPolynomial() : m_degree(-1) {}
+  NumericPolynomial(const double* coefficients, int degree);
+
+  bool isUndefined() const { return m_degree < 0; }
+  int degree() const { return m_degree; }
+  double coefficient(int i) const {
+    assert(0 <= i && i <= m_degree);
+    return m_coefficients[i];
+  }
+
+  /* Compensated Horner scheme, as accurate as if computed with twice the
+   * precision of double. */
+  double evaluate(double x) const;
+  NumericPolynomial derivative() const;
+  /* Fill roots with the distinct real roots in [min, max] in increasing
+   * order, and return their number. The interval is split at the critical
+   * points, which are the roots of the derivative, found recursively. This is
+   * monotonic between two critical points, so it has a root there if and only
+   * if it changes sign, which is then refined by bisection. A critical point
+   * is a multiple root if the value of this is within the rounding errors of
+   * its coefficients. Two roots closer than these errors allow to tell apart
+   * are found as one. */
+  int realRoots(double min, double max, double* roots,
+                int maxNumberOfRoots) const;
+
+ private:
+  static NumericPolynomial Product(const NumericPolynomial& p1,
+                                   const NumericPolynomial& p2);
+  static NumericPolynomial Sum(const NumericPolynomial& p1,
+                               const NumericPolynomial& p2);
+
+  // Bound of the error of evaluate(x) due to the rounding of the coefficients
+  double roundingErrorBound(double x) const;
+  // Root of ]left, right], between which this changes sign and is monotonic
+  double rootBetween(double left, double right) const;
+  // Drop leading coefficients smaller than threshold
+  void trim(double threshold);
+
+  double m_coefficients[k_maxDegree + 1];
+  int m_degree;
+};
+
+}  // namespace Poincare
+
+#endif
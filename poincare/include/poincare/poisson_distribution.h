@@ -21,6 +21,17 @@ class PoissonDistribution final : public DiscreteDistribution {
     return EvaluateAtAbscissa<double>(x, parameters[0]);
   }
 
+  template <typename T>
+  static T CumulativeDistributiveFunctionAtAbscissa(T x, const T lambda);
+  float cumulativeDistributiveFunctionAtAbscissa(
+      float x, const float* parameters) const override {
+    return CumulativeDistributiveFunctionAtAbscissa<float>(x, parameters[0]);
+  }
+  double cumulativeDistributiveFunctionAtAbscissa(
+      double x, const double* parameters) const override {
+    return CumulativeDistributiveFunctionAtAbscissa<double>(x, parameters[0]);
+  }
+
   template <typename T>
   static T CumulativeDistributiveInverseForProbability(T probability,
                                                        const T lambda);
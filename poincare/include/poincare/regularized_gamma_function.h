@@ -7,8 +7,13 @@ namespace Poincare {
 
 constexpr static int k_maxRegularizedGammaIterations = 1000;
 constexpr static double k_regularizedGammaPrecision = DBL_EPSILON;
-double RegularizedGammaFunction(double s, double x, double epsilon,
-                                int maxNumberOfIterations, double* result);
+/* Return false if the computation did not converge within
+ * maxNumberOfIterations, in which case result is left untouched. */
+bool RegularizedGammaFunction(double s, double x, double epsilon,
+                              int maxNumberOfIterations, double* result);
+// Q(s, x) = 1 - P(s, x), computed without cancellation when it is tiny
+bool RegularizedUpperGammaFunction(double s, double x, double epsilon,
+                                   int maxNumberOfIterations, double* result);
 
 }  // namespace Poincare
 
@@ -0,0 +1,105 @@
+#ifndef POINCARE_REWRITING_RULES_H
+#define POINCARE_REWRITING_RULES_H
+
+#include <poincare/expression.h>
+#include <stdint.h>
+
+#if POINCARE_TREE_LOG
+#include <iostream>
+#include <ostream>
+#endif
+
+namespace Poincare {
+
+/* Instead of being written as steps of a shallowReduce, some reduction rules
+ * are declared as patterns on the reduced node and its children. The rules are
+ * indexed once in a discrimination tree, which is walked with the type of the
+ * node and the symbols of its children to find the rules that can apply, so
+ * adding a rule does not slow down the reduction of the nodes it cannot match.
+ * Rules matching the same node are tried in declaration order. Each rule
+ * counts how often it was tried and applied, and debug builds also measure the
+ * time spent in it, to find which rules dominate the simplification. */
+
+class PatternSymbol {
+ public:
+  enum class Kind : uint8_t { Any, Type, Zero, One };
+
+  constexpr PatternSymbol() : PatternSymbol(Kind::Any) {}
+  constexpr static PatternSymbol Any() { return PatternSymbol(Kind::Any); }
+  constexpr static PatternSymbol OfType(ExpressionNode::Type type) {
+    return PatternSymbol(Kind::Type, type);
+  }
+  // Zero and One match any number of this value
+  constexpr static PatternSymbol Zero() { return PatternSymbol(Kind::Zero); }
+  constexpr static PatternSymbol One() { return PatternSymbol(Kind::One); }
+
+  bool matches(const Expression e) const;
+  bool isIdenticalTo(const PatternSymbol& other) const {
+    return m_kind == other.m_kind &&
+           (m_kind != Kind::Type || m_type == other.m_type);
+  }
+
+ private:
+  constexpr PatternSymbol(Kind kind, ExpressionNode::Type type =
+                                         ExpressionNode::Type::Uninitialized)
+      : m_kind(kind), m_type(type) {}
+
+  Kind m_kind;
+  ExpressionNode::Type m_type;
+};
+
+struct RewritingRule {
+  constexpr static int k_maxNumberOfChildren = 2;
+  // Further restrict the expressions matching the pattern
+  typedef bool (*Condition)(const Expression e);
+  // Replace e in place and return its replacement
+  typedef Expression (*Rewrite)(Expression e,
+                                const ReductionContext& reductionContext);
+
+  const char* name;
+  ExpressionNode::Type type;
+  int numberOfChildren;
+  PatternSymbol children[k_maxNumberOfChildren];
+  Condition condition;  // nullptr if the pattern is enough
+  Rewrite rewrite;
+};
+
+class RewritingRules {
+ public:
+  struct Statistics {
+    int numberOfTries;
+    int numberOfHits;
+#if POINCARE_TREE_LOG
+    uint64_t duration;
+#endif
+  };
+
+  /* Rewrite e with the first rule it matches and return the result, or return
+   * an uninitialized expression if it matches none. */
+  static Expression Apply(Expression e,
+                          const ReductionContext& reductionContext);
+
+  constexpr static int NumberOfRules() { return k_numberOfRules; }
+  // Return -1 if no rule has this name
+  static int IndexOfRule(const char* name);
+  static const Statistics& StatisticsOfRule(int index);
+  static void ResetStatistics();
+#if POINCARE_TREE_LOG
+  // Rules are logged by decreasing time spent in them
+  static void Log(std::ostream& stream);
+  __attribute__((__used__)) static void Log() { Log(std::cout); }
+#endif
+
+ private:
+  constexpr static int k_numberOfRules = 5;
+  // Sets of rules are bit masks indexed by the rules' declaration order
+  typedef uint32_t RuleSet;
+  static_assert(k_numberOfRules <= sizeof(RuleSet) * 8,
+                "RuleSet cannot hold every rule");
+
+  static const RewritingRule k_rules[k_numberOfRules];
+};
+
+}  // namespace Poincare
+
+#endif
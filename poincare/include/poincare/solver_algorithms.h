@@ -40,6 +40,13 @@ class SolverAlgorithms {
   template <typename T>
   static T CumulativeDistributiveFunctionForNDefinedFunction(
       T x, typename Solver<T>::FunctionEvaluation f, const void* aux);
+  /* Same contract as CumulativeDistributiveInverseForNDefinedFunction, but
+   * takes the cumulative distributive function itself, which is bracketed and
+   * bisected in a logarithmic number of evaluations. */
+  template <typename T>
+  static T CumulativeDistributiveInverseForNDefinedCumulativeFunction(
+      T* probability, typename Solver<T>::FunctionEvaluation cumulative,
+      const void* aux);
 
  private:
   constexpr static int k_numberOfIterationsBrent = 100;
@@ -48,6 +48,7 @@ class StringLayoutNode : public LayoutNode {
   constexpr static int k_minDigitsForThousandSeparator = 5;
 
   bool protectedIsIdenticalTo(Layout l) override;
+  void signContent(Signature *signature) const override;
   KDSize computeSize(KDFont::Size font) override;
   KDCoordinate computeBaseline(KDFont::Size font) override;
   KDPoint positionOfChild(LayoutNode *child, KDFont::Size font) override {
@@ -174,7 +174,7 @@ class UnitNode final : public ExpressionNode {
       return 0;
     }
 
-    AliasesList rootSymbols() const { return m_rootSymbols; }
+    constexpr AliasesList rootSymbols() const { return m_rootSymbols; }
     double ratio() const { return m_ratio; }
     bool isInputPrefixable() const {
       return m_inputPrefixable != Prefixable::None;
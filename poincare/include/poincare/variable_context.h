@@ -4,6 +4,7 @@
 #include <poincare/context_with_parent.h>
 #include <poincare/float.h>
 #include <poincare/symbol_abstract.h>
+#include <string.h>
 
 namespace Poincare {
 
@@ -25,6 +26,14 @@ class VariableContext : public ContextWithParent {
                                                  int length) override;
   bool setExpressionForSymbolAbstract(const Expression& expression,
                                       const SymbolAbstract& symbol) override;
+  bool approximationForSymbol(const SymbolAbstract& symbol,
+                              const ApproximationContext& approximationContext,
+                              bool doublePrecision,
+                              std::complex<double>* value) override;
+  void setApproximationForSymbol(
+      const SymbolAbstract& symbol,
+      const ApproximationContext& approximationContext, bool doublePrecision,
+      std::complex<double> value) override;
 
  protected:
   const Expression protectedExpressionForSymbolAbstract(
@@ -32,6 +41,10 @@ class VariableContext : public ContextWithParent {
       ContextWithParent* lastDescendantContext) override;
 
  private:
+  bool definesSymbol(const SymbolAbstract& symbol) const {
+    return m_name != nullptr && strcmp(symbol.name(), m_name) == 0;
+  }
+
   const char* m_name;
   Expression m_value;
 };
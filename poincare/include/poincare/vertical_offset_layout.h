@@ -68,6 +68,7 @@ class VerticalOffsetLayoutNode final : public LayoutNode {
   KDPoint positionOfChild(LayoutNode *child, KDFont::Size font) override;
   void render(KDContext *ctx, KDPoint p, KDGlyph::Style style) override;
   bool protectedIsIdenticalTo(Layout l) override;
+  void signContent(Signature *signature) const override;
 
   LayoutNode *indiceLayout() { return childAtIndex(0); }
   int baseOffsetInParent() const {
@@ -89,15 +89,18 @@ T BinomialDistribution::CumulativeDistributiveInverseForProbability(
   }
   T proba = probability;
   const void *pack[2] = {&n, &p};
-  return SolverAlgorithms::CumulativeDistributiveInverseForNDefinedFunction<T>(
-      &proba,
-      [](T x, const void *auxiliary) {
-        const void *const *pack = static_cast<const void *const *>(auxiliary);
-        T n = *static_cast<const T *>(pack[0]);
-        T p = *static_cast<const T *>(pack[1]);
-        return BinomialDistribution::EvaluateAtAbscissa(x, n, p);
-      },
-      pack);
+  return SolverAlgorithms::
+      CumulativeDistributiveInverseForNDefinedCumulativeFunction<T>(
+          &proba,
+          [](T x, const void *auxiliary) {
+            const void *const *pack =
+                static_cast<const void *const *>(auxiliary);
+            T n = *static_cast<const T *>(pack[0]);
+            T p = *static_cast<const T *>(pack[1]);
+            return BinomialDistribution::
+                CumulativeDistributiveFunctionAtAbscissa(x, n, p);
+          },
+          pack);
 }
 
 template <typename T>
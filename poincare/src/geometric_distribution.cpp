@@ -4,7 +4,6 @@
 #include <poincare/domain.h>
 #include <poincare/float.h>
 #include <poincare/geometric_distribution.h>
-#include <poincare/regularized_incomplete_beta_function.h>
 #include <poincare/solver.h>
 
 #include <cmath>
@@ -28,6 +27,21 @@ T GeometricDistribution::EvaluateAtAbscissa(T x, T p) {
   return p * std::exp(lResult);
 }
 
+template <typename T>
+T GeometricDistribution::CumulativeDistributiveFunctionAtAbscissa(T x, T p) {
+  if (!PIsOK(p) || std::isnan(x)) {
+    return NAN;
+  }
+  if (std::isinf(x)) {
+    return x > static_cast<T>(0.0) ? static_cast<T>(1.0) : static_cast<T>(0.0);
+  }
+  if (x < static_cast<T>(1.0)) {
+    return static_cast<T>(0.0);
+  }
+  // The result is 1 - (1-p)^k, which is also the incomplete beta I_p(1, k)
+  return -std::expm1(std::floor(x) * std::log1p(-p));
+}
+
 template <typename T>
 T GeometricDistribution::CumulativeDistributiveInverseForProbability(
     T probability, T p) {
@@ -47,16 +61,19 @@ T GeometricDistribution::CumulativeDistributiveInverseForProbability(
   }
   T proba = probability;
   const void *pack[1] = {&p};
-  /* It works even if G(p) is defined on N* and not N because G(0) returns 0 and
-   * not undef */
-  return SolverAlgorithms::CumulativeDistributiveInverseForNDefinedFunction<T>(
-      &proba,
-      [](T x, const void *auxiliary) {
-        const void *const *pack = static_cast<const void *const *>(auxiliary);
-        T p = *static_cast<const T *>(pack[0]);
-        return GeometricDistribution::EvaluateAtAbscissa(x, p);
-      },
-      pack);
+  /* It works even if G(p) is defined on N* and not N because the cumulative
+   * function is 0 and not undef at 0 */
+  return SolverAlgorithms::
+      CumulativeDistributiveInverseForNDefinedCumulativeFunction<T>(
+          &proba,
+          [](T x, const void *auxiliary) {
+            const void *const *pack =
+                static_cast<const void *const *>(auxiliary);
+            T p = *static_cast<const T *>(pack[0]);
+            return GeometricDistribution::
+                CumulativeDistributiveFunctionAtAbscissa(x, p);
+          },
+          pack);
 }
 
 template <typename T>
@@ -74,6 +91,12 @@ template float GeometricDistribution::EvaluateAtAbscissa<float>(float, float);
 template double GeometricDistribution::EvaluateAtAbscissa<double>(double,
                                                                   double);
 template float
+GeometricDistribution::CumulativeDistributiveFunctionAtAbscissa<float>(float,
+                                                                       float);
+template double
+GeometricDistribution::CumulativeDistributiveFunctionAtAbscissa<double>(double,
+                                                                        double);
+template float
 GeometricDistribution::CumulativeDistributiveInverseForProbability<float>(
     float, float);
 template double
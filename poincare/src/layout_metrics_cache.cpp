@@ -0,0 +1,100 @@
+#include <assert.h>
+#include <poincare/layout_metrics_cache.h>
+#include <string.h>
+
+namespace Poincare {
+
+static LayoutMetricsCache s_layoutMetricsCache;
+
+LayoutMetricsCache* LayoutMetricsCache::SharedCache() {
+  return &s_layoutMetricsCache;
+}
+
+bool LayoutMetricsCache::find(const LayoutNode::Signature& signature,
+                              KDFont::Size font, KDSize* size,
+                              KDCoordinate* baseline) const {
+  int index = indexOfEntry(signature);
+  int fontIndex = static_cast<int>(font);
+  if (index < 0 || !m_entries.elementAtIndex(index)->isValid[fontIndex]) {
+    return false;
+  }
+  const Entry* entry = m_entries.elementAtIndex(index);
+  if (size) {
+    *size = KDSize(entry->width[fontIndex], entry->height[fontIndex]);
+  }
+  if (baseline) {
+    *baseline = entry->baseline[fontIndex];
+  }
+  return true;
+}
+
+void LayoutMetricsCache::store(const LayoutNode::Signature& signature,
+                               KDFont::Size font, KDSize size,
+                               KDCoordinate baseline) {
+  if (!signature.fitsInBuffer() || signature.size() > k_maxSignatureSize) {
+    return;
+  }
+  int index = indexOfEntry(signature);
+  if (index < 0) {
+    size_t start = makeRoom(signature.size());
+    memcpy(m_signatures + start, signature.bytes(), signature.size());
+    Entry newEntry = {
+        .checksum = signature.checksum(),
+        .signatureStart = static_cast<uint16_t>(start),
+        .signatureSize = static_cast<uint16_t>(signature.size())};
+    for (int i = 0; i < k_numberOfFontSizes; i++) {
+      newEntry.isValid[i] = false;
+    }
+    m_entries.push(newEntry);
+    index = m_entries.length() - 1;
+  }
+  int fontIndex = static_cast<int>(font);
+  Entry* entry = m_entries.elementAtIndex(index);
+  entry->width[fontIndex] = size.width();
+  entry->height[fontIndex] = size.height();
+  entry->baseline[fontIndex] = baseline;
+  entry->isValid[fontIndex] = true;
+}
+
+int LayoutMetricsCache::indexOfEntry(
+    const LayoutNode::Signature& signature) const {
+  if (!signature.fitsInBuffer()) {
+    return -1;
+  }
+  for (size_t i = 0; i < m_entries.length(); i++) {
+    const Entry* entry = m_entries.elementAtIndex(i);
+    if (entry->checksum == signature.checksum() &&
+        entry->signatureSize == signature.size() &&
+        memcmp(m_signatures + entry->signatureStart, signature.bytes(),
+               signature.size()) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+size_t LayoutMetricsCache::makeRoom(size_t size) {
+  assert(size <= k_signaturesSize);
+  while (!m_entries.isEmpty()) {
+    if (m_entries.length() < k_numberOfEntries) {
+      size_t firstStart = m_entries.elementAtIndex(0)->signatureStart;
+      const Entry* last = m_entries.elementAtIndex(m_entries.length() - 1);
+      size_t end = last->signatureStart + last->signatureSize;
+      if (firstStart < end) {
+        // The free area is split between the end and the start of the buffer
+        if (end + size <= k_signaturesSize) {
+          return end;
+        }
+        if (size <= firstStart) {
+          return 0;
+        }
+      } else if (end + size <= firstStart) {
+        return end;
+      }
+    }
+    m_entries.queuePop();
+  }
+  return 0;
+}
+
+}  // namespace Poincare
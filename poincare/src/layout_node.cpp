@@ -1,4 +1,5 @@
 #include <escher/metric.h>
+#include <ion/crc.h>
 #include <ion/display.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/exception_checkpoint.h>
@@ -129,6 +130,16 @@ KDCoordinate LayoutNode::baseline(KDFont::Size font) {
   return m_baseline;
 }
 
+void LayoutNode::memoizeMetrics(KDFont::Size font, KDSize size,
+                                KDCoordinate baseline) {
+  m_frame.setSize(size);
+  m_flags.m_sized = true;
+  m_flags.m_sizeFontSize = font;
+  m_baseline = baseline;
+  m_flags.m_baselined = true;
+  m_flags.m_baselineFontSize = font;
+}
+
 void LayoutNode::invalidAllSizesPositionsAndBaselines() {
   m_flags.m_sized = false;
   m_flags.m_positioned = false;
@@ -215,6 +226,33 @@ bool LayoutNode::deleteGraySquaresBeforeLeavingGrid(Layout layoutToExclude) {
 
 // Protected and private
 
+void LayoutNode::sign(Signature *signature) {
+  signature->append(static_cast<uint32_t>(type()));
+  signature->append(numberOfChildren());
+  signature->append(m_flags.m_margin);
+  signContent(signature);
+  for (LayoutNode *l : children()) {
+    l->sign(signature);
+  }
+}
+
+void LayoutNode::Signature::append(uint32_t value) {
+  /* Values are written 7 bits at a time, the high bit of a byte telling
+   * whether more bytes follow, so that small values take a single byte. */
+  do {
+    uint8_t byte = value & 0x7F;
+    value >>= 7;
+    if (value != 0) {
+      byte |= 0x80;
+    }
+    m_checksum = Ion::crc32EatByte(m_checksum, byte);
+    if (m_size < m_bufferSize) {
+      m_buffer[m_size] = byte;
+    }
+    m_size++;
+  } while (value != 0);
+}
+
 bool LayoutNode::protectedIsIdenticalTo(Layout l) {
   if (numberOfChildren() != l.numberOfChildren()) {
     return false;
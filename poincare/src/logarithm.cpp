@@ -14,6 +14,7 @@
 #include <poincare/nonreal.h>
 #include <poincare/power.h>
 #include <poincare/rational.h>
+#include <poincare/rewriting_rules.h>
 #include <poincare/serialization_helper.h>
 #include <poincare/simplification_helper.h>
 #include <poincare/square_root.h>
@@ -265,36 +266,11 @@ Expression Logarithm::shallowReduce(ReductionContext reductionContext) {
 Expression Logarithm::simpleShallowReduce(
     const ReductionContext& reductionContext) {
   assert(numberOfChildren() == 2);
-  Expression c = childAtIndex(0);
-  Expression b = childAtIndex(1);
-
-  // log(x,0) = log(x,1) = undef
-  if (b.isZero() || b.isOne()) {
-    return replaceWithUndefinedInPlace();
-  }
-  if (c.type() == ExpressionNode::Type::Rational) {
-    const Rational r = static_cast<Rational&>(c);
-    // log(0,x) = undef
-    if (r.isZero()) {
-      return replaceWithUndefinedInPlace();
-    }
-    // log(1,x) = 0;
-    if (r.isOne()) {
-      Expression result = Rational::Builder(0);
-      replaceWithInPlace(result);
-      return result;
-    }
-  }
-  // log(x,x) = 1 with x != inf, and log(inf,inf) = undef
-  if (c.isIdenticalTo(b)) {
-    Expression result =
-        c.recursivelyMatches(Expression::IsInfinity, reductionContext.context())
-            ? Undefined::Builder().convert<Expression>()
-            : Rational::Builder(1).convert<Expression>();
-    replaceWithInPlace(result);
+  // log(x,0), log(x,1), log(0,x), log(1,x) and log(x,x) are rewriting rules
+  Expression result = RewritingRules::Apply(*this, reductionContext);
+  if (!result.isUninitialized()) {
     return result;
   }
-
   return *this;
 }
 
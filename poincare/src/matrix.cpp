@@ -219,40 +219,178 @@ int Matrix::ArrayInverse(T *array, int numberOfRows, int numberOfColumns) {
   }
   assert(numberOfRows * numberOfColumns <= k_maxNumberOfChildren);
   int dim = numberOfRows;
-  /* Create the matrix inv = (A|I) with A the input matrix and I the dim
-   * identity matrix (A is squared with less than k_maxNumberOfChildren so (A|I)
-   * has less than 2*k_maxNumberOfChildren */
-  T operands[2 * k_maxNumberOfChildren];
-  for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      T cell = array[i * numberOfColumns + j];
-      // Using abs function to be compatible with both double and std::complex
-      if (!std::isfinite(std::abs(cell))) {
-        return -2;
-      }
-      operands[i * 2 * dim + j] = cell;
-    }
-    for (int j = dim; j < 2 * dim; j++) {
-      operands[i * 2 * dim + j] = j - dim == i ? 1.0 : 0.0;
+  T lu[k_maxNumberOfChildren];
+  for (int i = 0; i < dim * dim; i++) {
+    // Using abs function to be compatible with both double and std::complex
+    if (!std::isfinite(std::abs(array[i]))) {
+      return -2;
     }
+    lu[i] = array[i];
   }
-  ArrayRowCanonize(operands, dim, 2 * dim);
+  int pivots[k_maxDimension];
+  ArrayLUDecomposition(lu, dim, pivots);
   // Check inversibility
   for (int i = 0; i < dim; i++) {
-    T cell = operands[i * 2 * dim + i];
-    if (!std::isfinite(std::abs(cell)) ||
-        std::abs(cell - static_cast<T>(1.0)) > Float<float>::EpsilonLax()) {
+    T cell = lu[i * dim + i];
+    if (!std::isfinite(std::abs(cell)) || std::abs(cell) < DBL_MIN) {
       return -2;
     }
   }
+  // Solve A*X = I in-place
   for (int i = 0; i < dim; i++) {
     for (int j = 0; j < dim; j++) {
-      array[i * numberOfColumns + j] = operands[i * 2 * dim + j + dim];
+      array[i * dim + j] = i == j ? 1.0 : 0.0;
     }
   }
+  ArrayLUSolve(lu, dim, pivots, array, dim);
   return 0;
 }
 
+template <typename T>
+T Matrix::ArrayLUDecomposition(T *array, int dim, int *pivots) {
+  for (int i = 0; i < dim; i++) {
+    pivots[i] = i;
+  }
+  for (int i = 0; i < dim * dim; i++) {
+    if (std::isnan(std::abs(array[i]))) {
+      return static_cast<T>(NAN);
+    }
+  }
+  T determinant = static_cast<T>(1.0);
+  for (int k = 0; k < dim; k++) {
+    // Find the biggest pivot (in absolute value) for numerical stability
+    int iPivot = k;
+    // Using double to stay accurate with any type T
+    double bestPivot = 0.0;
+    for (int i = k; i < dim; i++) {
+      double pivot = std::abs(array[i * dim + k]);
+      if (pivot > bestPivot) {
+        bestPivot = pivot;
+        iPivot = i;
+      }
+    }
+    if (bestPivot < DBL_MIN) {
+      // No non-null coefficient in this column, the matrix is singular
+      determinant *= static_cast<T>(0.0);
+      continue;
+    }
+    pivots[k] = iPivot;
+    if (iPivot != k) {
+      for (int j = 0; j < dim; j++) {
+        std::swap(array[iPivot * dim + j], array[k * dim + j]);
+      }
+      determinant *= static_cast<T>(-1.0);
+    }
+    T pivot = array[k * dim + k];
+    determinant *= pivot;
+    /* Rows are updated one after the other so that the innermost loop browses
+     * contiguous memory. */
+    for (int i = k + 1; i < dim; i++) {
+      T factor = array[i * dim + k] / pivot;
+      array[i * dim + k] = factor;
+      for (int j = k + 1; j < dim; j++) {
+        array[i * dim + j] -= factor * array[k * dim + j];
+      }
+    }
+  }
+  return determinant;
+}
+
+template <typename T>
+void Matrix::ArrayLUSolve(const T *lu, int dim, const int *pivots, T *b,
+                          int numberOfColumnsB) {
+  int n = numberOfColumnsB;
+  // Apply the row swaps to B
+  for (int k = 0; k < dim; k++) {
+    if (pivots[k] != k) {
+      for (int j = 0; j < n; j++) {
+        std::swap(b[pivots[k] * n + j], b[k * n + j]);
+      }
+    }
+  }
+  // Forward substitution: L*Y = P*B, L having a unit diagonal
+  for (int i = 0; i < dim; i++) {
+    for (int k = 0; k < i; k++) {
+      T factor = lu[i * dim + k];
+      for (int j = 0; j < n; j++) {
+        b[i * n + j] -= factor * b[k * n + j];
+      }
+    }
+  }
+  // Backward substitution: U*X = Y
+  for (int i = dim - 1; i >= 0; i--) {
+    for (int k = i + 1; k < dim; k++) {
+      T factor = lu[i * dim + k];
+      for (int j = 0; j < n; j++) {
+        b[i * n + j] -= factor * b[k * n + j];
+      }
+    }
+    T divisor = lu[i * dim + i];
+    for (int j = 0; j < n; j++) {
+      b[i * n + j] /= divisor;
+    }
+  }
+}
+
+template <typename T>
+bool Matrix::ArrayCholeskyDecomposition(T *array, int dim) {
+  for (int j = 0; j < dim; j++) {
+    // L[j][j] = sqrt(A[j][j] - sum(L[j][k]^2))
+    T diagonal = array[j * dim + j];
+    for (int k = 0; k < j; k++) {
+      diagonal -= array[j * dim + k] * array[j * dim + k];
+    }
+    // This also catches undefined coefficients
+    if (!(diagonal > static_cast<T>(0.0))) {
+      return false;
+    }
+    diagonal = std::sqrt(diagonal);
+    array[j * dim + j] = diagonal;
+    // L[i][j] = (A[i][j] - sum(L[i][k]*L[j][k])) / L[j][j], both rows are read
+    // contiguously
+    for (int i = j + 1; i < dim; i++) {
+      T value = array[i * dim + j];
+      for (int k = 0; k < j; k++) {
+        value -= array[i * dim + k] * array[j * dim + k];
+      }
+      array[i * dim + j] = value / diagonal;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void Matrix::ArrayCholeskySolve(const T *l, int dim, T *b,
+                                int numberOfColumnsB) {
+  int n = numberOfColumnsB;
+  // Forward substitution: L*Y = B
+  for (int i = 0; i < dim; i++) {
+    for (int k = 0; k < i; k++) {
+      T factor = l[i * dim + k];
+      for (int j = 0; j < n; j++) {
+        b[i * n + j] -= factor * b[k * n + j];
+      }
+    }
+    T divisor = l[i * dim + i];
+    for (int j = 0; j < n; j++) {
+      b[i * n + j] /= divisor;
+    }
+  }
+  // Backward substitution: Lt*X = Y
+  for (int i = dim - 1; i >= 0; i--) {
+    for (int k = i + 1; k < dim; k++) {
+      T factor = l[k * dim + i];
+      for (int j = 0; j < n; j++) {
+        b[i * n + j] -= factor * b[k * n + j];
+      }
+    }
+    T divisor = l[i * dim + i];
+    for (int j = 0; j < n; j++) {
+      b[i * n + j] /= divisor;
+    }
+  }
+}
+
 bool Matrix::isCanonizable(const ReductionContext &reductionContext) {
   ApproximationContext approximationContext(reductionContext);
   int m = numberOfRows();
@@ -789,6 +927,20 @@ Expression Matrix::computeInverseOrDeterminant(
 }
 
 template int Matrix::ArrayInverse<double>(double *, int, int);
+template double Matrix::ArrayLUDecomposition<double>(double *, int, int *);
+template std::complex<float> Matrix::ArrayLUDecomposition<std::complex<float>>(
+    std::complex<float> *, int, int *);
+template std::complex<double>
+Matrix::ArrayLUDecomposition<std::complex<double>>(std::complex<double> *, int,
+                                                   int *);
+template void Matrix::ArrayLUSolve<double>(const double *, int, const int *,
+                                           double *, int);
+template bool Matrix::ArrayCholeskyDecomposition<float>(float *, int);
+template bool Matrix::ArrayCholeskyDecomposition<double>(double *, int);
+template void Matrix::ArrayCholeskySolve<float>(const float *, int, float *,
+                                                int);
+template void Matrix::ArrayCholeskySolve<double>(const double *, int, double *,
+                                                 int);
 template int Matrix::ArrayInverse<std::complex<float>>(std::complex<float> *,
                                                        int, int);
 template int Matrix::ArrayInverse<std::complex<double>>(std::complex<double> *,
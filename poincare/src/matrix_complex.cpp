@@ -68,10 +68,8 @@ std::complex<T> MatrixComplexNode<T>::determinant() const {
     // Returns complex<T>(NAN, NAN) if Node type is not Complex
     operandsCopy[i] = complexAtIndex(i);
   }
-  std::complex<T> determinant = std::complex<T>(1);
-  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns,
-                           &determinant);
-  return determinant;
+  int pivots[Matrix::k_maxDimension];
+  return Matrix::ArrayLUDecomposition(operandsCopy, m_numberOfRows, pivots);
 }
 
 template <typename T>
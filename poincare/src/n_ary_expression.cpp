@@ -3,33 +3,110 @@
 extern "C" {
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 }
+#include <algorithm>
 #include <utility>
 
 namespace Poincare {
 
+static bool shouldSwap(const ExpressionNode* c1, bool c1IsMatrix,
+                       const ExpressionNode* c2, bool c2IsMatrix,
+                       NAryExpressionNode::ExpressionOrder order,
+                       bool canSwapMatrices) {
+  /* Warning: Matrix operations are not always commutative (ie,
+   * multiplication) so we never swap 2 matrices. */
+  return (c1IsMatrix &&
+          !c2IsMatrix) ||  // we always put matrices at the end of expressions
+         (c1IsMatrix && c2IsMatrix && canSwapMatrices && order(c1, c2) > 0) ||
+         (!c1IsMatrix && !c2IsMatrix && order(c1, c2) > 0);
+}
+
 void NAryExpressionNode::sortChildrenInPlace(ExpressionOrder order,
                                              Context* context,
                                              bool canSwapMatrices,
                                              bool canContainMatrices) {
   Expression reference(this);
   const int childrenCount = reference.numberOfChildren();
+  if (childrenCount > k_maxNumberOfMergeSortedChildren) {
+    bubbleSortChildrenInPlace(order, context, canSwapMatrices,
+                              canContainMatrices);
+    return;
+  }
+  /* Children are merge sorted through an array of their indexes, so that
+   * comparisons are not interleaved with tree moves. The sort is stable, so
+   * that it yields the same order as swapping adjacent children. */
+  ExpressionNode* nodes[k_maxNumberOfMergeSortedChildren];
+  bool isMatrix[k_maxNumberOfMergeSortedChildren];
+  uint8_t sorted[k_maxNumberOfMergeSortedChildren];
+  uint8_t buffer[k_maxNumberOfMergeSortedChildren];
+  int index = 0;
+  for (ExpressionNode* child : children()) {
+    nodes[index] = child;
+    isMatrix[index] =
+        Expression(child).deepIsMatrix(context, canContainMatrices);
+    sorted[index] = index;
+    index++;
+  }
+  for (int width = 1; width < childrenCount; width *= 2) {
+    for (int start = 0; start < childrenCount - width; start += 2 * width) {
+      int middle = start + width;
+      int end = std::min(start + 2 * width, childrenCount);
+      int left = start;
+      int right = middle;
+      for (int k = start; k < end; k++) {
+        if (left < middle &&
+            (right == end ||
+             !shouldSwap(nodes[sorted[left]], isMatrix[sorted[left]],
+                         nodes[sorted[right]], isMatrix[sorted[right]],
+                         order, canSwapMatrices))) {
+          buffer[k] = sorted[left++];
+        } else {
+          buffer[k] = sorted[right++];
+        }
+      }
+      memcpy(sorted + start, buffer + start, end - start);
+    }
+  }
+  /* Apply the permutation with at most one swap per child. buffer now maps
+   * each original child to its current position. */
+  uint8_t* positions = buffer;
+  uint8_t childAtPosition[k_maxNumberOfMergeSortedChildren];
+  for (int i = 0; i < childrenCount; i++) {
+    positions[i] = i;
+    childAtPosition[i] = i;
+  }
+  for (int i = 0; i < childrenCount; i++) {
+    int current = positions[sorted[i]];
+    if (current == i) {
+      continue;
+    }
+    reference.swapChildrenInPlace(i, current);
+    uint8_t displaced = childAtPosition[i];
+    childAtPosition[current] = displaced;
+    positions[displaced] = current;
+    childAtPosition[i] = sorted[i];
+    positions[sorted[i]] = i;
+  }
+}
+
+void NAryExpressionNode::bubbleSortChildrenInPlace(ExpressionOrder order,
+                                                   Context* context,
+                                                   bool canSwapMatrices,
+                                                   bool canContainMatrices) {
+  Expression reference(this);
+  const int childrenCount = reference.numberOfChildren();
   for (int i = 1; i < childrenCount; i++) {
     bool isSorted = true;
     for (int j = 0; j < childrenCount - 1; j++) {
-      /* Warning: Matrix operations are not always commutative (ie,
-       * multiplication) so we never swap 2 matrices. */
       ExpressionNode* cj = childAtIndex(j);
       ExpressionNode* cj1 = childAtIndex(j + 1);
       bool cjIsMatrix =
           Expression(cj).deepIsMatrix(context, canContainMatrices);
       bool cj1IsMatrix =
           Expression(cj1).deepIsMatrix(context, canContainMatrices);
-      bool cj1GreaterThanCj = order(cj, cj1) > 0;
-      if ((cjIsMatrix &&
-           !cj1IsMatrix) ||  // we always put matrices at the end of expressions
-          (cjIsMatrix && cj1IsMatrix && canSwapMatrices && cj1GreaterThanCj) ||
-          (!cjIsMatrix && !cj1IsMatrix && cj1GreaterThanCj)) {
+      if (shouldSwap(cj, cjIsMatrix, cj1, cj1IsMatrix, order,
+                     canSwapMatrices)) {
         reference.swapChildrenInPlace(j, j + 1);
         isSorted = false;
       }
@@ -0,0 +1,249 @@
+#include <assert.h>
+#include <float.h>
+#include <poincare/numeric_polynomial.h>
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Poincare {
+
+NumericPolynomial NumericPolynomial::FromExpression(
+    const Expression e, const char* symbol,
+    const ApproximationContext& approximationContext) {
+  int degree = e.polynomialDegree(approximationContext.context(), symbol);
+  if (degree < 0 || degree > k_maxDegree) {
+    return NumericPolynomial();
+  }
+  if (degree == 0) {
+    double constant = e.approximateToScalar<double>(approximationContext);
+    if (!std::isfinite(constant)) {
+      return NumericPolynomial();
+    }
+    return NumericPolynomial(&constant, 0);
+  }
+  switch (e.type()) {
+    case ExpressionNode::Type::Symbol: {
+      assert(strcmp(static_cast<const Symbol&>(e).name(), symbol) == 0);
+      constexpr double k_identity[] = {0., 1.};
+      return NumericPolynomial(k_identity, 1);
+    }
+    case ExpressionNode::Type::Addition:
+    case ExpressionNode::Type::Multiplication: {
+      bool isAddition = e.type() == ExpressionNode::Type::Addition;
+      NumericPolynomial result =
+          FromExpression(e.childAtIndex(0), symbol, approximationContext);
+      int n = e.numberOfChildren();
+      for (int i = 1; i < n && !result.isUndefined(); i++) {
+        NumericPolynomial child =
+            FromExpression(e.childAtIndex(i), symbol, approximationContext);
+        result = isAddition ? Sum(result, child) : Product(result, child);
+      }
+      return result;
+    }
+    case ExpressionNode::Type::Power: {
+      // polynomialDegree ensures that the index is a positive integer
+      Expression index = e.childAtIndex(1);
+      int n = static_cast<Rational&>(index)
+                  .unsignedIntegerNumerator()
+                  .extractedInt();
+      NumericPolynomial base =
+          FromExpression(e.childAtIndex(0), symbol, approximationContext);
+      NumericPolynomial result = base;
+      for (int i = 1; i < n && !result.isUndefined(); i++) {
+        result = Product(result, base);
+      }
+      return result;
+    }
+    default:
+      return NumericPolynomial();
+  }
+}
+
+NumericPolynomial::NumericPolynomial(const double* coefficients, int degree)
+    : m_degree(degree) {
+  assert(0 <= degree && degree <= k_maxDegree);
+  for (int i = 0; i <= degree; i++) {
+    m_coefficients[i] = coefficients[i];
+  }
+  trim(0.);
+}
+
+/* Error-free transformations of a sum and a product, see Graillat, Langlois
+ * and Louvet, "Compensated Horner scheme". */
+static void twoSum(double a, double b, double* sum, double* error) {
+  *sum = a + b;
+  double z = *sum - a;
+  *error = (a - (*sum - z)) + (b - z);
+}
+
+static void split(double a, double* high, double* low) {
+  constexpr double k_factor = 134217729.;  // 2^27 + 1
+  double c = k_factor * a;
+  *high = c - (c - a);
+  *low = a - *high;
+}
+
+static void twoProduct(double a, double b, double* product, double* error) {
+  *product = a * b;
+  double aHigh, aLow, bHigh, bLow;
+  split(a, &aHigh, &aLow);
+  split(b, &bHigh, &bLow);
+  *error = aLow * bLow -
+           (((*product - aHigh * bHigh) - aLow * bHigh) - aHigh * bLow);
+}
+
+double NumericPolynomial::evaluate(double x) const {
+  assert(!isUndefined());
+  double result = m_coefficients[m_degree];
+  double correction = 0.;
+  for (int i = m_degree - 1; i >= 0; i--) {
+    double product, productError, sumError;
+    twoProduct(result, x, &product, &productError);
+    twoSum(product, m_coefficients[i], &result, &sumError);
+    correction = correction * x + (productError + sumError);
+  }
+  return result + correction;
+}
+
+NumericPolynomial NumericPolynomial::derivative() const {
+  assert(!isUndefined());
+  if (m_degree == 0) {
+    constexpr double k_zero = 0.;
+    return NumericPolynomial(&k_zero, 0);
+  }
+  double coefficients[k_maxDegree];
+  for (int i = 1; i <= m_degree; i++) {
+    coefficients[i - 1] = i * m_coefficients[i];
+  }
+  return NumericPolynomial(coefficients, m_degree - 1);
+}
+
+int NumericPolynomial::realRoots(double min, double max, double* roots,
+                                 int maxNumberOfRoots) const {
+  assert(!isUndefined() && m_degree > 0 && min <= max);
+  if (m_degree == 1) {
+    double root = -m_coefficients[0] / m_coefficients[1];
+    if (maxNumberOfRoots > 0 && min <= root && root <= max) {
+      roots[0] = root;
+      return 1;
+    }
+    return 0;
+  }
+  /* Split [min, max] at the critical points inside it. The derivative has at
+   * most m_degree - 1 distinct roots. */
+  double criticalPoints[k_maxDegree];
+  int numberOfCriticalPoints =
+      derivative().realRoots(min, max, criticalPoints, k_maxDegree);
+  double points[k_maxDegree + 1];
+  int numberOfPoints = 0;
+  points[numberOfPoints++] = min;
+  for (int i = 0; i < numberOfCriticalPoints; i++) {
+    if (min < criticalPoints[i] && criticalPoints[i] < max) {
+      points[numberOfPoints++] = criticalPoints[i];
+    }
+  }
+  if (min < max) {
+    points[numberOfPoints++] = max;
+  }
+
+  int numberOfRoots = 0;
+  double previousValue = NAN;
+  bool previousIsRoot = false;
+  for (int i = 0; i < numberOfPoints && numberOfRoots < maxNumberOfRoots;
+       i++) {
+    double value = evaluate(points[i]);
+    /* Only critical points can be multiple roots. The ends of the interval are
+     * only roots if this vanishes there, so that roots right outside of the
+     * interval are not found. */
+    bool isRoot = i == 0 || i == numberOfPoints - 1
+                      ? value == 0.
+                      : std::fabs(value) <= roundingErrorBound(points[i]);
+    if (i > 0 && !isRoot && !previousIsRoot &&
+        (previousValue < 0.) != (value < 0.)) {
+      roots[numberOfRoots++] = rootBetween(points[i - 1], points[i]);
+    }
+    if (isRoot && numberOfRoots < maxNumberOfRoots) {
+      roots[numberOfRoots++] = points[i];
+    }
+    previousValue = value;
+    previousIsRoot = isRoot;
+  }
+  return numberOfRoots;
+}
+
+NumericPolynomial NumericPolynomial::Product(const NumericPolynomial& p1,
+                                             const NumericPolynomial& p2) {
+  if (p1.isUndefined() || p2.isUndefined() ||
+      p1.m_degree + p2.m_degree > k_maxDegree) {
+    return NumericPolynomial();
+  }
+  double coefficients[k_maxDegree + 1];
+  int degree = p1.m_degree + p2.m_degree;
+  for (int i = 0; i <= degree; i++) {
+    coefficients[i] = 0.;
+  }
+  for (int i = 0; i <= p1.m_degree; i++) {
+    for (int j = 0; j <= p2.m_degree; j++) {
+      coefficients[i + j] += p1.m_coefficients[i] * p2.m_coefficients[j];
+    }
+  }
+  return NumericPolynomial(coefficients, degree);
+}
+
+NumericPolynomial NumericPolynomial::Sum(const NumericPolynomial& p1,
+                                         const NumericPolynomial& p2) {
+  if (p1.isUndefined() || p2.isUndefined()) {
+    return NumericPolynomial();
+  }
+  double coefficients[k_maxDegree + 1];
+  int degree = std::max(p1.m_degree, p2.m_degree);
+  for (int i = 0; i <= degree; i++) {
+    coefficients[i] = (i <= p1.m_degree ? p1.m_coefficients[i] : 0.) +
+                      (i <= p2.m_degree ? p2.m_coefficients[i] : 0.);
+  }
+  return NumericPolynomial(coefficients, degree);
+}
+
+double NumericPolynomial::roundingErrorBound(double x) const {
+  /* Coefficients are rounded a few times each when the polynomial is built,
+   * which amounts to relative errors of about m_degree * DBL_EPSILON. */
+  double result = 0.;
+  for (int i = m_degree; i >= 0; i--) {
+    result = result * std::fabs(x) + std::fabs(m_coefficients[i]);
+  }
+  return m_degree * DBL_EPSILON * result;
+}
+
+double NumericPolynomial::rootBetween(double left, double right) const {
+  bool leftIsNegative = evaluate(left) < 0.;
+  while (true) {
+    // Split at 0 first so that null roots are exactly found
+    double middle = left < 0. && right > 0. ? 0. : left + (right - left) / 2.;
+    if (middle <= left || middle >= right) {
+      return right;
+    }
+    double value = evaluate(middle);
+    if (value == 0.) {
+      return middle;
+    }
+    if ((value < 0.) == leftIsNegative) {
+      left = middle;
+    } else {
+      right = middle;
+    }
+  }
+}
+
+void NumericPolynomial::trim(double threshold) {
+  while (m_degree > 0 && std::fabs(m_coefficients[m_degree]) <= threshold) {
+    m_degree--;
+  }
+  if (m_degree == 0 && std::fabs(m_coefficients[0]) <= threshold) {
+    m_coefficients[0] = 0.;
+  }
+}
+
+}  // namespace Poincare
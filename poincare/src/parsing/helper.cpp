@@ -1,5 +1,7 @@
 #include "helper.h"
 
+#include <algorithm>
+
 namespace Poincare {
 
 const Expression::FunctionHelper* const* ParsingHelper::GetReservedFunction(
@@ -119,6 +121,60 @@ const ParsingHelper::IdentifierBuilder ParsingHelper::GetIdentifierBuilder(
   return s_specialIdentifiers[identifierIndex].identifierBuilder;
 }
 
+static size_t MaxLengthOfAliases(AliasesList aliasesList, size_t maxLength) {
+  for (const char* alias : aliasesList) {
+    maxLength = std::max(maxLength, strlen(alias));
+  }
+  return maxLength;
+}
+
+static size_t MaxLengthOfConstantsAndUnits() {
+  /* Logical operators and the theta aliases are shorter than symbol names. */
+  size_t result = SymbolAbstractNode::k_maxNameLength;
+  for (const ConstantNode::ConstantInfo& constant : ConstantNode::k_constants) {
+    result = MaxLengthOfAliases(constant.m_aliasesList, result);
+  }
+  size_t maxPrefixLength = 0;
+  for (int i = 0; i < UnitNode::Prefix::k_numberOfPrefixes; i++) {
+    maxPrefixLength = std::max(maxPrefixLength,
+                               strlen(UnitNode::Prefix::Prefixes()[i].symbol()));
+  }
+  size_t maxRootSymbolLength = 0;
+  for (int i = 0; i < UnitNode::Representative::k_numberOfDimensions; i++) {
+    const UnitNode::Representative* representatives =
+        UnitNode::Representative::DefaultRepresentatives()[i]
+            ->representativesOfSameDimension();
+    int numberOfRepresentatives =
+        UnitNode::Representative::DefaultRepresentatives()[i]
+            ->numberOfRepresentatives();
+    for (int j = 0; j < numberOfRepresentatives; j++) {
+      maxRootSymbolLength = MaxLengthOfAliases(
+          representatives[j].rootSymbols(), maxRootSymbolLength);
+    }
+  }
+  // Units can be written with a leading underscore
+  return std::max(result, 1 + maxPrefixLength + maxRootSymbolLength);
+}
+
+size_t ParsingHelper::MaxLengthOfNamedIdentifier() {
+  static size_t s_maxLength = 0;
+  if (s_maxLength == 0) {
+    size_t maxLength = MaxLengthOfConstantsAndUnits();
+    for (const Expression::FunctionHelper* const* reservedFunction =
+             s_reservedFunctions;
+         reservedFunction < s_reservedFunctionsUpperBound; reservedFunction++) {
+      maxLength =
+          MaxLengthOfAliases((**reservedFunction).aliasesList(), maxLength);
+    }
+    for (int i = 0; i < k_numberOfSpecialIdentifiers; i++) {
+      maxLength = MaxLengthOfAliases(
+          s_specialIdentifiers[i].identifierAliasesList, maxLength);
+    }
+    s_maxLength = maxLength;
+  }
+  return s_maxLength;
+}
+
 int ParsingHelper::SpecialIdentifierIndexForName(const char* name,
                                                  size_t nameLength) {
   for (int i = 0; i < k_numberOfSpecialIdentifiers; i++) {
@@ -24,6 +24,10 @@ class ParsingHelper {
     return s_reservedFunctionsUpperBound;
   }
   static bool IsSpecialIdentifierName(const char *name, size_t nameLength);
+  /* Length in bytes of the longest identifier that can be recognized from its
+   * name alone: reserved functions, special identifiers, constants, units and
+   * user defined symbols. */
+  static size_t MaxLengthOfNamedIdentifier();
   static bool IsLogicalOperator(const char *name, size_t nameLength,
                                 Token::Type *returnType);
   static bool IsParameteredExpression(const Expression::FunctionHelper *helper);
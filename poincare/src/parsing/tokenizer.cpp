@@ -371,7 +371,9 @@ Token Tokenizer::popLongestRightmostIdentifier(const char* stringStart,
   while (tokenType == Token::Type::Undefined && nextTokenStart < *stringEnd) {
     stringStart = nextTokenStart;
     tokenLength = *stringEnd - stringStart;
-    tokenType = stringTokenType(stringStart, &tokenLength);
+    if (lengthCanBeIdentifier(stringStart, tokenLength)) {
+      tokenType = stringTokenType(stringStart, &tokenLength);
+    }
     if (m_poppingSystemToken && tokenType == Token::Type::Undefined) {
       /* Never break up a system identifier into pieces ; it should either be
        * recognized or throw a syntax error. */
@@ -396,6 +398,31 @@ Token Tokenizer::popLongestRightmostIdentifier(const char* stringStart,
   return result;
 }
 
+bool Tokenizer::lengthCanBeIdentifier(const char* string,
+                                      size_t length) const {
+  /* Most identifiers are recognized from their name alone, which can't be
+   * longer than the longest reserved name or symbol name. Skipping the longer
+   * candidates bounds the work done on long strings such as "abcdefghij".
+   * Only forced custom identifiers, identifiers of an assignment or without
+   * context, and names followed by digits such as "log10" or "x12" can be
+   * longer. */
+  size_t maxLength = ParsingHelper::MaxLengthOfNamedIdentifier();
+  if (length <= maxLength || string[0] == '"' || m_poppingSystemToken ||
+      m_parsingContext->parsingMethod() ==
+          ParsingContext::ParsingMethod::Assignment ||
+      m_parsingContext->context() == nullptr) {
+    return true;
+  }
+  /* Digits are ASCII, so they can be looked for byte per byte. The name
+   * preceding them can't be longer than maxLength. */
+  for (size_t i = 1; i <= maxLength; i++) {
+    if ('0' <= string[i] && string[i] <= '9') {
+      return true;
+    }
+  }
+  return false;
+}
+
 static bool stringIsACodePointFollowedByNumbers(const char* string,
                                                 size_t length) {
   UTF8Decoder tempDecoder(string);
@@ -129,6 +129,7 @@ class Tokenizer {
   void fillIdentifiersList();
   Token popLongestRightmostIdentifier(const char* stringStart,
                                       const char** stringEnd);
+  bool lengthCanBeIdentifier(const char* string, size_t length) const;
   Token::Type stringTokenType(const char* string, size_t* length) const;
 
   /* ========== IMPLICIT ADDITION BETWEEN UNITS ==========
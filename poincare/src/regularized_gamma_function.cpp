@@ -89,17 +89,21 @@ bool InfiniteSeriesEvaluation(double firstTerm, TermUpdater termUpdater,
   return true;
 }
 
-double RegularizedGammaFunction(double s, double x, double epsilon,
-                                int maxNumberOfIterations, double* result) {
+/* Each representation computes one of the lower and upper regularized gamma
+ * functions directly. The other one is deduced by complementing to 1, which
+ * loses precision when the result is tiny. */
+static bool RegularizedGamma(double s, double x, double epsilon,
+                             int maxNumberOfIterations, bool upper,
+                             double* result) {
   // TODO Put interruption instead of maxNumberOfIterations
 
   assert(!std::isnan(s) && !std::isnan(x) && s > 0.0 && x >= 0.0);
   if (x == 0.0) {
-    *result = 0.0;
+    *result = upper ? 1.0 : 0.0;
     return true;
   }
   if (std::isinf(x)) {
-    *result = 1.0;
+    *result = upper ? 0.0 : 1.0;
     return true;
   }
   if (x >= s + 1.0) {
@@ -143,8 +147,9 @@ double RegularizedGammaFunction(double s, double x, double epsilon,
             maxNumberOfIterations, &continuedFractionValue, s, x)) {
       return false;
     }
-    *result = 1.0 - std::exp(-x + s * std::log(x) - std::lgamma(s)) *
+    double upperValue = std::exp(-x + s * std::log(x) - std::lgamma(s)) *
                         (1.0 / continuedFractionValue);
+    *result = upper ? upperValue : 1.0 - upperValue;
     return true;
   }
 
@@ -160,11 +165,22 @@ double RegularizedGammaFunction(double s, double x, double epsilon,
           0.0)) {
     return false;
   }
-  *result = std::isinf(infiniteSeriesValue)
-                ? 1.0
-                : std::exp(-x + s * std::log(x) - std::lgamma(s)) *
-                      infiniteSeriesValue;
+  double lowerValue = std::isinf(infiniteSeriesValue)
+                          ? 1.0
+                          : std::exp(-x + s * std::log(x) - std::lgamma(s)) *
+                                infiniteSeriesValue;
+  *result = upper ? 1.0 - lowerValue : lowerValue;
   return true;
 }
 
+bool RegularizedGammaFunction(double s, double x, double epsilon,
+                              int maxNumberOfIterations, double* result) {
+  return RegularizedGamma(s, x, epsilon, maxNumberOfIterations, false, result);
+}
+
+bool RegularizedUpperGammaFunction(double s, double x, double epsilon,
+                                   int maxNumberOfIterations, double* result) {
+  return RegularizedGamma(s, x, epsilon, maxNumberOfIterations, true, result);
+}
+
 }  // namespace Poincare
@@ -0,0 +1,242 @@
+#include <assert.h>
+#include <poincare/rational.h>
+#include <poincare/rewriting_rules.h>
+#include <poincare/undefined.h>
+#include <string.h>
+
+#if POINCARE_TREE_LOG
+#include <algorithm>
+#include <chrono>
+#endif
+
+namespace Poincare {
+
+bool PatternSymbol::matches(const Expression e) const {
+  switch (m_kind) {
+    case Kind::Any:
+      return true;
+    case Kind::Type:
+      return e.type() == m_type;
+    case Kind::Zero:
+      return e.isZero();
+    default:
+      assert(m_kind == Kind::One);
+      return e.isOne();
+  }
+}
+
+const RewritingRule RewritingRules::k_rules[k_numberOfRules] = {
+    // log(x,0) = log(x,1) = undef
+    {.name = "log(x,0)",
+     .type = ExpressionNode::Type::Logarithm,
+     .numberOfChildren = 2,
+     .children = {PatternSymbol::Any(), PatternSymbol::Zero()},
+     .condition = nullptr,
+     .rewrite = [](Expression e, const ReductionContext&) {
+       return e.replaceWithUndefinedInPlace();
+     }},
+    {.name = "log(x,1)",
+     .type = ExpressionNode::Type::Logarithm,
+     .numberOfChildren = 2,
+     .children = {PatternSymbol::Any(), PatternSymbol::One()},
+     .condition = nullptr,
+     .rewrite = [](Expression e, const ReductionContext&) {
+       return e.replaceWithUndefinedInPlace();
+     }},
+    // log(0,x) = undef
+    {.name = "log(0,x)",
+     .type = ExpressionNode::Type::Logarithm,
+     .numberOfChildren = 2,
+     .children = {PatternSymbol::Zero(), PatternSymbol::Any()},
+     .condition =
+         [](const Expression e) {
+           return e.childAtIndex(0).type() == ExpressionNode::Type::Rational;
+         },
+     .rewrite = [](Expression e, const ReductionContext&) {
+       return e.replaceWithUndefinedInPlace();
+     }},
+    // log(1,x) = 0
+    {.name = "log(1,x)",
+     .type = ExpressionNode::Type::Logarithm,
+     .numberOfChildren = 2,
+     .children = {PatternSymbol::One(), PatternSymbol::Any()},
+     .condition =
+         [](const Expression e) {
+           return e.childAtIndex(0).type() == ExpressionNode::Type::Rational;
+         },
+     .rewrite =
+         [](Expression e, const ReductionContext&) {
+           Expression result = Rational::Builder(0);
+           e.replaceWithInPlace(result);
+           return result;
+         }},
+    // log(x,x) = 1 with x != inf, and log(inf,inf) = undef
+    {.name = "log(x,x)",
+     .type = ExpressionNode::Type::Logarithm,
+     .numberOfChildren = 2,
+     .children = {PatternSymbol::Any(), PatternSymbol::Any()},
+     .condition =
+         [](const Expression e) {
+           return e.childAtIndex(0).isIdenticalTo(e.childAtIndex(1));
+         },
+     .rewrite =
+         [](Expression e, const ReductionContext& reductionContext) {
+           Expression result =
+               e.childAtIndex(0).recursivelyMatches(Expression::IsInfinity,
+                                                    reductionContext.context())
+                   ? Undefined::Builder().convert<Expression>()
+                   : Rational::Builder(1).convert<Expression>();
+           e.replaceWithInPlace(result);
+           return result;
+         }},
+};
+
+/* The discrimination tree has one level per symbol of the patterns: the type
+ * of the reduced node, then the symbols of its children. Its nodes are the
+ * prefixes shared by the patterns, and each leaf holds the rules whose pattern
+ * ends there. The root is the empty prefix. */
+struct IndexNode {
+  PatternSymbol symbol;
+  int16_t firstChild;
+  int16_t nextSibling;
+  uint32_t rules;
+};
+
+constexpr static int k_maxNumberOfIndexNodes =
+    1 + RewritingRules::NumberOfRules() *
+            (1 + RewritingRule::k_maxNumberOfChildren);
+static IndexNode s_index[k_maxNumberOfIndexNodes];
+static int s_numberOfIndexNodes = 0;
+static RewritingRules::Statistics s_statistics[RewritingRules::NumberOfRules()];
+
+static int childWithSymbol(int parent, PatternSymbol symbol) {
+  int child = s_index[parent].firstChild;
+  while (child >= 0 && !s_index[child].symbol.isIdenticalTo(symbol)) {
+    child = s_index[child].nextSibling;
+  }
+  if (child < 0) {
+    assert(s_numberOfIndexNodes < k_maxNumberOfIndexNodes);
+    child = s_numberOfIndexNodes++;
+    s_index[child] = {.symbol = symbol,
+                      .firstChild = -1,
+                      .nextSibling = s_index[parent].firstChild,
+                      .rules = 0};
+    s_index[parent].firstChild = child;
+  }
+  return child;
+}
+
+/* Collect the rules whose pattern matches e, from the node matching the
+ * symbols of e's first numberOfMatchedChildren children. */
+static uint32_t matchingRules(int node, const Expression e,
+                              int numberOfMatchedChildren) {
+  if (numberOfMatchedChildren == e.numberOfChildren()) {
+    return s_index[node].rules;
+  }
+  Expression child = e.childAtIndex(numberOfMatchedChildren);
+  uint32_t rules = 0;
+  for (int c = s_index[node].firstChild; c >= 0; c = s_index[c].nextSibling) {
+    if (s_index[c].symbol.matches(child)) {
+      rules |= matchingRules(c, e, numberOfMatchedChildren + 1);
+    }
+  }
+  return rules;
+}
+
+#if POINCARE_TREE_LOG
+static uint64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+#endif
+
+Expression RewritingRules::Apply(Expression e,
+                                 const ReductionContext& reductionContext) {
+  if (s_numberOfIndexNodes == 0) {
+    s_index[0] = {.symbol = PatternSymbol::Any(),
+                  .firstChild = -1,
+                  .nextSibling = -1,
+                  .rules = 0};
+    s_numberOfIndexNodes = 1;
+    for (int i = 0; i < k_numberOfRules; i++) {
+      const RewritingRule& rule = k_rules[i];
+      assert(rule.numberOfChildren <= RewritingRule::k_maxNumberOfChildren);
+      int node = childWithSymbol(0, PatternSymbol::OfType(rule.type));
+      for (int j = 0; j < rule.numberOfChildren; j++) {
+        node = childWithSymbol(node, rule.children[j]);
+      }
+      s_index[node].rules |= static_cast<RuleSet>(1) << i;
+    }
+  }
+
+  RuleSet rules = 0;
+  for (int c = s_index[0].firstChild; c >= 0; c = s_index[c].nextSibling) {
+    if (s_index[c].symbol.matches(e)) {
+      rules |= matchingRules(c, e, 0);
+    }
+  }
+  for (int i = 0; rules != 0; i++, rules >>= 1) {
+    if (!(rules & 1)) {
+      continue;
+    }
+    const RewritingRule& rule = k_rules[i];
+    Statistics* statistics = s_statistics + i;
+    statistics->numberOfTries++;
+#if POINCARE_TREE_LOG
+    uint64_t startTime = now();
+#endif
+    bool matches = rule.condition == nullptr || rule.condition(e);
+    Expression result =
+        matches ? rule.rewrite(e, reductionContext) : Expression();
+#if POINCARE_TREE_LOG
+    statistics->duration += now() - startTime;
+#endif
+    if (matches) {
+      statistics->numberOfHits++;
+      return result;
+    }
+  }
+  return Expression();
+}
+
+int RewritingRules::IndexOfRule(const char* name) {
+  for (int i = 0; i < k_numberOfRules; i++) {
+    if (strcmp(k_rules[i].name, name) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+const RewritingRules::Statistics& RewritingRules::StatisticsOfRule(
+    int index) {
+  assert(0 <= index && index < k_numberOfRules);
+  return s_statistics[index];
+}
+
+void RewritingRules::ResetStatistics() {
+  for (Statistics& statistics : s_statistics) {
+    statistics = Statistics();
+  }
+}
+
+#if POINCARE_TREE_LOG
+void RewritingRules::Log(std::ostream& stream) {
+  int rules[k_numberOfRules];
+  for (int i = 0; i < k_numberOfRules; i++) {
+    rules[i] = i;
+  }
+  std::sort(rules, rules + k_numberOfRules, [](int i, int j) {
+    return s_statistics[i].duration > s_statistics[j].duration;
+  });
+  for (int i : rules) {
+    const Statistics& statistics = s_statistics[i];
+    stream << k_rules[i].name << ": " << statistics.numberOfHits << "/"
+           << statistics.numberOfTries << " applied, " << statistics.duration
+           << " ns\n";
+  }
+}
+#endif
+
+}  // namespace Poincare
@@ -1,5 +1,8 @@
 #include <poincare/solver_algorithms.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace Poincare {
 
 Coordinate2D<double> SolverAlgorithms::IncreasingFunctionRoot(
@@ -110,6 +113,58 @@ T SolverAlgorithms::CumulativeDistributiveFunctionForNDefinedFunction(
   return result;
 }
 
+template <typename T>
+T SolverAlgorithms::CumulativeDistributiveInverseForNDefinedCumulativeFunction(
+    T* probability, typename Solver<T>::FunctionEvaluation cumulative,
+    const void* aux) {
+  constexpr T precision = Float<T>::Epsilon();
+  assert(*probability <= (static_cast<T>(1.f) - precision) &&
+         *probability >= precision);
+
+  /* Look for the first integer whose cumulative reaches the probability. As
+   * in CumulativeDistributiveInverseForNDefinedFunction, a cumulative close
+   * enough to the probability is considered an exact match, so that
+   * approximation errors do not miss the exact result by one. */
+  T target = std::min(*probability - std::sqrt(precision),
+                      static_cast<T>(k_maxProbability));
+  // Beyond 1/precision, consecutive integers cannot be told apart
+  constexpr T maxAbscissa = static_cast<T>(1.f) / precision;
+
+  // Bracket the result in ]lower, upper] by doubling upper
+  T lower = static_cast<T>(-1.f);
+  T upper = static_cast<T>(0.f);
+  T cumulativeAtUpper = cumulative(upper, aux);
+  while (!(cumulativeAtUpper >= target)) {
+    if (std::isnan(cumulativeAtUpper)) {
+      return NAN;
+    }
+    lower = upper;
+    upper = std::max(static_cast<T>(1.f), static_cast<T>(2.f) * upper);
+    if (upper > maxAbscissa) {
+      *probability = static_cast<T>(1.f);
+      return INFINITY;
+    }
+    cumulativeAtUpper = cumulative(upper, aux);
+  }
+
+  // Bisect
+  while (upper - lower > static_cast<T>(1.f)) {
+    T middle = std::floor((lower + upper) / static_cast<T>(2.f));
+    T cumulativeAtMiddle = cumulative(middle, aux);
+    if (std::isnan(cumulativeAtMiddle)) {
+      return NAN;
+    }
+    if (cumulativeAtMiddle >= target) {
+      upper = middle;
+      cumulativeAtUpper = cumulativeAtMiddle;
+    } else {
+      lower = middle;
+    }
+  }
+  *probability = cumulativeAtUpper;
+  return upper;
+}
+
 Coordinate2D<double> SolverAlgorithms::BrentRoot(
     Solver<double>::FunctionEvaluation f, const void* aux, double xMin,
     double xMax, Solver<double>::Interest interest, double precision) {
@@ -314,4 +369,12 @@ SolverAlgorithms::CumulativeDistributiveFunctionForNDefinedFunction(
 template double
 SolverAlgorithms::CumulativeDistributiveFunctionForNDefinedFunction(
     double x, Solver<double>::FunctionEvaluation f, const void* aux);
+template float
+SolverAlgorithms::CumulativeDistributiveInverseForNDefinedCumulativeFunction(
+    float* probability, Solver<float>::FunctionEvaluation cumulative,
+    const void* aux);
+template double
+SolverAlgorithms::CumulativeDistributiveInverseForNDefinedCumulativeFunction(
+    double* probability, Solver<double>::FunctionEvaluation cumulative,
+    const void* aux);
 }  // namespace Poincare
@@ -1,4 +1,5 @@
 #include <escher/metric.h>
+#include <ion/crc.h>
 #include <ion/unicode/utf8_helper.h>
 #include <poincare/layout_helper.h>
 #include <poincare/string_layout.h>
@@ -33,6 +34,14 @@ bool StringLayoutNode::protectedIsIdenticalTo(Layout l) {
                  std::max(stringLength() + 1, sl.stringLength() + 1)) == 0;
 }
 
+void StringLayoutNode::signContent(Signature *signature) const {
+  // The null termination ends the string in the signature
+  const char *c = m_string;
+  do {
+    signature->append(static_cast<uint8_t>(*c));
+  } while (*c++ != 0);
+}
+
 // Sizing and positioning
 KDSize StringLayoutNode::computeSize(KDFont::Size font) {
   KDSize glyph = KDFont::GlyphSize(font);
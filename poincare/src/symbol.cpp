@@ -2,6 +2,7 @@
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/unicode/utf8_helper.h>
 #include <poincare/code_point_layout.h>
+#include <poincare/complex.h>
 #include <poincare/context.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/layout_helper.h>
@@ -95,14 +96,28 @@ template <typename T>
 Evaluation<T> SymbolNode::templatedApproximate(
     const ApproximationContext& approximationContext) const {
   Symbol s(this);
+  Context* context = approximationContext.context();
+  constexpr bool doublePrecision = sizeof(T) == sizeof(double);
+  std::complex<double> cachedValue;
+  if (context && context->approximationForSymbol(s, approximationContext,
+                                                 doublePrecision,
+                                                 &cachedValue)) {
+    return Complex<T>::Builder(static_cast<std::complex<T>>(cachedValue));
+  }
   // No need to preserve undefined symbols because they will be approximated.
   Expression e = SymbolAbstract::Expand(
-      s, approximationContext.context(), true,
+      s, context, true,
       SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
   if (e.isUninitialized()) {
     return Complex<T>::Undefined();
   }
-  return e.node()->approximate(T(), approximationContext);
+  Evaluation<T> result = e.node()->approximate(T(), approximationContext);
+  if (context && result.type() == EvaluationNode<T>::Type::Complex) {
+    context->setApproximationForSymbol(s, approximationContext,
+                                       doublePrecision,
+                                       result.complexAtIndex(0));
+  }
+  return result;
 }
 
 bool SymbolNode::isSystemSymbol() const {
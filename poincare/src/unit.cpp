@@ -1129,6 +1129,100 @@ Unit Unit::Builder(const Unit::Representative* representative,
   return static_cast<Unit&>(h);
 }
 
+/* Parsing a unit used to try every root symbol of every representative. Root
+ * symbols are instead indexed once, sorted alphabetically, so that a symbol is
+ * parsed by looking its root up for each possible prefix length. Entries keep
+ * their rank in the representatives order to resolve ambiguities the same way
+ * as a linear scan would. */
+struct RootSymbolEntry {
+  const char* rootSymbol;
+  const UnitNode::Representative* representative;
+  int rank;
+};
+
+/* Every dimension's representatives, in the order of DefaultRepresentatives.
+ * Speed has no representatives of its own. The index is both sized and
+ * filled from this single list, so it can never overflow. */
+template <typename F>
+constexpr static auto ForEachRepresentativesTable(F f) {
+  return f(
+      Unit::k_timeRepresentatives, Unit::k_distanceRepresentatives,
+      Unit::k_angleRepresentatives, Unit::k_massRepresentatives,
+      Unit::k_currentRepresentatives, Unit::k_temperatureRepresentatives,
+      Unit::k_amountOfSubstanceRepresentatives,
+      Unit::k_luminousIntensityRepresentatives,
+      Unit::k_frequencyRepresentatives, Unit::k_forceRepresentatives,
+      Unit::k_pressureRepresentatives, Unit::k_energyRepresentatives,
+      Unit::k_powerRepresentatives, Unit::k_electricChargeRepresentatives,
+      Unit::k_electricPotentialRepresentatives,
+      Unit::k_electricCapacitanceRepresentatives,
+      Unit::k_electricResistanceRepresentatives,
+      Unit::k_electricConductanceRepresentatives,
+      Unit::k_magneticFluxRepresentatives,
+      Unit::k_magneticFieldRepresentatives, Unit::k_inductanceRepresentatives,
+      Unit::k_catalyticActivityRepresentatives,
+      Unit::k_surfaceRepresentatives, Unit::k_volumeRepresentatives);
+}
+
+template <typename T, size_t N>
+constexpr static int NumberOfRootSymbols(const T (&representatives)[N]) {
+  int result = 0;
+  for (size_t i = 0; i < N; i++) {
+    result += representatives[i].rootSymbols().numberOfAliases();
+  }
+  return result;
+}
+
+constexpr static int k_numberOfRootSymbols =
+    ForEachRepresentativesTable([](const auto&... representatives) {
+      return (NumberOfRootSymbols(representatives) + ...);
+    });
+static_assert(Unit::Representative::k_numberOfDimensions == 25,
+              "ForEachRepresentativesTable must list the representatives of "
+              "every dimension");
+static RootSymbolEntry s_rootSymbolsIndex[k_numberOfRootSymbols];
+static int s_numberOfRootSymbols = 0;
+static size_t s_maxPrefixLength = 0;
+
+static bool rootSymbolEntryIsBefore(const RootSymbolEntry& entry1,
+                                    const RootSymbolEntry& entry2) {
+  int comparison = strcmp(entry1.rootSymbol, entry2.rootSymbol);
+  return comparison < 0 || (comparison == 0 && entry1.rank < entry2.rank);
+}
+
+template <typename T, size_t N>
+static void AddRootSymbols(const T (&representatives)[N],
+                           int* numberOfRootSymbols) {
+  for (size_t i = 0; i < N; i++) {
+    for (const char* rootSymbol : representatives[i].rootSymbols()) {
+      s_rootSymbolsIndex[*numberOfRootSymbols] = {
+          .rootSymbol = rootSymbol,
+          .representative = representatives + i,
+          .rank = *numberOfRootSymbols};
+      (*numberOfRootSymbols)++;
+    }
+  }
+}
+
+static void buildRootSymbolsIndexIfNeeded() {
+  if (s_numberOfRootSymbols > 0) {
+    return;
+  }
+  for (int i = 0; i < UnitNode::Prefix::k_numberOfPrefixes; i++) {
+    s_maxPrefixLength = std::max(
+        s_maxPrefixLength, strlen(UnitNode::Prefix::Prefixes()[i].symbol()));
+  }
+  int numberOfRootSymbols = 0;
+  ForEachRepresentativesTable([&](const auto&... representatives) {
+    (AddRootSymbols(representatives, &numberOfRootSymbols), ...);
+    return 0;
+  });
+  assert(numberOfRootSymbols == k_numberOfRootSymbols);
+  std::sort(s_rootSymbolsIndex, s_rootSymbolsIndex + numberOfRootSymbols,
+            rootSymbolEntryIsBefore);
+  s_numberOfRootSymbols = numberOfRootSymbols;
+}
+
 bool Unit::CanParse(const char* symbol, size_t length,
                     const Unit::Representative** representative,
                     const Unit::Prefix** prefix) {
@@ -1136,13 +1230,47 @@ bool Unit::CanParse(const char* symbol, size_t length,
     symbol++;
     length--;
   }
-  for (int i = 0; i < Representative::k_numberOfDimensions; i++) {
-    if (Representative::DefaultRepresentatives()[i]->canParseWithEquivalents(
-            symbol, length, representative, prefix)) {
-      return true;
+  buildRootSymbolsIndexIfNeeded();
+  const RootSymbolEntry* const indexStart = s_rootSymbolsIndex;
+  const RootSymbolEntry* const indexEnd = indexStart + s_numberOfRootSymbols;
+  const RootSymbolEntry* bestEntry = nullptr;
+  const Prefix* bestPrefix = nullptr;
+  for (size_t prefixLength = 0;
+       prefixLength <= s_maxPrefixLength && prefixLength < length;
+       prefixLength++) {
+    const char* root = symbol + prefixLength;
+    size_t rootLength = length - prefixLength;
+    /* Find the first entry whose root symbol is not before root. Root symbols
+     * equal to root are then sorted by rank. */
+    const RootSymbolEntry* entry = std::lower_bound(
+        indexStart, indexEnd, root,
+        [rootLength](const RootSymbolEntry& e, const char* r) {
+          return strncmp(e.rootSymbol, r, rootLength) < 0;
+        });
+    for (; entry < indexEnd &&
+           strncmp(entry->rootSymbol, root, rootLength) == 0 &&
+           entry->rootSymbol[rootLength] == 0 &&
+           (!bestEntry || entry->rank < bestEntry->rank);
+         entry++) {
+      const Prefix* entryPrefix;
+      if (entry->representative->canParse(symbol, prefixLength,
+                                          &entryPrefix)) {
+        bestEntry = entry;
+        bestPrefix = entryPrefix;
+        break;
+      }
     }
   }
-  return false;
+  if (!bestEntry) {
+    return false;
+  }
+  if (representative) {
+    *representative = bestEntry->representative;
+  }
+  if (prefix) {
+    *prefix = bestPrefix;
+  }
+  return true;
 }
 
 static void chooseBestRepresentativeAndPrefixForValueOnSingleUnit(
@@ -24,7 +24,7 @@ Context::SymbolAbstractType VariableContext::expressionTypeForIdentifier(
 
 bool VariableContext::setExpressionForSymbolAbstract(
     const Expression& expression, const SymbolAbstract& symbol) {
-  if (m_name != nullptr && strcmp(symbol.name(), m_name) == 0) {
+  if (definesSymbol(symbol)) {
     assert(symbol.type() == ExpressionNode::Type::Symbol);
     if (expression.isUninitialized()) {
       return false;
@@ -38,7 +38,7 @@ bool VariableContext::setExpressionForSymbolAbstract(
 const Expression VariableContext::protectedExpressionForSymbolAbstract(
     const SymbolAbstract& symbol, bool clone,
     ContextWithParent* lastDescendantContext) {
-  if (m_name != nullptr && strcmp(symbol.name(), m_name) == 0) {
+  if (definesSymbol(symbol)) {
     if (symbol.type() == ExpressionNode::Type::Symbol) {
       return clone ? m_value.clone() : m_value;
     }
@@ -48,6 +48,26 @@ const Expression VariableContext::protectedExpressionForSymbolAbstract(
       symbol, clone, lastDescendantContext);
 }
 
+bool VariableContext::approximationForSymbol(
+    const SymbolAbstract& symbol,
+    const ApproximationContext& approximationContext, bool doublePrecision,
+    std::complex<double>* value) {
+  // The value of the variable changes too often to be worth caching
+  return !definesSymbol(symbol) &&
+         ContextWithParent::approximationForSymbol(
+             symbol, approximationContext, doublePrecision, value);
+}
+
+void VariableContext::setApproximationForSymbol(
+    const SymbolAbstract& symbol,
+    const ApproximationContext& approximationContext, bool doublePrecision,
+    std::complex<double> value) {
+  if (!definesSymbol(symbol)) {
+    ContextWithParent::setApproximationForSymbol(symbol, approximationContext,
+                                                 doublePrecision, value);
+  }
+}
+
 template void VariableContext::setApproximationForVariable(float);
 template void VariableContext::setApproximationForVariable(double);
 
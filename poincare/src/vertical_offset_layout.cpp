@@ -213,6 +213,12 @@ KDCoordinate VerticalOffsetLayoutNode::baseBaseline(KDFont::Size font) {
                       : EmptyRectangle::RectangleBaseLine(font);
 }
 
+void VerticalOffsetLayoutNode::signContent(Signature *signature) const {
+  signature->append(static_cast<uint32_t>(m_verticalPosition));
+  signature->append(static_cast<uint32_t>(m_horizontalPosition));
+  signature->append(static_cast<uint32_t>(m_emptyBaseVisibility));
+}
+
 bool VerticalOffsetLayoutNode::protectedIsIdenticalTo(Layout l) {
   assert(l.type() == Type::VerticalOffsetLayout);
   VerticalOffsetLayoutNode *n =
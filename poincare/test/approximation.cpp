@@ -1735,6 +1735,9 @@ QUIZ_CASE(poincare_approximation_probability) {
   assert_expression_approximates_to<double>("geomcdfrange(2,2,0.5)", "0.25");
   assert_expression_approximates_to<double>("invgeom(1,1)", "1");
   assert_expression_approximates_to<double>("invgeom(0.825,0.5)", "3");
+  assert_expression_approximates_to<double>("geomcdf(40,0.1)",
+                                            "0.98521911705857");
+  assert_expression_approximates_to<double>("invgeom(0.9852191,0.1)", "40");
 
   assert_expression_approximates_to<double>("hgeompdf(-1,2,1,1)", "0");
   assert_expression_approximates_to<double>("hgeompdf(0,2,1,1)", "0.5");
@@ -1792,6 +1795,13 @@ QUIZ_CASE(poincare_approximation_probability) {
   assert_expression_approximates_to<float>("poissoncdf(2,2)", "0.6766764");
   assert_expression_approximates_to<double>("poissoncdf(2,2)",
                                             "0.67667641618306");
+  assert_expression_approximates_to<double>("poissoncdf(400000,400000)",
+                                            "0.500420522", Radian,
+                                            MetricUnitFormat, Cartesian, 9);
+  assert_expression_approximates_to<double>("poissoncdf(399000,400000)",
+                                            "0.05696835", Radian,
+                                            MetricUnitFormat, Cartesian, 7);
+  assert_expression_approximates_to<double>("poissoncdf(500000,400000)", "1");
 
   assert_expression_approximates_to<float>("tpdf(1.2, 3.4)", "0.1706051");
   assert_expression_approximates_to<double>("tpdf(1.2, 3.4)",
@@ -247,6 +247,65 @@ QUIZ_CASE(poincare_context_function_evaluate_at_undef) {
   Ion::Storage::FileSystem::sharedFileSystem->recordNamed("g.func").destroy();
 }
 
+QUIZ_CASE(poincare_context_symbol_approximation_cache) {
+  Shared::GlobalContext context;
+  ApproximationContext approximationContext(&context, Cartesian, Radian);
+  Symbol a = Symbol::Builder('a');
+  std::complex<double> value;
+
+  assert_reduce_and_store("3→a");
+  quiz_assert(!context.approximationForSymbol(a, approximationContext, true,
+                                              &value));
+  Expression e = parse_expression("a*x+1", &context, false);
+  quiz_assert(e.approximateToScalarWithValueForSymbol<double>(
+                  "x", 2.0, approximationContext) == 7.0);
+  quiz_assert(context.approximationForSymbol(a, approximationContext, true,
+                                             &value) &&
+              value == 3.0);
+  // Each precision and setting has its own entry
+  quiz_assert(!context.approximationForSymbol(a, approximationContext, false,
+                                              &value));
+  ApproximationContext degreeContext(&context, Cartesian, Degree);
+  quiz_assert(
+      !context.approximationForSymbol(a, degreeContext, true, &value));
+
+  // Changing the storage invalidates the cache
+  assert_reduce_and_store("4→a");
+  quiz_assert(!context.approximationForSymbol(a, approximationContext, true,
+                                              &value));
+  quiz_assert(e.approximateToScalarWithValueForSymbol<double>(
+                  "x", 2.0, approximationContext) == 9.0);
+
+  // Variables shadowing a user symbol are never cached
+  assert_reduce_and_store("5→x");
+  quiz_assert(e.approximateToScalarWithValueForSymbol<double>(
+                  "x", 1.0, approximationContext) == 5.0);
+  quiz_assert(!context.approximationForSymbol(Symbol::Builder('x'),
+                                              approximationContext, true,
+                                              &value));
+
+  // Undefined symbols are remembered as not cacheable
+  Expression z = parse_expression("z", &context, false);
+  for (int i = 0; i < 2; i++) {
+    quiz_assert(
+        std::isnan(z.approximateToScalar<double>(approximationContext)));
+    quiz_assert(!context.approximationForSymbol(Symbol::Builder('z'),
+                                                approximationContext, true,
+                                                &value));
+  }
+  // Until the storage changes
+  assert_reduce_and_store("2→z");
+  quiz_assert(z.approximateToScalar<double>(approximationContext) == 2.0);
+  quiz_assert(context.approximationForSymbol(Symbol::Builder('z'),
+                                             approximationContext, true,
+                                             &value) &&
+              value == 2.0);
+
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("a.exp").destroy();
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("x.exp").destroy();
+  Ion::Storage::FileSystem::sharedFileSystem->recordNamed("z.exp").destroy();
+}
+
 template void assert_parsed_expression_approximates_with_value_for_symbol(
     Poincare::Expression, const char *, float, float,
     Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
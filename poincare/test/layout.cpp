@@ -1,3 +1,4 @@
+#include <poincare/layout_metrics_cache.h>
 #include <poincare_layouts.h>
 
 #include "helper.h"
@@ -82,6 +83,98 @@ QUIZ_CASE(poincare_layout_comparison) {
   quiz_assert(!e11.isIdenticalTo(e13));
 }
 
+QUIZ_CASE(poincare_layout_checksum) {
+  Layout e0 = FractionLayout::Builder(
+      LayoutHelper::String("12345"),
+      HorizontalLayout::Builder(CodePointLayout::Builder('x')));
+  Layout e1 = FractionLayout::Builder(
+      LayoutHelper::String("12345"),
+      HorizontalLayout::Builder(CodePointLayout::Builder('x')));
+  Layout e2 = FractionLayout::Builder(
+      LayoutHelper::String("12345"),
+      HorizontalLayout::Builder(CodePointLayout::Builder('y')));
+  Layout e3 = FractionLayout::Builder(
+      HorizontalLayout::Builder(CodePointLayout::Builder('x')),
+      LayoutHelper::String("12345"));
+  quiz_assert(e0.checksum() == e1.checksum());
+  quiz_assert(e0.checksum() != e2.checksum());
+  quiz_assert(e0.checksum() != e3.checksum());
+
+  Layout e4 = VerticalOffsetLayout::Builder(
+      CodePointLayout::Builder('2'),
+      VerticalOffsetLayoutNode::VerticalPosition::Superscript);
+  Layout e5 = VerticalOffsetLayout::Builder(
+      CodePointLayout::Builder('2'),
+      VerticalOffsetLayoutNode::VerticalPosition::Subscript);
+  quiz_assert(e4.checksum() != e5.checksum());
+}
+
+static LayoutNode::Signature sign_layout(Layout l, uint8_t *buffer,
+                                         size_t bufferSize) {
+  LayoutNode::Signature signature(buffer, bufferSize);
+  l.sign(&signature);
+  return signature;
+}
+
+QUIZ_CASE(poincare_layout_metrics_cache) {
+  LayoutMetricsCache cache;
+  Layout l = FractionLayout::Builder(CodePointLayout::Builder('1'),
+                                     CodePointLayout::Builder('2'));
+  uint8_t buffer[LayoutMetricsCache::k_maxSignatureSize];
+  LayoutNode::Signature signature = sign_layout(l, buffer, sizeof(buffer));
+  quiz_assert(signature.fitsInBuffer());
+  KDSize size = KDSizeZero;
+  KDCoordinate baseline = 0;
+  quiz_assert(!cache.find(signature, KDFont::Size::Large, &size, &baseline));
+  cache.store(signature, KDFont::Size::Large,
+              l.layoutSize(KDFont::Size::Large),
+              l.baseline(KDFont::Size::Large));
+  quiz_assert(!cache.find(signature, KDFont::Size::Small, &size, &baseline));
+  cache.store(signature, KDFont::Size::Small,
+              l.layoutSize(KDFont::Size::Small),
+              l.baseline(KDFont::Size::Small));
+  // Both font sizes are kept for the same layout
+  quiz_assert(cache.find(signature, KDFont::Size::Large, &size, &baseline));
+  quiz_assert(size == l.layoutSize(KDFont::Size::Large) &&
+              baseline == l.baseline(KDFont::Size::Large));
+  quiz_assert(cache.find(signature, KDFont::Size::Small, &size, &baseline));
+  quiz_assert(size == l.layoutSize(KDFont::Size::Small) &&
+              baseline == l.baseline(KDFont::Size::Small));
+  cache.reset();
+  quiz_assert(!cache.find(signature, KDFont::Size::Small, &size, &baseline));
+
+  // Layouts whose checksums collide are told apart
+  Layout s0 = StringLayout::Builder("mjrvhliz");
+  Layout s1 = StringLayout::Builder("hvyfhkfm");
+  uint8_t otherBuffer[LayoutMetricsCache::k_maxSignatureSize];
+  LayoutNode::Signature signature0 = sign_layout(s0, buffer, sizeof(buffer));
+  LayoutNode::Signature signature1 =
+      sign_layout(s1, otherBuffer, sizeof(otherBuffer));
+  quiz_assert(signature0.checksum() == signature1.checksum());
+  cache.store(signature0, KDFont::Size::Large, KDSize(1, 2), 3);
+  quiz_assert(!cache.find(signature1, KDFont::Size::Large, &size, &baseline));
+  quiz_assert(cache.find(signature0, KDFont::Size::Large, &size, &baseline));
+  quiz_assert(size == KDSize(1, 2) && baseline == 3);
+
+  // Signatures larger than the buffer are neither stored nor found
+  LayoutNode::Signature truncated = sign_layout(s1, otherBuffer, 4);
+  quiz_assert(!truncated.fitsInBuffer());
+  cache.store(truncated, KDFont::Size::Large, KDSize(1, 2), 3);
+  quiz_assert(!cache.find(truncated, KDFont::Size::Large, &size, &baseline));
+
+  // The oldest entries are dropped
+  for (int i = 0; i < 100; i++) {
+    Layout c = CodePointLayout::Builder('a' + i % 26);
+    LayoutNode::Signature s =
+        sign_layout(HorizontalLayout::Builder(c, LayoutHelper::String("xyz")),
+                    otherBuffer, sizeof(otherBuffer));
+    cache.store(s, KDFont::Size::Large, KDSize(i, i), i);
+    quiz_assert(cache.find(s, KDFont::Size::Large, &size, &baseline));
+    quiz_assert(size == KDSize(i, i) && baseline == i);
+  }
+  quiz_assert(!cache.find(signature0, KDFont::Size::Large, &size, &baseline));
+}
+
 QUIZ_CASE(poincare_layout_fraction_create) {
   /*                         12
    * 12|34+5 -> "Divide" -> --- + 5
@@ -42,3 +42,34 @@ QUIZ_CASE(poincare_matrix_undef) {
   assert_expression_approximates_to<float>("transpose(cross([[0]],[[0]]))",
                                            Undefined::Name());
 }
+
+QUIZ_CASE(poincare_matrix_array_decompositions) {
+  // LU decomposition with partial pivoting
+  double lu[] = {1.0, 2.0, 3.0, 4.0, 5.0, -6.0, 7.0, 8.0, 9.0};
+  int pivots[3];
+  double determinant = Matrix::ArrayLUDecomposition(lu, 3, pivots);
+  quiz_assert(roughly_equal(determinant, -72.0, 1e-14));
+  quiz_assert(pivots[0] == 2);
+  double b[] = {6.0, 3.0, 24.0};
+  Matrix::ArrayLUSolve(lu, 3, pivots, b, 1);
+  quiz_assert(roughly_equal(b[0], 1.0, 1e-14) &&
+              roughly_equal(b[1], 1.0, 1e-14) &&
+              roughly_equal(b[2], 1.0, 1e-14));
+
+  // Singular matrices have a null determinant and cannot be inverted
+  double singular[] = {1.0, 2.0, 2.0, 4.0};
+  quiz_assert(Matrix::ArrayLUDecomposition(singular, 2, pivots) == 0.0);
+  double singularCopy[] = {1.0, 2.0, 2.0, 4.0};
+  quiz_assert(Matrix::ArrayInverse(singularCopy, 2, 2) != 0);
+
+  // Cholesky decomposition of a symmetric positive definite matrix
+  double spd[] = {4.0, 2.0, 2.0, 3.0};
+  quiz_assert(Matrix::ArrayCholeskyDecomposition(spd, 2));
+  quiz_assert(spd[0] == 2.0 && spd[2] == 1.0);
+  double c[] = {6.0, 5.0};
+  Matrix::ArrayCholeskySolve(spd, 2, c, 1);
+  quiz_assert(roughly_equal(c[0], 1.0, 1e-14) &&
+              roughly_equal(c[1], 1.0, 1e-14));
+  double notPositive[] = {1.0, 2.0, 2.0, 1.0};
+  quiz_assert(!Matrix::ArrayCholeskyDecomposition(notPositive, 2));
+}
@@ -579,6 +579,46 @@ QUIZ_CASE(poincare_parsing_units) {
     }
   }
 
+  /* Each prefixed alias is parsed as the first representative that can parse
+   * it in the representatives order. */
+  for (int i = 0; i < Unit::Representative::k_numberOfDimensions; i++) {
+    const Unit::Representative* dim =
+        Unit::Representative::DefaultRepresentatives()[i];
+    for (int j = 0; j < dim->numberOfRepresentatives(); j++) {
+      const Unit::Representative* rep =
+          dim->representativesOfSameDimension() + j;
+      for (const char* alias : rep->rootSymbols()) {
+        for (int k = 0; k < Unit::Prefix::k_numberOfPrefixes; k++) {
+          constexpr static size_t bufferSize = 20;
+          char buffer[bufferSize];
+          size_t length = strlcpy(
+              buffer, Unit::Prefix::Prefixes()[k].symbol(), bufferSize);
+          length += strlcpy(buffer + length, alias, bufferSize - length);
+          const Unit::Representative* expectedRepresentative = nullptr;
+          const Unit::Prefix* expectedPrefix = nullptr;
+          for (int l = 0; l < Unit::Representative::k_numberOfDimensions &&
+                          !expectedRepresentative;
+               l++) {
+            Unit::Representative::DefaultRepresentatives()[l]
+                ->canParseWithEquivalents(buffer, length,
+                                          &expectedRepresentative,
+                                          &expectedPrefix);
+          }
+          const Unit::Representative* parsedRepresentative = nullptr;
+          const Unit::Prefix* parsedPrefix = nullptr;
+          bool canParse = Unit::CanParse(buffer, length, &parsedRepresentative,
+                                         &parsedPrefix);
+          quiz_assert_print_if_failure(
+              canParse == (expectedRepresentative != nullptr) &&
+                  (!canParse ||
+                   (parsedRepresentative == expectedRepresentative &&
+                    parsedPrefix == expectedPrefix)),
+              buffer);
+        }
+      }
+    }
+  }
+
   // Non-existing units are not parsable
   assert_text_not_parsable("_n");
   assert_text_not_parsable("_a");
@@ -1085,6 +1125,28 @@ QUIZ_CASE(poincare_parsing_identifiers) {
       Multiplication::Builder(
           Symbol::Builder("a", 1), Symbol::Builder("z", 1),
           Function::Builder("foobar", 6, Symbol::Builder("x", 1))));
+  // Long identifiers strings are split into known names
+  constexpr int k_numberOfRepetitions = 8;
+  Multiplication product = Multiplication::Builder();
+  for (int i = 0; i < k_numberOfRepetitions; i++) {
+    product.addChildAtIndexInPlace(Symbol::Builder("x", 1),
+                                   product.numberOfChildren(),
+                                   product.numberOfChildren());
+    product.addChildAtIndexInPlace(Symbol::Builder("y", 1),
+                                   product.numberOfChildren(),
+                                   product.numberOfChildren());
+    product.addChildAtIndexInPlace(Symbol::Builder("z", 1),
+                                   product.numberOfChildren(),
+                                   product.numberOfChildren());
+  }
+  product.addChildAtIndexInPlace(
+      Function::Builder("foobar", 6, Symbol::Builder("x", 1)),
+      product.numberOfChildren(), product.numberOfChildren());
+  product.addChildAtIndexInPlace(Symbol::Builder("y12", 3),
+                                 product.numberOfChildren(),
+                                 product.numberOfChildren());
+  assert_parsed_expression_is(
+      "xyzxyzxyzxyzxyzxyzxyzxyzfoobar(x)y12", product);
   Ion::Storage::FileSystem::sharedFileSystem->destroyAllRecords();
 }
 
@@ -1,4 +1,5 @@
 #include <apps/shared/global_context.h>
+#include <poincare/numeric_polynomial.h>
 #include <poincare/polynomial.h>
 
 #include "helper.h"
@@ -117,3 +118,47 @@ QUIZ_CASE(poincare_polynomial_roots_cubic) {
       {"3.687201ᴇ2", "-1.8486ᴇ2-3.196107ᴇ2×i", "-1.8486ᴇ2+3.196107ᴇ2×i"},
       "-6.82187ᴇ16", Cartesian);
 }
+
+template <int N>
+void assert_numeric_roots_of_polynomial_are(const char* polynomial, double min,
+                                            double max,
+                                            const double (&roots)[N]) {
+  Shared::GlobalContext context;
+  ReductionContext reductionContext(&context, Real, Radian, MetricUnitFormat,
+                                    SystemForApproximation);
+  Expression polynomialExp = parse_expression(polynomial, &context, false)
+                                 .cloneAndReduce(reductionContext);
+  NumericPolynomial numericPolynomial = NumericPolynomial::FromExpression(
+      polynomialExp, "x", ApproximationContext(reductionContext));
+  quiz_assert_print_if_failure(!numericPolynomial.isUndefined(), polynomial);
+  double obtainedRoots[NumericPolynomial::k_maxDegree];
+  int numberOfRoots =
+      numericPolynomial.realRoots(min, max, obtainedRoots, N + 1);
+  quiz_assert_print_if_failure(numberOfRoots == N, polynomial);
+  for (int i = 0; i < N; i++) {
+    assert_roughly_equal(obtainedRoots[i], roots[i], 1e-6);
+  }
+}
+
+QUIZ_CASE(poincare_polynomial_numeric_roots) {
+  assert_numeric_roots_of_polynomial_are("x^4-5x^2+4", -10., 10.,
+                                         {-2., -1., 1., 2.});
+  assert_numeric_roots_of_polynomial_are("x^5-x", -10., 10., {-1., 0., 1.});
+  // Multiple roots are found once, including at the ends of the interval
+  assert_numeric_roots_of_polynomial_are("(x-1)^2×(x+1)^2", -1., 1.,
+                                         {-1., 1.});
+  assert_numeric_roots_of_polynomial_are("(x-10)^7", -100., 100., {10.});
+  assert_numeric_roots_of_polynomial_are("x^2×(x-3)^3×(x+5)", -100., 100.,
+                                         {-5., 0., 3.});
+  assert_numeric_roots_of_polynomial_are("(x-1.00001)^2×(x+1.00001)^2", -2.,
+                                         2., {-1.00001, 1.00001});
+  assert_numeric_roots_of_polynomial_are(
+      "6x^5-x^4-43x^3+42x^2+x-7", -10., 10.,
+      {-2.99103, -0.3591962, 0.6322375, 0.8400476, 2.044608});
+  assert_numeric_roots_of_polynomial_are("x^10-1024", 0., 3., {2.});
+  // Close roots are told apart
+  assert_numeric_roots_of_polynomial_are("(x-1)(x-1.000001)(x+2)(x-3)", -10.,
+                                         10., {-2., 1., 1.000001, 3.});
+  assert_numeric_roots_of_polynomial_are("(x-2)^2(x-2.001)(x+1)^3", -10., 10.,
+                                         {-1., 2., 2.001});
+}
@@ -31,9 +31,13 @@ QUIZ_CASE(regularized_incomplete_beta_function) {
 void assert_regularized_gamma_is(double s, double x, double result) {
   double r = 0.0;
   const double precision = FLT_EPSILON;
-  RegularizedGammaFunction(s, x, precision, k_maxRegularizedGammaIterations,
-                           &r);
+  quiz_assert(RegularizedGammaFunction(s, x, precision,
+                                       k_maxRegularizedGammaIterations, &r));
   assert_roughly_equal(r, result, precision);
+  double q = 0.0;
+  quiz_assert(RegularizedUpperGammaFunction(
+      s, x, precision, k_maxRegularizedGammaIterations, &q));
+  assert_roughly_equal(q, 1.0 - result, precision);
 }
 
 QUIZ_CASE(poincare_regularized_gamma) {
@@ -183,6 +187,13 @@ QUIZ_CASE(poincare_regularized_gamma) {
   // P(x<8.26)
   assert_regularized_gamma_is(
       1.5, 4.13, 0.95906693562948053255468039424158632755279541015625);
+
+  // Q(1, 50) = e^-50 is lost when computed as 1 - P(1, 50)
+  double q = 0.0;
+  const double precision = FLT_EPSILON;
+  quiz_assert(RegularizedUpperGammaFunction(
+      1.0, 50.0, precision, k_maxRegularizedGammaIterations, &q));
+  assert_roughly_equal(q, 1.9287498479639178e-22, precision);
 }
 
 #if 0
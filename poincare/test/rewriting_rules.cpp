@@ -0,0 +1,52 @@
+#include <poincare/rewriting_rules.h>
+#include <poincare/undefined.h>
+
+#include "helper.h"
+
+using namespace Poincare;
+
+static const RewritingRules::Statistics& statistics_of_rule(const char* name) {
+  int index = RewritingRules::IndexOfRule(name);
+  quiz_assert(index >= 0);
+  return RewritingRules::StatisticsOfRule(index);
+}
+
+static void assert_rules_applied(const char* expression, const char* result,
+                                 const char* appliedRule,
+                                 const char* const* untriedRules,
+                                 int numberOfUntriedRules) {
+  RewritingRules::ResetStatistics();
+  assert_parsed_expression_simplify_to(expression, result);
+  const RewritingRules::Statistics& applied = statistics_of_rule(appliedRule);
+  quiz_assert_print_if_failure(applied.numberOfHits > 0, expression);
+  // Rules whose pattern cannot match are not even tried
+  for (int i = 0; i < numberOfUntriedRules; i++) {
+    quiz_assert_print_if_failure(
+        statistics_of_rule(untriedRules[i]).numberOfTries == 0, expression);
+  }
+}
+
+QUIZ_CASE(poincare_rewriting_rules) {
+  quiz_assert(RewritingRules::IndexOfRule("log(x,y)") == -1);
+
+  const char* logOfOneUntried[] = {"log(x,0)", "log(x,1)", "log(0,x)",
+                                   "log(x,x)"};
+  assert_rules_applied("log(1,7)", "0", "log(1,x)", logOfOneUntried, 4);
+  const char* logOfZeroUntried[] = {"log(x,0)", "log(x,1)", "log(1,x)"};
+  assert_rules_applied("log(0,7)", Undefined::Name(), "log(0,x)",
+                       logOfZeroUntried, 3);
+  const char* sameBaseUntried[] = {"log(x,0)", "log(x,1)", "log(0,x)",
+                                   "log(1,x)"};
+  assert_rules_applied("log(π,π)", "1", "log(x,x)", sameBaseUntried, 4);
+
+  // Rules are tried in declaration order: log(1,1) is undef, not 0
+  const char* baseOneUntried[] = {"log(x,0)", "log(1,x)", "log(x,x)"};
+  assert_rules_applied("log(1,1)", Undefined::Name(), "log(x,1)",
+                       baseOneUntried, 3);
+
+  // A rule whose condition fails is tried but not applied
+  RewritingRules::ResetStatistics();
+  assert_parsed_expression_simplify_to("log(π,3)", "log(π,3)");
+  const RewritingRules::Statistics& sameBase = statistics_of_rule("log(x,x)");
+  quiz_assert(sameBase.numberOfTries > 0 && sameBase.numberOfHits == 0);
+}
@@ -321,6 +321,26 @@ Q(value)
 Q(values)
 Q(zip)
 
+// gc QSTRs
+Q(gc)
+Q(collect)
+Q(collections)
+Q(disable)
+Q(enable)
+Q(fragmentation)
+Q(free)
+Q(isenabled)
+Q(max_free)
+Q(max_pause_ms)
+Q(mem_alloc)
+Q(mem_free)
+Q(pause_ms)
+Q(peak)
+Q(stats)
+Q(threshold)
+Q(total)
+Q(used)
+
 // Ion QSTR
 Q(ion)
 Q(keydown)
@@ -406,19 +426,27 @@ Q(around)
 Q(array)
 Q(concatenate)
 Q(cross)
+Q(det)
+Q(eig)
 Q(exp)
+Q(fft)
+Q(ifft)
 Q(inf)
 Q(int16)
 Q(int8)
+Q(inv)
+Q(linalg)
 Q(linspace)
 Q(maximum)
 Q(mean)
 Q(median)
 Q(minimum)
 Q(nan)
+Q(norm)
 Q(ones)
 Q(polyfit)
 Q(polyval)
+Q(solve)
 Q(std)
 Q(uint16)
 Q(uint8)
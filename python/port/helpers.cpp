@@ -13,16 +13,11 @@ bool micropython_port_vm_hook_loop() {
    * platforms that need it. */
 
   /* Doing too many things here slows down Python execution quite a lot. So we
-   * only do things once in a while and return as soon as possible otherwise. */
-
-  static uint64_t t = Ion::Timing::millis();
-  constexpr static uint64_t delay = 100;
-
-  uint64_t t2 = Ion::Timing::millis();
-  if (t2 - t < delay) {
+   * only do things once in a while, when Ion raises its periodic flag, and
+   * return as soon as possible otherwise. */
+  if (!Ion::Timing::popPeriodicFlag()) {
     return false;
   }
-  t = t2;
 
   micropython_port_vm_hook_refresh_print();
   // Check if the user asked for an interruption from the keyboard
@@ -39,6 +34,8 @@ void micropython_port_vm_hook_refresh_print() {
 bool micropython_port_interruptible_msleep(int32_t delay) {
   static uint64_t lastRun = 0;
   assert(delay >= 0);
+  // Show the lines printed before sleeping
+  micropython_port_vm_hook_refresh_print();
   constexpr int32_t miniumDelayBetweenInterruptions = 25;
   constexpr int32_t interruptionCheckDelay = 100;
   const int32_t numberOfInterruptionChecks = delay / interruptionCheckDelay;
@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // These methods return true if they have been interrupted
@@ -15,6 +16,15 @@ bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
 
+// Statistics of the garbage collections since MicroPython was initialized
+typedef struct {
+  uint32_t collections;
+  uint32_t total_pause_ms;
+  uint32_t max_pause_ms;
+  size_t peak_used;
+} micropython_port_gc_stats_t;
+const micropython_port_gc_stats_t* micropython_port_gc_stats();
+
 #ifdef __cplusplus
 }
 #endif
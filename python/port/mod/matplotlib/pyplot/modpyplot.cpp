@@ -1,10 +1,8 @@
 extern "C" {
 #include "modpyplot.h"
 // WARNING: ulab.h MUST be included before checking NDARRAY_HAS_TOLIST
-#include "../../ulab.h"
-#if NDARRAY_HAS_TOLIST
 #include "../../ndarray.h"
-#endif
+#include "../../ulab.h"
 }
 #include <assert.h>
 #include <escher/palette.h>
@@ -38,34 +36,83 @@ static size_t extractArgument(mp_obj_t arg, mp_obj_t **items) {
   return itemLength;
 }
 
-// Extract two scalar or array arguments and check for their strickly equal
-// dimension
+/* Scalar or array argument, whose items are read as floats when they are
+ * added to the plot store. Unlike extractArgument, it does not allocate:
+ * one-dimensional ndarrays are read in place. */
+
+class FloatArgument {
+ public:
+  FloatArgument(float value)
+      : m_value(value), m_items(nullptr), m_ndarray(nullptr), m_length(1) {}
+  FloatArgument(mp_obj_t arg);
+  size_t length() const { return m_length; }
+  // Scalars and arrays of length 1 are broadcast to every index
+  float operator[](size_t i) const;
+
+ private:
+  float m_value;
+  mp_obj_t *m_items;
+  ndarray_obj_t *m_ndarray;
+  size_t m_length;
+};
+
+FloatArgument::FloatArgument(mp_obj_t arg)
+    : m_value(NAN), m_items(nullptr), m_ndarray(nullptr), m_length(1) {
+  if (mp_obj_is_type(arg, &ulab_ndarray_type)) {
+    ndarray_obj_t *ndarray = static_cast<ndarray_obj_t *>(MP_OBJ_TO_PTR(arg));
+    if (ndarray->ndim == 1) {
+      m_ndarray = ndarray;
+      m_length = ndarray->len;
+      return;
+    }
+#if NDARRAY_HAS_TOLIST
+    arg = ndarray_tolist(arg);
+#endif
+  }
+  if (mp_obj_is_type(arg, &mp_type_tuple) ||
+      mp_obj_is_type(arg, &mp_type_list)) {
+    mp_obj_get_array(arg, &m_length, &m_items);
+  } else {
+    m_value = mp_obj_get_float(arg);
+  }
+}
+
+float FloatArgument::operator[](size_t i) const {
+  if (m_length == 1) {
+    i = 0;
+  }
+  assert(i < m_length);
+  if (m_ndarray != nullptr) {
+    uint8_t *item = static_cast<uint8_t *>(m_ndarray->array) +
+                    i * m_ndarray->strides[ULAB_MAX_DIMS - 1];
+    return ndarray_get_float_value(item, m_ndarray->dtype);
+  }
+  if (m_items != nullptr) {
+    return mp_obj_get_float(m_items[i]);
+  }
+  return m_value;
+}
+
+// Check that two scalar or array arguments have the same dimension
 
-static size_t extractArgumentsAndCheckEqualSize(mp_obj_t x, mp_obj_t y,
-                                                mp_obj_t **xItems,
-                                                mp_obj_t **yItems) {
-  size_t xLength = extractArgument(x, xItems);
-  size_t yLength = extractArgument(y, yItems);
-  if (xLength != yLength) {
+static size_t checkEqualSize(const FloatArgument &x, const FloatArgument &y) {
+  if (x.length() != y.length()) {
     mp_raise_ValueError("x and y must be the same size");
   }
-  return xLength;
+  return x.length();
 }
 
-/* Extract one scalar or array arguments and check that it is either:
+/* Check that a scalar or array argument is either:
  * - of size 1
  * - of the required non null size
  */
 
-static size_t extractArgumentAndValidateSize(mp_obj_t arg,
-                                             size_t requiredlength,
-                                             mp_obj_t **items) {
-  size_t itemLength = extractArgument(arg, items);
+static void validateSize(const FloatArgument &arg, size_t requiredlength) {
+  size_t itemLength = arg.length();
   if (itemLength == 0 || !(itemLength == 1 || requiredlength == 1 ||
                            itemLength == requiredlength)) {
     mp_raise_ValueError("shape mismatch");
   }
-  return itemLength;
 }
 
 // Get color from keyword arguments if possible
@@ -128,8 +175,7 @@ mp_obj_t modpyplot_arrow(size_t n_args, const mp_obj_t *args,
                        MP_MAP_LOOKUP);
   /* Default head_width is 0.0f because we want a default width in pixel
    * coordinates which is handled by CurveView::drawArrow. */
-  mp_obj_t arrowWidth =
-      (elem == nullptr) ? mp_obj_new_float(0.0f) : elem->value;
+  float arrowWidth = (elem == nullptr) ? 0.0f : mp_obj_get_float(elem->value);
 
   // Setting arrow color
   KDColor color;
@@ -139,11 +185,10 @@ mp_obj_t modpyplot_arrow(size_t n_args, const mp_obj_t *args,
 
   // Adding the object to the plot
   assert(n_args >= 4);
-  sPlotStore->addSegment(
-      args[0], args[1],
-      mp_obj_new_float(mp_obj_get_float(args[0]) + mp_obj_get_float(args[2])),
-      mp_obj_new_float(mp_obj_get_float(args[1]) + mp_obj_get_float(args[3])),
-      color, arrowWidth);
+  float x = mp_obj_get_float(args[0]);
+  float y = mp_obj_get_float(args[1]);
+  sPlotStore->addSegment(x, y, x + mp_obj_get_float(args[2]),
+                         y + mp_obj_get_float(args[3]), color, arrowWidth);
   return mp_const_none;
 }
 
@@ -209,40 +254,27 @@ mp_obj_t modpyplot_bar(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
         n_args));
   }
   sPlotStore->setShow(true);
-  mp_obj_t *xItems;
-  mp_obj_t *hItems;
-  mp_obj_t *wItems;
-  mp_obj_t *bItems;
 
   assert(n_args >= 2);
 
   // x arg
-  size_t xLength = extractArgument(args[0], &xItems);
+  FloatArgument x(args[0]);
+  size_t xLength = x.length();
   if (xLength == 0) {
     return mp_const_none;
   }
 
   // height arg
-  size_t hLength = extractArgumentAndValidateSize(args[1], xLength, &hItems);
+  FloatArgument h(args[1]);
+  validateSize(h, xLength);
 
   // width arg
-  size_t wLength = 1;
-  if (n_args >= 3) {
-    wLength = extractArgumentAndValidateSize(args[2], xLength, &wItems);
-  } else {
-    wItems = m_new(mp_obj_t, 1);
-    wItems[0] = mp_obj_new_float(0.8f);
-  }
+  FloatArgument w = n_args >= 3 ? FloatArgument(args[2]) : FloatArgument(0.8f);
+  validateSize(w, xLength);
 
   // bottom arg
-  size_t bLength = 1;
-  if (n_args >= 4) {
-    bLength = extractArgumentAndValidateSize(args[3], xLength, &bItems);
-  } else {
-    bItems = m_new(mp_obj_t, 1);
-    bItems[0] = mp_obj_new_float(0.0f);
-  }
-  assert(hLength > 0 && wLength > 0 && bLength > 0);
+  FloatArgument b = n_args >= 4 ? FloatArgument(args[3]) : FloatArgument(0.0f);
+  validateSize(b, xLength);
 
   // Setting bar color
   // color keyword
@@ -252,23 +284,19 @@ mp_obj_t modpyplot_bar(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
       mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_color), MP_MAP_LOOKUP);
   colorFromKeywordArgument(elem, &color);
 
+  sPlotStore->reserveRects(xLength);
   for (size_t i = 0; i < xLength; i++) {
-    mp_obj_t iH = hItems[hLength > 1 ? i : 0];
-    mp_obj_t iW = wItems[wLength > 1 ? i : 0];
-    mp_obj_t iB = bItems[bLength > 1 ? i : 0];
-    mp_obj_t iX = xItems[i];
-
-    float iWf = mp_obj_get_float(iW);
-    float iXf = mp_obj_get_float(iX);
-    mp_obj_t rectLeft = mp_obj_new_float(iXf - iWf / 2.0f);
-    mp_obj_t rectRight = mp_obj_new_float(iXf + iWf / 2.0f);
-    mp_obj_t rectBottom = iB;
-    mp_obj_t rectTop =
-        mp_obj_new_float(mp_obj_get_float(iH) + mp_obj_get_float(iB));
-    if (mp_obj_get_float(iH) < 0.0) {
-      mp_obj_t temp = rectTop;
-      rectTop = rectBottom;
-      rectBottom = temp;
+    float iH = h[i];
+    float iW = w[i];
+    float iB = b[i];
+    float iX = x[i];
+
+    float rectLeft = iX - iW / 2.0f;
+    float rectRight = iX + iW / 2.0f;
+    float rectBottom = iB;
+    float rectTop = iH + iB;
+    if (iH < 0.0) {
+      std::swap(rectTop, rectBottom);
     }
     sPlotStore->addRect(rectLeft, rectRight, rectTop, rectBottom, color);
   }
@@ -402,9 +430,11 @@ mp_obj_t modpyplot_hist(size_t n_args, const mp_obj_t *args,
       mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_color), MP_MAP_LOOKUP);
   colorFromKeywordArgument(elem, &color);
 
+  sPlotStore->reserveRects(nBins);
   for (size_t i = 0; i < nBins; i++) {
-    sPlotStore->addRect(edgeItems[i], edgeItems[i + 1], binItems[i],
-                        mp_obj_new_float(0.0), color);
+    sPlotStore->addRect(mp_obj_get_float(edgeItems[i]),
+                        mp_obj_get_float(edgeItems[i + 1]),
+                        MP_OBJ_SMALL_INT_VALUE(binItems[i]), 0.0f, color);
   }
   return mp_const_none;
 }
@@ -423,10 +453,10 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args,
         "scatter() takes 2 positional arguments but %d were given", n_args));
   }
   sPlotStore->setShow(true);
-  mp_obj_t *xItems, *yItems;
   assert(n_args >= 2);
-  size_t length =
-      extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
+  FloatArgument x(args[0]);
+  FloatArgument y(args[1]);
+  size_t length = checkEqualSize(x, y);
 
   // Setting scatter color
   // color keyword
@@ -439,8 +469,9 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args,
   elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_color), MP_MAP_LOOKUP);
   colorFromKeywordArgument(elem, &color);
 
+  sPlotStore->reserveDots(length);
   for (size_t i = 0; i < length; i++) {
-    sPlotStore->addDot(xItems[i], yItems[i], color);
+    sPlotStore->addDot(x[i], y[i], color);
   }
 
   return mp_const_none;
@@ -459,20 +490,14 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,
         &mp_type_TypeError,
         "plot() takes 3 positional arguments but %d were given", n_args));
   }
-  mp_obj_t *xItems, *yItems;
-  size_t length;
-  if (n_args == 1) {
-    length = extractArgument(args[0], &yItems);
-
-    // Create the default xItems: [0, 1, 2,...]
-    xItems = m_new(mp_obj_t, length);
-    for (size_t i = 0; i < length; i++) {
-      xItems[i] = mp_obj_new_float((float)i);
-    }
-  } else {
-    assert(n_args >= 2);
-    length =
-        extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
+  // Without x, the default x is [0, 1, 2,...]
+  assert(n_args >= 1);
+  FloatArgument x(NAN);
+  FloatArgument y(args[n_args == 1 ? 0 : 1]);
+  size_t length = y.length();
+  if (n_args >= 2) {
+    x = FloatArgument(args[0]);
+    length = checkEqualSize(x, y);
   }
 
   // Setting plot color
@@ -490,9 +515,18 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,
     color = MicroPython::Color::Parse(args[2]);
   }
 
-  for (int i = 0; i < (int)length - 1; i++) {
-    sPlotStore->addSegment(xItems[i], yItems[i], xItems[i + 1], yItems[i + 1],
-                           color);
+  if (length < 2) {
+    return mp_const_none;
+  }
+  /* Convert the values before starting the curve, so that an invalid value
+   * does not leave an incomplete curve in the store. */
+  for (size_t i = 0; i < length; i++) {
+    x[i];
+    y[i];
+  }
+  sPlotStore->startCurve(length, color);
+  for (size_t i = 0; i < length; i++) {
+    sPlotStore->addVertex(n_args == 1 ? i : x[i], y[i]);
   }
 
   return mp_const_none;
@@ -501,12 +535,7 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,
 mp_obj_t modpyplot_text(mp_obj_t x, mp_obj_t y, mp_obj_t s) {
   assert(sPlotStore != nullptr);
   sPlotStore->setShow(true);
-  // Input parameter validation
-  mp_obj_get_float(x);
-  mp_obj_get_float(y);
-  mp_obj_str_get_str(s);
-
-  sPlotStore->addLabel(x, y, s);
+  sPlotStore->addLabel(mp_obj_get_float(x), mp_obj_get_float(y), s);
 
   return mp_const_none;
 }
@@ -9,144 +9,158 @@ PlotStore::PlotStore() : Shared::InteractiveCurveViewRange(), m_show(false) {
 }
 
 void PlotStore::flush() {
-  /* First set the objects to null, so that the first malloc new_list
-   * can call the garbage collection and free the previous list. It is
-   * necessary since allocation need not to fail because this function
-   * is called during HandleException. */
-  m_dots = MP_OBJ_NULL;
-  m_segments = MP_OBJ_NULL;
-  m_rects = MP_OBJ_NULL;
-  m_labels = MP_OBJ_NULL;
-  m_dots = mp_obj_new_list(0, nullptr);
-  m_segments = mp_obj_new_list(0, nullptr);
-  m_rects = mp_obj_new_list(0, nullptr);
-  m_labels = mp_obj_new_list(0, nullptr);
+  /* Only drop the columns, so that the garbage collection frees them. Nothing
+   * is allocated since this function is called during HandleException. */
+  m_dotX = Column<float>();
+  m_dotY = Column<float>();
+  m_dotColor = Column<KDColor>();
+  m_dotChunks = Column<Bounds>();
+  m_vertexX = Column<float>();
+  m_vertexY = Column<float>();
+  m_vertexChunks = Column<Bounds>();
+  m_curves = Column<Curve>();
+  m_rectLeft = Column<float>();
+  m_rectRight = Column<float>();
+  m_rectTop = Column<float>();
+  m_rectBottom = Column<float>();
+  m_rectColor = Column<KDColor>();
+  m_rectChunks = Column<Bounds>();
+  m_labels = Column<StoredLabel>();
   m_axesRequested = true;
   m_axesAuto = true;
   m_gridRequested = false;
 }
 
-// Iterators
+// Bounds
 
-template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::Begin(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  return it;
-}
-
-template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::End(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  if (it.m_numberOfTuples > 0) {
-    it.m_tupleIndex = it.m_numberOfTuples;
+void PlotStore::Bounds::extend(float x, float y) {
+  if (std::isnan(x) || std::isnan(y)) {
+    return;
   }
-  return it;
+  xMin = std::min(xMin, x);
+  xMax = std::max(xMax, x);
+  yMin = std::min(yMin, y);
+  yMax = std::max(yMax, y);
 }
 
-template <class T>
-PlotStore::ListIterator<T>& PlotStore::ListIterator<T>::operator++() {
-  if (m_tupleIndex < m_numberOfTuples) {
-    m_tupleIndex++;
+// Column
+
+template <typename T>
+void PlotStore::Column<T>::reserve(size_t length) {
+  if (m_length + length <= m_capacity) {
+    return;
+  }
+  // Grow by half of the capacity to limit both reallocations and waste
+  size_t capacity = std::max(m_length + length, m_capacity + m_capacity / 2);
+  m_values = m_renew(T, m_values, m_capacity, capacity);
+  m_capacity = capacity;
+}
+
+template class PlotStore::Column<float>;
+template class PlotStore::Column<KDColor>;
+template class PlotStore::Column<PlotStore::Bounds>;
+template class PlotStore::Column<PlotStore::Curve>;
+template class PlotStore::Column<PlotStore::StoredLabel>;
+
+void PlotStore::ExtendChunk(Column<Bounds>* chunks, size_t index, float x,
+                            float y) {
+  size_t chunk = index / k_chunkLength;
+  if (chunk == chunks->length()) {
+    chunks->append(Bounds::Empty());
   }
-  return *this;
+  (*chunks)[chunk].extend(x, y);
 }
 
-template <class T>
-bool PlotStore::ListIterator<T>::operator!=(
-    const PlotStore::ListIterator<T>& it) const {
-  return m_tupleIndex != it.m_tupleIndex;
-};
-
-template <class T>
-T PlotStore::ListIterator<T>::operator*() {
-  return T(m_tuples[m_tupleIndex]);
-};
+void PlotStore::ReserveChunks(Column<Bounds>* chunks, size_t length,
+                              size_t numberOfElements) {
+  size_t numberOfChunks =
+      (length + numberOfElements + k_chunkLength - 1) / k_chunkLength;
+  assert(numberOfChunks >= chunks->length());
+  chunks->reserve(numberOfChunks - chunks->length());
+}
 
 // Dot
 
-template class PlotStore::ListIterator<PlotStore::Dot>;
-
-PlotStore::Dot::Dot(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[2]));
+void PlotStore::reserveDots(size_t numberOfDots) {
+  m_dotX.reserve(numberOfDots);
+  m_dotY.reserve(numberOfDots);
+  m_dotColor.reserve(numberOfDots);
+  ReserveChunks(&m_dotChunks, m_dotX.length(), numberOfDots);
 }
 
-void PlotStore::addDot(mp_obj_t x, mp_obj_t y, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[3] = {x, y, color};
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_dots, tuple);
+void PlotStore::addDot(float x, float y, KDColor c) {
+  ExtendChunk(&m_dotChunks, m_dotX.length(), x, y);
+  m_dotX.append(x);
+  m_dotY.append(y);
+  m_dotColor.append(c);
 }
 
-// Segment
+// Curve
 
-template class PlotStore::ListIterator<PlotStore::Segment>;
+void PlotStore::startCurve(size_t numberOfVertices, KDColor c,
+                           float arrowWidth) {
+  m_curves.reserve(1);
+  m_vertexX.reserve(numberOfVertices);
+  m_vertexY.reserve(numberOfVertices);
+  ReserveChunks(&m_vertexChunks, m_vertexX.length(), numberOfVertices);
+  m_curves.append({.firstVertex = m_vertexX.length(),
+                   .numberOfVertices = 0,
+                   .arrowWidth = arrowWidth,
+                   .color = c});
+}
 
-PlotStore::Segment::Segment(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 6, &elements);
-  m_xStart = mp_obj_get_float(elements[0]);
-  m_yStart = mp_obj_get_float(elements[1]);
-  m_xEnd = mp_obj_get_float(elements[2]);
-  m_yEnd = mp_obj_get_float(elements[3]);
-  m_arrowWidth = mp_obj_get_float(elements[4]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[5]));
+void PlotStore::addVertex(float x, float y) {
+  size_t index = m_vertexX.length();
+  ExtendChunk(&m_vertexChunks, index, x, y);
+  if (index % k_chunkLength == 0 && index > 0) {
+    // The previous chunk includes the segment ending at this vertex
+    ExtendChunk(&m_vertexChunks, index - 1, x, y);
+  }
+  m_vertexX.append(x);
+  m_vertexY.append(y);
+  Curve& curve = m_curves[m_curves.length() - 1];
+  assert(curve.firstVertex + curve.numberOfVertices == index);
+  curve.numberOfVertices++;
 }
 
-void PlotStore::addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd,
-                           mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[6] = {xStart, yStart, xEnd, yEnd, arrowWidth, color};
-  mp_obj_t tuple = mp_obj_new_tuple(6, items);
-  mp_obj_list_append(m_segments, tuple);
+void PlotStore::addSegment(float xStart, float yStart, float xEnd, float yEnd,
+                           KDColor c, float arrowWidth) {
+  startCurve(2, c, arrowWidth);
+  addVertex(xStart, yStart);
+  addVertex(xEnd, yEnd);
 }
 
 // Rect
 
-template class PlotStore::ListIterator<PlotStore::Rect>;
-
-PlotStore::Rect::Rect(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 5, &elements);
-  m_left = mp_obj_get_float(elements[0]);
-  m_right = mp_obj_get_float(elements[1]);
-  m_top = mp_obj_get_float(elements[2]);
-  m_bottom = mp_obj_get_float(elements[3]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[4]));
+void PlotStore::reserveRects(size_t numberOfRects) {
+  m_rectLeft.reserve(numberOfRects);
+  m_rectRight.reserve(numberOfRects);
+  m_rectTop.reserve(numberOfRects);
+  m_rectBottom.reserve(numberOfRects);
+  m_rectColor.reserve(numberOfRects);
+  ReserveChunks(&m_rectChunks, m_rectLeft.length(), numberOfRects);
 }
 
-void PlotStore::addRect(mp_obj_t left, mp_obj_t right, mp_obj_t top,
-                        mp_obj_t bottom, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[5] = {left, right, top, bottom, color};
-  mp_obj_t tuple = mp_obj_new_tuple(5, items);
-  mp_obj_list_append(m_rects, tuple);
+void PlotStore::addRect(float left, float right, float top, float bottom,
+                        KDColor c) {
+  size_t index = m_rectLeft.length();
+  ExtendChunk(&m_rectChunks, index, left, top);
+  ExtendChunk(&m_rectChunks, index, right, bottom);
+  m_rectLeft.append(left);
+  m_rectRight.append(right);
+  m_rectTop.append(top);
+  m_rectBottom.append(bottom);
+  m_rectColor.append(c);
 }
 
 // Label
 
-template class PlotStore::ListIterator<PlotStore::Label>;
-
-PlotStore::Label::Label(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_string = mp_obj_str_get_str(elements[2]);
-}
-
-void PlotStore::addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string) {
-  mp_obj_t items[3] = {x, y, string};
+void PlotStore::addLabel(float x, float y, mp_obj_t string) {
   if (!mp_obj_is_str(string)) {
     mp_raise_TypeError("argument should be a string");
   }
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_labels, tuple);
+  m_labels.reserve(1);
+  m_labels.append({.x = x, .y = y, .string = string});
 }
 
 // Axes
@@ -182,22 +196,18 @@ void PlotStore::initRange() {
     float xMax = -FLT_MAX;
     float yMin = FLT_MAX;
     float yMax = -FLT_MAX;
-    for (PlotStore::Dot dot : dots()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, dot.x(), dot.y());
+    for (size_t i = 0; i < numberOfDots(); i++) {
+      updateRange(&xMin, &xMax, &yMin, &yMax, m_dotX[i], m_dotY[i]);
     }
-    for (PlotStore::Label label : labels()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, label.x(), label.y());
+    for (size_t i = 0; i < numberOfLabels(); i++) {
+      updateRange(&xMin, &xMax, &yMin, &yMax, m_labels[i].x, m_labels[i].y);
     }
-    for (PlotStore::Segment segment : segments()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, segment.xStart(),
-                  segment.yStart());
-      updateRange(&xMin, &xMax, &yMin, &yMax, segment.xEnd(), segment.yEnd());
+    for (size_t i = 0; i < m_vertexX.length(); i++) {
+      updateRange(&xMin, &xMax, &yMin, &yMax, m_vertexX[i], m_vertexY[i]);
     }
-    for (PlotStore::Rect rectangle : rects()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.left(),
-                  rectangle.top());
-      updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.right(),
-                  rectangle.bottom());
+    for (size_t i = 0; i < numberOfRects(); i++) {
+      updateRange(&xMin, &xMax, &yMin, &yMax, m_rectLeft[i], m_rectTop[i]);
+      updateRange(&xMin, &xMax, &yMin, &yMax, m_rectRight[i], m_rectBottom[i]);
     }
     checkPositiveRangeAndAddMargin(&xMin, &xMax);
     checkPositiveRangeAndAddMargin(&yMin, &yMax);
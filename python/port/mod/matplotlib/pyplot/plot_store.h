@@ -3,51 +3,75 @@
 
 // #include <apps/shared/curve_view_range.h>
 #include <apps/shared/interactive_curve_view_range.h>
+#include <assert.h>
 extern "C" {
 #include <py/runtime.h>
 }
 
 namespace Matplotlib {
 
+/* Plot primitives are stored in native columns of floats and colors rather
+ * than as lists of Python tuples, which took more than ten times the heap and
+ * had to be converted back to floats on each redraw.
+ * Dots, vertices and rectangles are grouped by chunks of k_chunkLength
+ * consecutive primitives, whose bounds are kept so that the chunks outside of
+ * the redrawn area are skipped. Consecutive primitives usually are close to
+ * each other, so that the chunks are small. */
+
 class PlotStore : public Shared::InteractiveCurveViewRange {
  public:
+  constexpr static size_t k_chunkLength = 32;
+
   PlotStore();
   void flush();
 
-  // Iterators
-
-  template <class T>
-  class ListIterator {
-   public:
-    static ListIterator Begin(mp_obj_t list);
-    static ListIterator End(mp_obj_t list);
-    T operator*();
-    ListIterator& operator++();
-    bool operator!=(const ListIterator& it) const;
-
-   private:
-    ListIterator() : m_tupleIndex(0) {}
-    mp_obj_t* m_tuples;
-    size_t m_numberOfTuples;
-    size_t m_tupleIndex;
+  struct Bounds {
+    static Bounds Empty() { return {FLT_MAX, -FLT_MAX, FLT_MAX, -FLT_MAX}; }
+    // NaN coordinates are ignored
+    void extend(float x, float y);
+    bool intersects(const Bounds& other) const {
+      return xMin <= other.xMax && other.xMin <= xMax && yMin <= other.yMax &&
+             other.yMin <= yMax;
+    }
+    float xMin;
+    float xMax;
+    float yMin;
+    float yMax;
   };
 
-  template <class T>
-  class Iterable {
+  /* Columns are allocated on the Python heap and only referenced by the store,
+   * which is scanned by the garbage collector. */
+  template <typename T>
+  class Column {
    public:
-    Iterable(mp_obj_t list) : m_list(list) {}
-    T begin() const { return T::Begin(m_list); }
-    T end() const { return T::End(m_list); }
+    Column() : m_values(nullptr), m_length(0), m_capacity(0) {}
+    size_t length() const { return m_length; }
+    T& operator[](size_t i) {
+      assert(i < m_length);
+      return m_values[i];
+    }
+    const T& operator[](size_t i) const {
+      assert(i < m_length);
+      return m_values[i];
+    }
+    // Raise a MemoryError if the column cannot hold length more values
+    void reserve(size_t length);
+    void append(const T& value) {
+      assert(m_length < m_capacity);
+      m_values[m_length++] = value;
+    }
 
    private:
-    mp_obj_t m_list;
+    T* m_values;
+    size_t m_length;
+    size_t m_capacity;
   };
 
   // Dot
 
   class Dot {
    public:
-    Dot(mp_obj_t tuple);
+    Dot(float x, float y, KDColor color) : m_x(x), m_y(y), m_color(color) {}
     float x() const { return m_x; }
     float y() const { return m_y; }
     KDColor color() const { return m_color; }
@@ -58,16 +82,29 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
     KDColor m_color;
   };
 
-  void addDot(mp_obj_t x, mp_obj_t y, KDColor c);
-  Iterable<ListIterator<Dot>> dots() {
-    return Iterable<ListIterator<Dot>>(m_dots);
+  // Dots must be reserved before they are added
+  void reserveDots(size_t numberOfDots);
+  void addDot(float x, float y, KDColor c);
+  size_t numberOfDots() const { return m_dotX.length(); }
+  Dot dotAtIndex(size_t i) const {
+    return Dot(m_dotX[i], m_dotY[i], m_dotColor[i]);
+  }
+  const Bounds& dotChunkBounds(size_t chunk) const {
+    return m_dotChunks[chunk];
   }
 
   // Segment
 
   class Segment {
    public:
-    Segment(mp_obj_t tuple);
+    Segment(float xStart, float yStart, float xEnd, float yEnd,
+            float arrowWidth, KDColor color)
+        : m_xStart(xStart),
+          m_yStart(yStart),
+          m_xEnd(xEnd),
+          m_yEnd(yEnd),
+          m_arrowWidth(arrowWidth),
+          m_color(color) {}
     float xStart() const { return m_xStart; }
     float yStart() const { return m_yStart; }
     float xEnd() const { return m_xEnd; }
@@ -84,18 +121,44 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
     KDColor m_color;
   };
 
-  void addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd,
-                  mp_obj_t yEnd, KDColor c,
-                  mp_obj_t arrowWidth = mp_obj_new_float(NAN));
-  Iterable<ListIterator<Segment>> segments() {
-    return Iterable<ListIterator<Segment>>(m_segments);
+  /* Curves are polylines, whose consecutive vertices are joined by segments.
+   * Arrows are curves of two vertices with an arrowhead at their end. */
+  struct Curve {
+    size_t firstVertex;
+    size_t numberOfVertices;
+    float arrowWidth;
+    KDColor color;
+  };
+
+  // The vertices of a curve are added right after it has been started
+  void startCurve(size_t numberOfVertices, KDColor c, float arrowWidth = NAN);
+  void addVertex(float x, float y);
+  void addSegment(float xStart, float yStart, float xEnd, float yEnd, KDColor c,
+                  float arrowWidth = NAN);
+  size_t numberOfCurves() const { return m_curves.length(); }
+  const Curve& curveAtIndex(size_t i) const { return m_curves[i]; }
+  // The segment from vertex i to vertex i + 1 of the curve
+  Segment segmentOfCurve(const Curve& curve, size_t i) const {
+    assert(curve.firstVertex <= i &&
+           i + 1 < curve.firstVertex + curve.numberOfVertices);
+    return Segment(m_vertexX[i], m_vertexY[i], m_vertexX[i + 1],
+                   m_vertexY[i + 1], curve.arrowWidth, curve.color);
+  }
+  // The bounds of a chunk include the segment starting at its last vertex
+  const Bounds& vertexChunkBounds(size_t chunk) const {
+    return m_vertexChunks[chunk];
   }
 
   // Rect
 
   class Rect {
    public:
-    Rect(mp_obj_t tuple);
+    Rect(float left, float right, float top, float bottom, KDColor color)
+        : m_left(left),
+          m_right(right),
+          m_top(top),
+          m_bottom(bottom),
+          m_color(color) {}
     float left() const { return m_left; }
     float right() const { return m_right; }
     float top() const { return m_top; }
@@ -110,17 +173,24 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
     KDColor m_color;
   };
 
-  void addRect(mp_obj_t x, mp_obj_t y, mp_obj_t width, mp_obj_t height,
-               KDColor c);
-  Iterable<ListIterator<Rect>> rects() {
-    return Iterable<ListIterator<Rect>>(m_rects);
+  // Rects must be reserved before they are added
+  void reserveRects(size_t numberOfRects);
+  void addRect(float left, float right, float top, float bottom, KDColor c);
+  size_t numberOfRects() const { return m_rectLeft.length(); }
+  Rect rectAtIndex(size_t i) const {
+    return Rect(m_rectLeft[i], m_rectRight[i], m_rectTop[i], m_rectBottom[i],
+                m_rectColor[i]);
+  }
+  const Bounds& rectChunkBounds(size_t chunk) const {
+    return m_rectChunks[chunk];
   }
 
   // Label
 
   class Label {
    public:
-    Label(mp_obj_t tuple);
+    Label(float x, float y, const char* string)
+        : m_x(x), m_y(y), m_string(string) {}
     float x() const { return m_x; }
     float y() const { return m_y; }
     const char* string() const { return m_string; }
@@ -131,9 +201,11 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
     const char* m_string;
   };
 
-  void addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string);
-  Iterable<ListIterator<Label>> labels() {
-    return Iterable<ListIterator<Label>>(m_labels);
+  void addLabel(float x, float y, mp_obj_t string);
+  size_t numberOfLabels() const { return m_labels.length(); }
+  Label labelAtIndex(size_t i) const {
+    return Label(m_labels[i].x, m_labels[i].y,
+                 mp_obj_str_get_str(m_labels[i].string));
   }
 
   void setAxesRequested(bool b) { m_axesRequested = b; }
@@ -147,10 +219,33 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
   bool gridRequested() const { return m_gridRequested; }
 
  private:
-  mp_obj_t m_dots;      // List of (x, y, color)
-  mp_obj_t m_labels;    // List of (x, y, string)
-  mp_obj_t m_segments;  // List of (x, y, dx, dy, style, color)
-  mp_obj_t m_rects;     // List of (x, y, w, h, color)
+  struct StoredLabel {
+    float x;
+    float y;
+    mp_obj_t string;
+  };
+
+  // Extend the bounds of the chunk of the index-th element of a column
+  static void ExtendChunk(Column<Bounds>* chunks, size_t index, float x,
+                          float y);
+  static void ReserveChunks(Column<Bounds>* chunks, size_t length,
+                            size_t numberOfElements);
+
+  Column<float> m_dotX;
+  Column<float> m_dotY;
+  Column<KDColor> m_dotColor;
+  Column<Bounds> m_dotChunks;
+  Column<float> m_vertexX;
+  Column<float> m_vertexY;
+  Column<Bounds> m_vertexChunks;
+  Column<Curve> m_curves;
+  Column<float> m_rectLeft;
+  Column<float> m_rectRight;
+  Column<float> m_rectTop;
+  Column<float> m_rectBottom;
+  Column<KDColor> m_rectColor;
+  Column<Bounds> m_rectChunks;
+  Column<StoredLabel> m_labels;
   bool m_axesRequested;
   bool m_axesAuto;
   bool m_gridRequested;
@@ -26,21 +26,66 @@ void OptionalAxes::drawAxesAndGrid(const Shared::AbstractPlotView* plotView,
 
 void PyplotPolicy::drawPlot(const AbstractPlotView* plotView, KDContext* ctx,
                             KDRect rect) const {
+  /* Chunks of primitives are skipped if their bounds do not intersect the
+   * redrawn rect, widened by a few pixels for the thickness of dots and
+   * segments. */
+  constexpr KDCoordinate k_margin = 3;
+  PlotStore::Bounds visible = {
+      .xMin = plotView->pixelToFloat(AbstractPlotView::Axis::Horizontal,
+                                     rect.left() - k_margin),
+      .xMax = plotView->pixelToFloat(AbstractPlotView::Axis::Horizontal,
+                                     rect.right() + k_margin),
+      .yMin = plotView->pixelToFloat(AbstractPlotView::Axis::Vertical,
+                                     rect.bottom() + k_margin),
+      .yMax = plotView->pixelToFloat(AbstractPlotView::Axis::Vertical,
+                                     rect.top() - k_margin)};
+  constexpr size_t k_chunkLength = PlotStore::k_chunkLength;
+
   /* The following lines use MicroPython, which can fail, so we need to use nlr
    * to catch any errors. */
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
-    for (PlotStore::Dot dot : m_store->dots()) {
-      traceDot(plotView, ctx, rect, dot);
+    size_t numberOfDots = m_store->numberOfDots();
+    for (size_t i = 0; i < numberOfDots; i++) {
+      if (i % k_chunkLength == 0 &&
+          !m_store->dotChunkBounds(i / k_chunkLength).intersects(visible)) {
+        i += k_chunkLength - 1;
+        continue;
+      }
+      traceDot(plotView, ctx, rect, m_store->dotAtIndex(i));
     }
-    for (PlotStore::Label label : m_store->labels()) {
-      traceLabel(plotView, ctx, rect, label);
+    size_t numberOfLabels = m_store->numberOfLabels();
+    for (size_t i = 0; i < numberOfLabels; i++) {
+      traceLabel(plotView, ctx, rect, m_store->labelAtIndex(i));
     }
-    for (PlotStore::Segment segment : m_store->segments()) {
-      traceSegment(plotView, ctx, rect, segment);
+    size_t numberOfCurves = m_store->numberOfCurves();
+    for (size_t c = 0; c < numberOfCurves; c++) {
+      const PlotStore::Curve& curve = m_store->curveAtIndex(c);
+      if (curve.numberOfVertices < 2) {
+        continue;
+      }
+      // Arrowheads may be drawn out of the bounds of their segment
+      bool clip = std::isnan(curve.arrowWidth);
+      size_t lastVertex = curve.firstVertex + curve.numberOfVertices - 1;
+      for (size_t i = curve.firstVertex; i < lastVertex; i++) {
+        if (clip && (i == curve.firstVertex || i % k_chunkLength == 0) &&
+            !m_store->vertexChunkBounds(i / k_chunkLength)
+                 .intersects(visible)) {
+          // Skip to the last vertex of the chunk
+          i = std::min(i - i % k_chunkLength + k_chunkLength, lastVertex) - 1;
+          continue;
+        }
+        traceSegment(plotView, ctx, rect, m_store->segmentOfCurve(curve, i));
+      }
     }
-    for (PlotStore::Rect rectangle : m_store->rects()) {
-      traceRect(plotView, ctx, rect, rectangle);
+    size_t numberOfRects = m_store->numberOfRects();
+    for (size_t i = 0; i < numberOfRects; i++) {
+      if (i % k_chunkLength == 0 &&
+          !m_store->rectChunkBounds(i / k_chunkLength).intersects(visible)) {
+        i += k_chunkLength - 1;
+        continue;
+      }
+      traceRect(plotView, ctx, rect, m_store->rectAtIndex(i));
     }
     nlr_pop();
   } else {  // Uncaught exception
@@ -6,6 +6,8 @@
  * The MIT License (MIT)
  *
  * Copyright (c) 2020-2021 Zoltán Vörös
+ *
+ * Some minor changes were made by NumWorks team.
 */
 
 
@@ -37,6 +39,61 @@
     uint16 + int16 => float
 */
 
+#if NDARRAY_HAS_BINARY_OP_ADD | NDARRAY_HAS_BINARY_OP_MULTIPLY | NDARRAY_HAS_BINARY_OP_POWER | NDARRAY_HAS_BINARY_OP_SUBTRACT | NDARRAY_HAS_BINARY_OP_TRUE_DIVIDE | NDARRAY_HAS_INPLACE_OPS
+static uint8_t ndarray_float_layout(size_t *shape, int32_t *strides) {
+    // Returns the layout of a float operand of the given shape, which is flat if it is dense or a
+    // broadcast scalar.
+    // The strides of the axes of length 1 are irrelevant.
+    int32_t dense_stride = sizeof(mp_float_t);
+    bool dense = true;
+    bool scalar = true;
+    for(uint8_t i=ULAB_MAX_DIMS; i > 0; i--) {
+        if(shape[i-1] > 1) {
+            dense = dense && (strides[i-1] == dense_stride);
+            scalar = scalar && (strides[i-1] == 0);
+            dense_stride *= shape[i-1];
+        }
+    }
+    return dense ? NDARRAY_LAYOUT_DENSE : (scalar ? NDARRAY_LAYOUT_SCALAR : NDARRAY_LAYOUT_STRIDED);
+}
+
+static bool ndarray_binary_float_flat(ndarray_obj_t *results, uint8_t *larray, int32_t *lstrides,
+                                            uint8_t *rarray, int32_t *rstrides, mp_binary_op_t op) {
+    // Applies op to float operands of the shape of results and stores the outcome in results,
+    // which may be the left hand side. Returns false if the operands are not flat.
+    uint8_t llayout = ndarray_float_layout(results->shape, lstrides);
+    uint8_t rlayout = ndarray_float_layout(results->shape, rstrides);
+    if((llayout == NDARRAY_LAYOUT_STRIDED) || (rlayout == NDARRAY_LAYOUT_STRIDED) ||
+        ((results->array == larray) && (llayout != NDARRAY_LAYOUT_DENSE))) {
+        return false;
+    }
+    switch(op) {
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_INPLACE_ADD:
+            FLAT_FLOAT_LOOP(results->array, larray, llayout, rarray, rlayout, results->len, lvalue + rvalue);
+            return true;
+        case MP_BINARY_OP_MULTIPLY:
+        case MP_BINARY_OP_INPLACE_MULTIPLY:
+            FLAT_FLOAT_LOOP(results->array, larray, llayout, rarray, rlayout, results->len, lvalue * rvalue);
+            return true;
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_INPLACE_SUBTRACT:
+            FLAT_FLOAT_LOOP(results->array, larray, llayout, rarray, rlayout, results->len, lvalue - rvalue);
+            return true;
+        case MP_BINARY_OP_TRUE_DIVIDE:
+        case MP_BINARY_OP_INPLACE_TRUE_DIVIDE:
+            FLAT_FLOAT_LOOP(results->array, larray, llayout, rarray, rlayout, results->len, lvalue / rvalue);
+            return true;
+        case MP_BINARY_OP_POWER:
+        case MP_BINARY_OP_INPLACE_POWER:
+            FLAT_FLOAT_LOOP(results->array, larray, llayout, rarray, rlayout, results->len, MICROPY_FLOAT_C_FUN(pow)(lvalue, rvalue));
+            return true;
+        default:
+            return false;
+    }
+}
+#endif
+
 #if NDARRAY_HAS_BINARY_OP_EQUAL | NDARRAY_HAS_BINARY_OP_NOT_EQUAL
 mp_obj_t ndarray_binary_equality(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
                                             uint8_t ndim, size_t *shape,  int32_t *lstrides, int32_t *rstrides, mp_binary_op_t op) {
@@ -238,6 +295,9 @@ mp_obj_t ndarray_binary_add(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     } else if(lhs->dtype == NDARRAY_FLOAT) {
         if(rhs->dtype == NDARRAY_FLOAT) {
             results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            if(ndarray_binary_float_flat(results, larray, lstrides, rarray, rstrides, MP_BINARY_OP_ADD)) {
+                return MP_OBJ_FROM_PTR(results);
+            }
             BINARY_LOOP(results, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides, +);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_ADD, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
@@ -321,6 +381,9 @@ mp_obj_t ndarray_binary_multiply(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     } else if(lhs->dtype == NDARRAY_FLOAT) {
         if(rhs->dtype == NDARRAY_FLOAT) {
             results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            if(ndarray_binary_float_flat(results, larray, lstrides, rarray, rstrides, MP_BINARY_OP_MULTIPLY)) {
+                return MP_OBJ_FROM_PTR(results);
+            }
             BINARY_LOOP(results, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides, *);
         } else {
             return ndarray_binary_op(MP_BINARY_OP_MULTIPLY, MP_OBJ_FROM_PTR(rhs), MP_OBJ_FROM_PTR(lhs));
@@ -573,6 +636,9 @@ mp_obj_t ndarray_binary_subtract(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
             BINARY_LOOP(results, mp_float_t, mp_float_t, int16_t, larray, lstrides, rarray, rstrides, -);
         } else if(rhs->dtype == NDARRAY_FLOAT) {
             results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            if(ndarray_binary_float_flat(results, larray, lstrides, rarray, rstrides, MP_BINARY_OP_SUBTRACT)) {
+                return MP_OBJ_FROM_PTR(results);
+            }
             BINARY_LOOP(results, mp_float_t, mp_float_t, mp_float_t, larray, lstrides, rarray, rstrides, -);
         }
     }
@@ -595,6 +661,11 @@ mp_obj_t ndarray_binary_true_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
+    if((lhs->dtype == NDARRAY_FLOAT) && (rhs->dtype == NDARRAY_FLOAT) &&
+        ndarray_binary_float_flat(results, larray, lstrides, rarray, rstrides, MP_BINARY_OP_TRUE_DIVIDE)) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+
     #if NDARRAY_BINARY_USES_FUN_POINTER
     mp_float_t (*get_lhs)(void *) = ndarray_get_float_function(lhs->dtype);
     mp_float_t (*get_rhs)(void *) = ndarray_get_float_function(rhs->dtype);
@@ -683,6 +754,11 @@ mp_obj_t ndarray_binary_power(ndarray_obj_t *lhs, ndarray_obj_t *rhs,
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
+    if((lhs->dtype == NDARRAY_FLOAT) && (rhs->dtype == NDARRAY_FLOAT) &&
+        ndarray_binary_float_flat(results, larray, lstrides, rarray, rstrides, MP_BINARY_OP_POWER)) {
+        return MP_OBJ_FROM_PTR(results);
+    }
+
     #if NDARRAY_BINARY_USES_FUN_POINTER
     mp_float_t (*get_lhs)(void *) = ndarray_get_float_function(lhs->dtype);
     mp_float_t (*get_rhs)(void *) = ndarray_get_float_function(rhs->dtype);
@@ -770,6 +846,11 @@ mp_obj_t ndarray_inplace_ams(ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32_t *rs
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
+    if((lhs->dtype == NDARRAY_FLOAT) && (rhs->dtype == NDARRAY_FLOAT) &&
+        ndarray_binary_float_flat(lhs, larray, lhs->strides, rarray, rstrides, optype)) {
+        return MP_OBJ_FROM_PTR(lhs);
+    }
+
     #if NDARRAY_HAS_INPLACE_ADD
     if(optype == MP_BINARY_OP_INPLACE_ADD) {
         UNWRAP_INPLACE_OPERATOR(lhs, larray, rarray, rstrides, +=);
@@ -799,6 +880,11 @@ mp_obj_t ndarray_inplace_divide(ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32_t
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
+    if((rhs->dtype == NDARRAY_FLOAT) &&
+        ndarray_binary_float_flat(lhs, larray, lhs->strides, rarray, rstrides, MP_BINARY_OP_INPLACE_TRUE_DIVIDE)) {
+        return MP_OBJ_FROM_PTR(lhs);
+    }
+
     if(rhs->dtype == NDARRAY_UINT8) {
         INPLACE_LOOP(lhs, mp_float_t, uint8_t, larray, rarray, rstrides, /=);
     } else if(rhs->dtype == NDARRAY_INT8) {
@@ -823,6 +909,11 @@ mp_obj_t ndarray_inplace_power(ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32_t *
     uint8_t *larray = (uint8_t *)lhs->array;
     uint8_t *rarray = (uint8_t *)rhs->array;
 
+    if((rhs->dtype == NDARRAY_FLOAT) &&
+        ndarray_binary_float_flat(lhs, larray, lhs->strides, rarray, rstrides, MP_BINARY_OP_INPLACE_POWER)) {
+        return MP_OBJ_FROM_PTR(lhs);
+    }
+
     if(rhs->dtype == NDARRAY_UINT8) {
         INPLACE_POWER(lhs, mp_float_t, uint8_t, larray, rarray, rstrides);
     } else if(rhs->dtype == NDARRAY_INT8) {
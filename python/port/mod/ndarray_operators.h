@@ -6,6 +6,8 @@
  * The MIT License (MIT)
  *
  * Copyright (c) 2020-2021 Zoltán Vörös
+ *
+ * Some minor changes were made by NumWorks team.
 */
 
 #include "ndarray.h"
@@ -22,6 +24,43 @@ mp_obj_t ndarray_inplace_ams(ndarray_obj_t *, ndarray_obj_t *, int32_t *, uint8_
 mp_obj_t ndarray_inplace_power(ndarray_obj_t *, ndarray_obj_t *, int32_t *);
 mp_obj_t ndarray_inplace_divide(ndarray_obj_t *, ndarray_obj_t *, int32_t *);
 
+/* Loops of the float operators on flat operands, which are either dense
+ * arrays or broadcast scalars. They carry no stride nor coordinate, and they
+ * are unrolled so that the compiler may vectorise them. OPERATION is an
+ * expression of lvalue and rvalue, like in FUNC_POINTER_LOOP. */
+#define NDARRAY_LAYOUT_STRIDED      (0)
+#define NDARRAY_LAYOUT_DENSE        (1)
+#define NDARRAY_LAYOUT_SCALAR       (2)
+
+#define UNROLLED_LOOP(len, STATEMENT)\
+({  size_t i = 0;\
+    for(; i + 4 <= (len); i += 4) {\
+        { const size_t n = i; STATEMENT; }\
+        { const size_t n = i + 1; STATEMENT; }\
+        { const size_t n = i + 2; STATEMENT; }\
+        { const size_t n = i + 3; STATEMENT; }\
+    }\
+    for(; i < (len); i++) {\
+        const size_t n = i;\
+        STATEMENT;\
+    }\
+})
+
+#define FLAT_FLOAT_LOOP(array, larray, llayout, rarray, rlayout, len, OPERATION)\
+({  mp_float_t *out = (mp_float_t *)(array);\
+    const mp_float_t *lin = (const mp_float_t *)(larray);\
+    const mp_float_t *rin = (const mp_float_t *)(rarray);\
+    if((rlayout) == NDARRAY_LAYOUT_SCALAR) {\
+        const mp_float_t rvalue = *rin;\
+        UNROLLED_LOOP((len), const mp_float_t lvalue = lin[n]; out[n] = (OPERATION));\
+    } else if((llayout) == NDARRAY_LAYOUT_SCALAR) {\
+        const mp_float_t lvalue = *lin;\
+        UNROLLED_LOOP((len), const mp_float_t rvalue = rin[n]; out[n] = (OPERATION));\
+    } else {\
+        UNROLLED_LOOP((len), const mp_float_t lvalue = lin[n]; const mp_float_t rvalue = rin[n]; out[n] = (OPERATION));\
+    }\
+})
+
 #define UNWRAP_INPLACE_OPERATOR(lhs, larray, rarray, rstrides, OPERATOR)\
 ({\
     if((lhs)->dtype == NDARRAY_UINT8) {\
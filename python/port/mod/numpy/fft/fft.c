@@ -0,0 +1,156 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * This file was written by NumWorks team.
+*/
+
+#include <math.h>
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "../../ulab.h"
+#include "../../ulab_tools.h"
+#include "fft.h"
+#include "fft_tools.h"
+
+#if ULAB_NUMPY_HAS_FFT_MODULE
+
+//| """Frequency-domain functions"""
+//|
+
+// Complex arrays are not supported, so that the transforms are returned as a tuple of
+// their real and imaginary parts.
+
+static size_t fft_length(mp_obj_t oin) {
+    size_t len;
+    if(mp_obj_is_type(oin, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(oin);
+        if(ndarray->ndim != 1) {
+            mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+        }
+        len = ndarray->len;
+    } else if(ndarray_object_is_array_like(oin)) {
+        len = (size_t)mp_obj_get_int(mp_obj_len_maybe(oin));
+    } else {
+        mp_raise_TypeError(translate("input must be an ndarray, or an iterable"));
+    }
+    if((len == 0) || ((len & (len - 1)) != 0)) {
+        mp_raise_ValueError(translate("input array length must be power of 2"));
+    }
+    return len;
+}
+
+static ndarray_obj_t *fft_new_float_copy(mp_obj_t oin, size_t len) {
+    // The transforms are computed in place in these copies, which are returned
+    ndarray_obj_t *out = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *array = (mp_float_t *)out->array;
+    if(mp_obj_is_type(oin, &ulab_ndarray_type)) {
+        ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(oin);
+        mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+        uint8_t *iarray = (uint8_t *)ndarray->array;
+        for(size_t i=0; i < len; i++) {
+            array[i] = func(iarray);
+            iarray += ndarray->strides[ULAB_MAX_DIMS - 1];
+        }
+    } else {
+        fill_array_iterable(array, oin);
+    }
+    return out;
+}
+
+static mp_obj_t fft_fft_ifft(size_t n_args, const mp_obj_t *args, bool inverse) {
+    size_t len = fft_length(args[0]);
+    ndarray_obj_t *out_re = fft_new_float_copy(args[0], len);
+    ndarray_obj_t *out_im;
+    if((n_args == 2) && (args[1] != mp_const_none)) {
+        if(fft_length(args[1]) != len) {
+            mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
+        }
+        out_im = fft_new_float_copy(args[1], len);
+    } else {
+        out_im = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    }
+    mp_float_t *data_re = (mp_float_t *)out_re->array;
+    mp_float_t *data_im = (mp_float_t *)out_im->array;
+
+    if((n_args == 1) || (args[1] == mp_const_none)) {
+        fft_real_kernel(data_re, data_im, len);
+        if(inverse) {
+            // the inverse transform of a real signal is the conjugate of its transform
+            for(size_t i=0; i < len; i++) {
+                data_im[i] = -data_im[i];
+            }
+        }
+    } else {
+        fft_kernel(data_re, data_im, len, inverse);
+    }
+    if(inverse) {
+        for(size_t i=0; i < len; i++) {
+            data_re[i] /= len;
+            data_im[i] /= len;
+        }
+    }
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(out_re);
+    tuple[1] = MP_OBJ_FROM_PTR(out_im);
+    return mp_obj_new_tuple(2, tuple);
+}
+
+#if ULAB_FFT_HAS_FFT
+//| def fft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param r: A 1-dimension array of values whose size is a power of 2
+//|     :param c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
+//|     :return tuple (r, c): The real and complex parts of the FFT
+//|
+//|     Perform a Fast Fourier Transform from the time domain into the frequency domain"""
+//|     ...
+//|
+
+static mp_obj_t fft_fft(size_t n_args, const mp_obj_t *args) {
+    return fft_fft_ifft(n_args, args, false);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_fft_obj, 1, 2, fft_fft);
+#endif
+
+#if ULAB_FFT_HAS_IFFT
+//| def ifft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param r: A 1-dimension array of values whose size is a power of 2
+//|     :param c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
+//|     :return tuple (r, c): The real and complex parts of the inverse FFT
+//|
+//|     Perform an Inverse Fast Fourier Transform from the frequency domain into the time domain"""
+//|     ...
+//|
+
+static mp_obj_t fft_ifft(size_t n_args, const mp_obj_t *args) {
+    return fft_fft_ifft(n_args, args, true);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_ifft_obj, 1, 2, fft_ifft);
+#endif
+
+static const mp_rom_map_elem_t ulab_fft_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_fft) },
+    #if ULAB_FFT_HAS_FFT
+    { MP_ROM_QSTR(MP_QSTR_fft), MP_ROM_PTR(&fft_fft_obj) },
+    #endif
+    #if ULAB_FFT_HAS_IFFT
+    { MP_ROM_QSTR(MP_QSTR_ifft), MP_ROM_PTR(&fft_ifft_obj) },
+    #endif
+};
+
+static MP_DEFINE_CONST_DICT(mp_module_ulab_fft_globals, ulab_fft_globals_table);
+
+const mp_obj_module_t ulab_fft_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_ulab_fft_globals,
+};
+
+#endif /* ULAB_NUMPY_HAS_FFT_MODULE */
@@ -0,0 +1,128 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * This file was written by NumWorks team.
+*/
+
+#include <math.h>
+#include "py/runtime.h"
+
+#include "../../ndarray.h"
+#include "fft_tools.h"
+
+/*
+ * The following functions compute the discrete Fourier transform of arrays, whose length
+ * is a power of 2, in place. The real and imaginary parts are stored in two separate arrays,
+ * so that the transform of a real signal does not require any buffer beyond the output.
+ * The twiddle factors are computed by recurrence rather than read from a table.
+ */
+
+void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, bool inverse) {
+    // radix-2 decimation in time; the inverse transform is not normalised
+    if(n < 2) {
+        return;
+    }
+    // bit reversal permutation
+    size_t j = 0;
+    for(size_t i=0; i < n - 1; i++) {
+        if(i < j) {
+            mp_float_t swap = real[i];
+            real[i] = real[j];
+            real[j] = swap;
+            swap = imag[i];
+            imag[i] = imag[j];
+            imag[j] = swap;
+        }
+        size_t m = n >> 1;
+        while(j & m) {
+            j ^= m;
+            m >>= 1;
+        }
+        j |= m;
+    }
+    // butterflies
+    for(size_t mmax=1; mmax < n; mmax <<= 1) {
+        mp_float_t theta = (inverse ? MP_PI : -MP_PI) / mmax;
+        mp_float_t wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+        // w is multiplied by 1 + wp at each step
+        mp_float_t wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+        mp_float_t wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        mp_float_t wr = MICROPY_FLOAT_CONST(1.0);
+        mp_float_t wi = MICROPY_FLOAT_CONST(0.0);
+        for(size_t m=0; m < mmax; m++) {
+            for(size_t i=m; i < n; i += 2 * mmax) {
+                size_t k = i + mmax;
+                mp_float_t tempr = wr * real[k] - wi * imag[k];
+                mp_float_t tempi = wr * imag[k] + wi * real[k];
+                real[k] = real[i] - tempr;
+                imag[k] = imag[i] - tempi;
+                real[i] += tempr;
+                imag[i] += tempi;
+            }
+            wtemp = wr;
+            wr += wr * wpr - wi * wpi;
+            wi += wi * wpr + wtemp * wpi;
+        }
+    }
+}
+
+void fft_real_kernel(mp_float_t *real, mp_float_t *imag, size_t n) {
+    // Computes the transform of the real signal stored in real. The even and odd samples
+    // are packed as the real and imaginary parts of a signal of half the length, whose
+    // transform is then untangled into the first half of the spectrum. The second half
+    // follows from the Hermitian symmetry of the transform of a real signal.
+    if(n < 2) {
+        imag[0] = MICROPY_FLOAT_CONST(0.0);
+        return;
+    }
+    size_t h = n / 2;
+    for(size_t k=0; k < h; k++) {
+        imag[k] = real[2 * k + 1];
+        real[k] = real[2 * k];
+    }
+    fft_kernel(real, imag, h, false);
+
+    mp_float_t zr = real[0];
+    mp_float_t zi = imag[0];
+    real[0] = zr + zi;
+    imag[0] = MICROPY_FLOAT_CONST(0.0);
+    real[h] = zr - zi;
+    imag[h] = MICROPY_FLOAT_CONST(0.0);
+
+    mp_float_t theta = -MP_PI / h;
+    mp_float_t wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+    mp_float_t wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+    mp_float_t wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+    mp_float_t wr = MICROPY_FLOAT_CONST(1.0) + wpr;
+    mp_float_t wi = wpi;
+    for(size_t k=1; k <= h / 2; k++) {
+        // the transforms of the even and odd samples are
+        // e = (z[k] + conj(z[h-k])) / 2 and o = -i (z[k] - conj(z[h-k])) / 2
+        zr = real[k];
+        zi = imag[k];
+        mp_float_t cr = real[h - k];
+        mp_float_t ci = imag[h - k];
+        mp_float_t even_r = MICROPY_FLOAT_CONST(0.5) * (zr + cr);
+        mp_float_t even_i = MICROPY_FLOAT_CONST(0.5) * (zi - ci);
+        mp_float_t odd_r = MICROPY_FLOAT_CONST(0.5) * (zi + ci);
+        mp_float_t odd_i = MICROPY_FLOAT_CONST(-0.5) * (zr - cr);
+        // x[k] = e + w^k o and x[h-k] = conj(e - w^k o)
+        mp_float_t tr = wr * odd_r - wi * odd_i;
+        mp_float_t ti = wr * odd_i + wi * odd_r;
+        real[k] = even_r + tr;
+        imag[k] = even_i + ti;
+        real[h - k] = even_r - tr;
+        imag[h - k] = ti - even_i;
+        wtemp = wr;
+        wr += wr * wpr - wi * wpi;
+        wi += wi * wpr + wtemp * wpi;
+    }
+    for(size_t k=1; k < h; k++) {
+        real[n - k] = real[k];
+        imag[n - k] = -imag[k];
+    }
+}
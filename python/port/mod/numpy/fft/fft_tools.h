@@ -0,0 +1,17 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * This file was written by NumWorks team.
+*/
+
+#ifndef _FFT_TOOLS_
+#define _FFT_TOOLS_
+
+void fft_kernel(mp_float_t *, mp_float_t *, size_t , bool );
+void fft_real_kernel(mp_float_t *, mp_float_t *, size_t );
+
+#endif /* _FFT_TOOLS_ */
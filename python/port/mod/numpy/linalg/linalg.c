@@ -0,0 +1,290 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * This file was written by NumWorks team.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "../../ulab.h"
+#include "../../ulab_tools.h"
+#include "linalg.h"
+
+#if ULAB_NUMPY_HAS_LINALG_MODULE
+
+//| """Linear algebra functions"""
+//|
+
+// The functions work on dense float copies of their inputs, which are either returned or the
+// only full-size buffer they allocate.
+
+static void linalg_fill_float(mp_float_t *out, ndarray_obj_t *ndarray) {
+    // copies the entries of an array of at most two dimensions into a dense array of floats
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    size_t rows = ndarray->ndim > 1 ? ndarray->shape[ULAB_MAX_DIMS - 2] : 1;
+    for(size_t i=0; i < rows; i++) {
+        uint8_t *array = (uint8_t *)ndarray->array + i * ndarray->strides[ULAB_MAX_DIMS - 2];
+        for(size_t j=0; j < ndarray->shape[ULAB_MAX_DIMS - 1]; j++) {
+            *out++ = func(array);
+            array += ndarray->strides[ULAB_MAX_DIMS - 1];
+        }
+    }
+}
+
+static mp_float_t *linalg_new_square_copy(ndarray_obj_t *ndarray) {
+    size_t N = ndarray->shape[ULAB_MAX_DIMS - 1];
+    mp_float_t *data = m_new(mp_float_t, N * N);
+    linalg_fill_float(data, ndarray);
+    return data;
+}
+
+#if ULAB_LINALG_HAS_DET
+//| def det(m: ulab.numpy.ndarray) -> float:
+//|     """
+//|     :param: m, a square matrix
+//|     :return float: The determinant of the matrix
+//|
+//|     Computes the determinant of a square matrix"""
+//|     ...
+//|
+
+static mp_obj_t linalg_det(mp_obj_t oin) {
+    ndarray_obj_t *ndarray = tools_object_is_square(oin);
+    size_t N = ndarray->shape[ULAB_MAX_DIMS - 1];
+    mp_float_t *data = linalg_new_square_copy(ndarray);
+    mp_float_t det = linalg_determinant(data, N);
+    m_del(mp_float_t, data, N * N);
+    return mp_obj_new_float(det);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_det_obj, linalg_det);
+#endif
+
+#if ULAB_LINALG_HAS_EIG
+//| def eig(m: ulab.numpy.ndarray) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param m: a symmetric square matrix
+//|     :return tuple (eigenvalues, eigenvectors):
+//|
+//|     Computes the eigenvalues and eigenvectors of a symmetric square matrix"""
+//|     ...
+//|
+
+static mp_obj_t linalg_eig(mp_obj_t oin) {
+    ndarray_obj_t *in = tools_object_is_square(oin);
+    size_t S = in->shape[ULAB_MAX_DIMS - 1];
+    mp_float_t *array = linalg_new_square_copy(in);
+    for(size_t m=0; m < S; m++) {
+        for(size_t n=m+1; n < S; n++) {
+            if(LINALG_EPSILON < MICROPY_FLOAT_C_FUN(fabs)(array[m * S + n] - array[n * S + m])) {
+                m_del(mp_float_t, array, S * S);
+                mp_raise_ValueError(translate("input matrix is asymmetric"));
+            }
+        }
+    }
+    ndarray_obj_t *eigenvectors = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, S, S), NDARRAY_FLOAT);
+    size_t iterations = linalg_jacobi_rotations(array, (mp_float_t *)eigenvectors->array, S);
+    if(iterations == 0) {
+        m_del(mp_float_t, array, S * S);
+        mp_raise_ValueError(translate("iterations did not converge"));
+    }
+    ndarray_obj_t *eigenvalues = ndarray_new_linear_array(S, NDARRAY_FLOAT);
+    mp_float_t *eigvalues = (mp_float_t *)eigenvalues->array;
+    for(size_t i=0; i < S; i++) {
+        eigvalues[i] = array[i * (S + 1)];
+    }
+    m_del(mp_float_t, array, S * S);
+
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(eigenvalues);
+    tuple[1] = MP_OBJ_FROM_PTR(eigenvectors);
+    return mp_obj_new_tuple(2, tuple);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_eig_obj, linalg_eig);
+#endif
+
+#if ULAB_LINALG_HAS_INV
+//| def inv(m: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ~ulab.numpy.ndarray m: a square matrix
+//|     :return: The inverse of the matrix, if it exists
+//|     :raises ValueError: if the matrix is not invertible
+//|
+//|     Computes the inverse of a square matrix"""
+//|     ...
+//|
+
+static mp_obj_t linalg_inv(mp_obj_t oin) {
+    ndarray_obj_t *ndarray = tools_object_is_square(oin);
+    size_t N = ndarray->shape[ULAB_MAX_DIMS - 1];
+    ndarray_obj_t *inverted = ndarray_new_dense_ndarray(2, ndarray_shape_vector(0, 0, N, N), NDARRAY_FLOAT);
+    mp_float_t *data = (mp_float_t *)inverted->array;
+    linalg_fill_float(data, ndarray);
+    if(!linalg_invert_matrix(data, N)) {
+        mp_raise_ValueError(translate("input matrix is singular"));
+    }
+    return MP_OBJ_FROM_PTR(inverted);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_inv_obj, linalg_inv);
+#endif
+
+#if ULAB_LINALG_HAS_NORM
+//| def norm(x: ulab.numpy.ndarray, axis: Optional[int] = None) -> Union[float, ulab.numpy.ndarray]:
+//|     """
+//|     :param ~ulab.numpy.ndarray x: a vector or a matrix
+//|     :param axis: the axis along which the norm is computed
+//|
+//|     Computes the 2-norm of a vector or the Frobenius norm of a matrix, or the norms of
+//|     the vectors along the given axis"""
+//|     ...
+//|
+
+static mp_obj_t linalg_norm(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+        { MP_QSTR_axis, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t x = args[0].u_obj;
+    mp_obj_t axis = args[1].u_obj;
+
+    if(!mp_obj_is_type(x, &ulab_ndarray_type)) {
+        if(!ndarray_object_is_array_like(x)) {
+            mp_raise_TypeError(translate("input must be an ndarray, or an iterable"));
+        }
+        // iterables are vectors, whose entries are only read once
+        mp_float_t dot = MICROPY_FLOAT_CONST(0.0);
+        mp_obj_iter_buf_t buf;
+        mp_obj_t item, iterable = mp_getiter(x, &buf);
+        while((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            mp_float_t value = mp_obj_get_float(item);
+            dot += value * value;
+        }
+        return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(dot));
+    }
+
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(x);
+    if(ndarray->ndim > 2) {
+        mp_raise_ValueError(translate("norm is defined for 1D and 2D arrays"));
+    }
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    size_t rows = ndarray->ndim > 1 ? ndarray->shape[ULAB_MAX_DIMS - 2] : 1;
+    size_t columns = ndarray->shape[ULAB_MAX_DIMS - 1];
+    int8_t ax = -1;
+    if((axis != mp_const_none) && (ndarray->ndim > 1)) {
+        ax = tools_get_axis(axis, ndarray->ndim);
+    }
+
+    ndarray_obj_t *results = NULL;
+    mp_float_t *rarray = NULL;
+    mp_float_t dot = MICROPY_FLOAT_CONST(0.0);
+    if(ax >= 0) {
+        results = ndarray_new_linear_array(ax == 0 ? columns : rows, NDARRAY_FLOAT);
+        rarray = (mp_float_t *)results->array;
+    }
+    for(size_t i=0; i < rows; i++) {
+        uint8_t *array = (uint8_t *)ndarray->array + i * ndarray->strides[ULAB_MAX_DIMS - 2];
+        for(size_t j=0; j < columns; j++) {
+            mp_float_t value = func(array);
+            if(ax < 0) {
+                dot += value * value;
+            } else {
+                rarray[ax == 0 ? j : i] += value * value;
+            }
+            array += ndarray->strides[ULAB_MAX_DIMS - 1];
+        }
+    }
+    if(ax < 0) {
+        return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(dot));
+    }
+    for(size_t i=0; i < results->len; i++) {
+        rarray[i] = MICROPY_FLOAT_C_FUN(sqrt)(rarray[i]);
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(linalg_norm_obj, 1, linalg_norm);
+#endif
+
+#if ULAB_LINALG_HAS_SOLVE
+//| def solve(a: ulab.numpy.ndarray, b: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ~ulab.numpy.ndarray a: a square matrix
+//|     :param ~ulab.numpy.ndarray b: a vector, or a matrix with as many rows as a
+//|     :return: The solution x of the linear system a x = b
+//|     :raises ValueError: if the matrix is singular
+//|
+//|     Solves a linear system"""
+//|     ...
+//|
+
+static mp_obj_t linalg_solve(mp_obj_t oa, mp_obj_t ob) {
+    ndarray_obj_t *a = tools_object_is_square(oa);
+    size_t N = a->shape[ULAB_MAX_DIMS - 1];
+    ndarray_obj_t *x;
+    if(mp_obj_is_type(ob, &ulab_ndarray_type)) {
+        ndarray_obj_t *b = MP_OBJ_TO_PTR(ob);
+        if((b->ndim > 2) || (b->shape[ULAB_MAX_DIMS - b->ndim] != N)) {
+            mp_raise_ValueError(translate("matrix dimensions do not match"));
+        }
+        x = ndarray_new_dense_ndarray(b->ndim, b->shape, NDARRAY_FLOAT);
+        linalg_fill_float((mp_float_t *)x->array, b);
+    } else {
+        if(!ndarray_object_is_array_like(ob) || ((size_t)mp_obj_get_int(mp_obj_len_maybe(ob)) != N)) {
+            mp_raise_ValueError(translate("matrix dimensions do not match"));
+        }
+        x = ndarray_new_linear_array(N, NDARRAY_FLOAT);
+        fill_array_iterable((mp_float_t *)x->array, ob);
+    }
+    size_t K = x->ndim > 1 ? x->shape[ULAB_MAX_DIMS - 1] : 1;
+    mp_float_t *data = linalg_new_square_copy(a);
+    bool solved = linalg_solve_system(data, (mp_float_t *)x->array, N, K);
+    m_del(mp_float_t, data, N * N);
+    if(!solved) {
+        mp_raise_ValueError(translate("input matrix is singular"));
+    }
+    return MP_OBJ_FROM_PTR(x);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_2(linalg_solve_obj, linalg_solve);
+#endif
+
+static const mp_rom_map_elem_t ulab_linalg_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_linalg) },
+    #if ULAB_LINALG_HAS_DET
+    { MP_ROM_QSTR(MP_QSTR_det), MP_ROM_PTR(&linalg_det_obj) },
+    #endif
+    #if ULAB_LINALG_HAS_EIG
+    { MP_ROM_QSTR(MP_QSTR_eig), MP_ROM_PTR(&linalg_eig_obj) },
+    #endif
+    #if ULAB_LINALG_HAS_INV
+    { MP_ROM_QSTR(MP_QSTR_inv), MP_ROM_PTR(&linalg_inv_obj) },
+    #endif
+    #if ULAB_LINALG_HAS_NORM
+    { MP_ROM_QSTR(MP_QSTR_norm), MP_ROM_PTR(&linalg_norm_obj) },
+    #endif
+    #if ULAB_LINALG_HAS_SOLVE
+    { MP_ROM_QSTR(MP_QSTR_solve), MP_ROM_PTR(&linalg_solve_obj) },
+    #endif
+};
+
+static MP_DEFINE_CONST_DICT(mp_module_ulab_linalg_globals, ulab_linalg_globals_table);
+
+const mp_obj_module_t ulab_linalg_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_ulab_linalg_globals,
+};
+
+#endif /* ULAB_NUMPY_HAS_LINALG_MODULE */
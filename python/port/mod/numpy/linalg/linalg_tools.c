@@ -6,6 +6,8 @@
  * The MIT License (MIT)
  *
  * Copyright (c) 2019-2010 Zoltán Vörös
+ *
+ * Some minor changes were made by NumWorks team.
 */
 
 #include <math.h>
@@ -18,62 +20,154 @@
  * The following function inverts a matrix, whose entries are given in the input array
  * The function has no dependencies beyond micropython itself (for the definition of mp_float_t),
  * and can be used independent of ulab.
+ * The matrix is inverted in place by Gauss-Jordan elimination, so that only the indices of
+ * the pivot rows are allocated.
  */
 
 bool linalg_invert_matrix(mp_float_t *data, size_t N) {
     // returns true, of the inversion was successful,
     // false, if the matrix is singular
 
-    // initially, this is the unit matrix: the contents of this matrix is what
-    // will be returned after all the transformations
-    mp_float_t *unit = m_new0(mp_float_t, N*N);
-    mp_float_t elem = 1.0;
-
+    size_t *pivots = m_new(size_t, N);
     for(size_t m=0; m < N; m++) {
-        memcpy(&unit[m * (N+1)], &elem, sizeof(mp_float_t));
-    }
-    for(size_t m=0; m < N; m++){
-        // this could be faster with ((c < epsilon) && (c > -epsilon))
+        // look for a line to swap, if the pivot vanishes
+        size_t p = m;
         if(MICROPY_FLOAT_C_FUN(fabs)(data[m * (N+1)]) < LINALG_EPSILON) {
-            //look for a line to swap
-            size_t m1 = m + 1;
-            for(; m1 < N; m1++) {
-                if(!(MICROPY_FLOAT_C_FUN(fabs)(data[m1*N + m]) < LINALG_EPSILON)) {
-                    for(size_t m2=0; m2 < N; m2++) {
-                        mp_float_t swapVal = data[m*N+m2];
-                        data[m*N+m2] = data[m1*N+m2];
-                        data[m1*N+m2] = swapVal;
-                        swapVal = unit[m*N+m2];
-                        unit[m*N+m2] = unit[m1*N+m2];
-                        unit[m1*N+m2] = swapVal;
-                    }
-                    break;
-                }
+            p = m + 1;
+            while((p < N) && (MICROPY_FLOAT_C_FUN(fabs)(data[p * N + m]) < LINALG_EPSILON)) {
+                p++;
             }
-            if (m1 >= N) {
-                m_del(mp_float_t, unit, N*N);
+            if(p >= N) {
+                m_del(size_t, pivots, N);
                 return false;
             }
         }
+        pivots[m] = p;
+        if(p != m) {
+            for(size_t k=0; k < N; k++) {
+                mp_float_t swap = data[m * N + k];
+                data[m * N + k] = data[p * N + k];
+                data[p * N + k] = swap;
+            }
+        }
+        // the column of the pivot is replaced by the column of the inverse
+        mp_float_t elem = MICROPY_FLOAT_CONST(1.0) / data[m * (N+1)];
+        data[m * (N+1)] = MICROPY_FLOAT_CONST(1.0);
+        for(size_t k=0; k < N; k++) {
+            data[m * N + k] *= elem;
+        }
         for(size_t n=0; n < N; n++) {
-            if(m != n){
-                elem = data[N * n + m] / data[m * (N+1)];
+            if(n != m) {
+                elem = data[n * N + m];
+                data[n * N + m] = MICROPY_FLOAT_CONST(0.0);
                 for(size_t k=0; k < N; k++) {
-                    data[N * n + k] -= elem * data[N * m + k];
-                    unit[N * n + k] -= elem * unit[N * m + k];
+                    data[n * N + k] -= elem * data[m * N + k];
                 }
             }
         }
     }
+    // swapping rows of the matrix swaps the columns of its inverse
+    for(size_t m=N; m > 0; m--) {
+        size_t p = pivots[m-1];
+        if(p != m-1) {
+            for(size_t n=0; n < N; n++) {
+                mp_float_t swap = data[n * N + m-1];
+                data[n * N + m-1] = data[n * N + p];
+                data[n * N + p] = swap;
+            }
+        }
+    }
+    m_del(size_t, pivots, N);
+    return true;
+}
+
+/*
+ * The following function calculates the determinant of a matrix, whose entries are given
+ * in the input array, by LU decomposition with partial pivoting. The input array is overwritten.
+ */
+
+mp_float_t linalg_determinant(mp_float_t *data, size_t N) {
+    mp_float_t det = MICROPY_FLOAT_CONST(1.0);
     for(size_t m=0; m < N; m++) {
-        elem = data[m * (N+1)];
-        for(size_t n=0; n < N; n++) {
-            data[N * m + n] /= elem;
-            unit[N * m + n] /= elem;
+        size_t p = m;
+        for(size_t m1=m+1; m1 < N; m1++) {
+            if(MICROPY_FLOAT_C_FUN(fabs)(data[m1 * N + m]) > MICROPY_FLOAT_C_FUN(fabs)(data[p * N + m])) {
+                p = m1;
+            }
+        }
+        if(data[p * N + m] == MICROPY_FLOAT_CONST(0.0)) {
+            return MICROPY_FLOAT_CONST(0.0);
+        }
+        if(p != m) {
+            for(size_t k=m; k < N; k++) {
+                mp_float_t swap = data[m * N + k];
+                data[m * N + k] = data[p * N + k];
+                data[p * N + k] = swap;
+            }
+            det = -det;
+        }
+        mp_float_t pivot = data[m * (N+1)];
+        det *= pivot;
+        for(size_t n=m+1; n < N; n++) {
+            mp_float_t elem = data[n * N + m] / pivot;
+            for(size_t k=m+1; k < N; k++) {
+                data[n * N + k] -= elem * data[m * N + k];
+            }
+        }
+    }
+    return det;
+}
+
+/*
+ * The following function solves the linear system a x = b, where a is a square matrix of size N,
+ * and b is a matrix with N rows and K columns, by Gaussian elimination with partial pivoting.
+ * Both input arrays are overwritten, and the solution is returned in b.
+ */
+
+bool linalg_solve_system(mp_float_t *a, mp_float_t *b, size_t N, size_t K) {
+    // returns false, if the matrix is singular
+    for(size_t m=0; m < N; m++) {
+        size_t p = m;
+        for(size_t m1=m+1; m1 < N; m1++) {
+            if(MICROPY_FLOAT_C_FUN(fabs)(a[m1 * N + m]) > MICROPY_FLOAT_C_FUN(fabs)(a[p * N + m])) {
+                p = m1;
+            }
+        }
+        if(MICROPY_FLOAT_C_FUN(fabs)(a[p * N + m]) < LINALG_EPSILON) {
+            return false;
+        }
+        if(p != m) {
+            for(size_t k=m; k < N; k++) {
+                mp_float_t swap = a[m * N + k];
+                a[m * N + k] = a[p * N + k];
+                a[p * N + k] = swap;
+            }
+            for(size_t k=0; k < K; k++) {
+                mp_float_t swap = b[m * K + k];
+                b[m * K + k] = b[p * K + k];
+                b[p * K + k] = swap;
+            }
+        }
+        for(size_t n=m+1; n < N; n++) {
+            mp_float_t elem = a[n * N + m] / a[m * (N+1)];
+            for(size_t k=m+1; k < N; k++) {
+                a[n * N + k] -= elem * a[m * N + k];
+            }
+            for(size_t k=0; k < K; k++) {
+                b[n * K + k] -= elem * b[m * K + k];
+            }
+        }
+    }
+    // back substitution
+    for(size_t m=N; m > 0; m--) {
+        for(size_t k=0; k < K; k++) {
+            mp_float_t sum = b[(m-1) * K + k];
+            for(size_t n=m; n < N; n++) {
+                sum -= a[(m-1) * N + n] * b[n * K + k];
+            }
+            b[(m-1) * K + k] = sum / a[(m-1) * (N+1)];
         }
     }
-    memcpy(data, unit, sizeof(mp_float_t)*N*N);
-    m_del(mp_float_t, unit, N * N);
     return true;
 }
 
@@ -6,6 +6,8 @@
  * The MIT License (MIT)
  *
  * Copyright (c) 2019-2021 Zoltán Vörös
+ *
+ * Some minor changes were made by NumWorks team.
 */
 
 #ifndef _TOOLS_TOOLS_
@@ -22,6 +24,8 @@
 #define JACOBI_MAX     20
 
 bool linalg_invert_matrix(mp_float_t *, size_t );
+mp_float_t linalg_determinant(mp_float_t *, size_t );
+bool linalg_solve_system(mp_float_t *, mp_float_t *, size_t , size_t );
 size_t linalg_jacobi_rotations(mp_float_t *, mp_float_t *, size_t );
 
 #endif /* _TOOLS_TOOLS_ */
@@ -51,25 +51,27 @@
 
 #define ULAB_NUMPY_HAS_WHERE            (0)
 
-#define ULAB_NUMPY_HAS_LINALG_MODULE    (0)
+#define ULAB_NUMPY_HAS_LINALG_MODULE    (1)
 
 #define ULAB_LINALG_HAS_CHOLESKY        (0)
 
-#define ULAB_LINALG_HAS_DET             (0)
+#define ULAB_LINALG_HAS_DET             (1)
 
-#define ULAB_LINALG_HAS_EIG             (0)
+#define ULAB_LINALG_HAS_EIG             (1)
 
-#define ULAB_LINALG_HAS_INV             (0)
+#define ULAB_LINALG_HAS_INV             (1)
 
-#define ULAB_LINALG_HAS_NORM            (0)
+#define ULAB_LINALG_HAS_NORM            (1)
 
 #define ULAB_LINALG_HAS_QR              (0)
 
-#define ULAB_NUMPY_HAS_FFT_MODULE       (0)
+#define ULAB_LINALG_HAS_SOLVE           (1)
 
-#define ULAB_FFT_HAS_FFT                (0)
+#define ULAB_NUMPY_HAS_FFT_MODULE       (1)
 
-#define ULAB_FFT_HAS_IFFT               (0)
+#define ULAB_FFT_HAS_FFT                (1)
+
+#define ULAB_FFT_HAS_IFFT               (1)
 
 #define ULAB_NUMPY_HAS_ALL              (0)
 
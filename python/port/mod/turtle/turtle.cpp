@@ -3,6 +3,7 @@
 #include <escher/palette.h>
 #include <kandinsky/ion_context.h>
 
+#include <algorithm>
 #include <cmath>
 extern "C" {
 #include <py/misc.h>
@@ -12,6 +13,12 @@ extern "C" {
 
 static inline mp_float_t absF(mp_float_t x) { return x >= 0 ? x : -x; }
 
+// The smallest rect containing both points
+static inline KDRect rectBetween(KDPoint p, KDPoint q) {
+  return KDRect(std::min(p.x(), q.x()), std::min(p.y(), q.y()),
+                std::abs(q.x() - p.x()) + 1, std::abs(q.y() - p.y()) + 1);
+}
+
 constexpr static KDCoordinate k_iconSize = 15;
 constexpr static KDCoordinate k_iconBodySize = 5;
 constexpr static KDCoordinate k_iconHeadSize = 3;
@@ -50,25 +57,9 @@ void Turtle::reset() {
 }
 
 bool Turtle::forward(mp_float_t length) {
-  /* cos and sin use radians, we thus need to multiply m_heading by PI/180 to
-   * compute the new turtle position. This induces rounding errors that are
-   * really visible when one expects a horizontal/vertical line and it is not.
-   * We thus make special cases for angles in degrees creating vertical /
-   * horizontal lines. */
-  if (m_heading == 0) {
-    return goTo(m_x + length, m_y);
-  }
-  if (m_heading == 180 || m_heading == -180) {
-    return goTo(m_x - length, m_y);
-  }
-  if (m_heading == 90 || m_heading == -270) {
-    return goTo(m_x, m_y + length);
-  }
-  if (m_heading == 270 || m_heading == -90) {
-    return goTo(m_x, m_y - length);
-  }
-  return goTo(m_x + length * std::cos(m_heading * k_headingScale),
-              m_y + length * std::sin(m_heading * k_headingScale));
+  mp_float_t x, y;
+  nextPosition(length, &x, &y);
+  return goTo(x, y);
 }
 
 void Turtle::left(mp_float_t angle) { setHeading(m_heading + angle); }
@@ -79,8 +70,17 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
   if (length > 1) {
     for (int i = 1; i < length; i++) {
       mp_float_t progress = i / length;
-      // Move the turtle forward
-      if (forward(1)) {
+      // Move the turtle forward, without drawing it if the circle is batched
+      mp_float_t x, y;
+      nextPosition(1, &x, &y);
+      bool interrupted;
+      if (isBatched(x, y)) {
+        erase();
+        interrupted = drawSegment(x, y);
+      } else {
+        interrupted = goTo(x, y);
+      }
+      if (interrupted) {
         // Keyboard interruption. Return now to let MicroPython process it.
         return;
       }
@@ -93,6 +93,12 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
 }
 
 bool Turtle::goTo(mp_float_t x, mp_float_t y) {
+  if (isBatched(x, y)) {
+    erase();
+    // Keyboard interruption. Return now to let MicroPython process it.
+    return drawSegment(x, y) || draw(true);
+  }
+
   mp_float_t oldx = m_x;
   mp_float_t oldy = m_y;
   mp_float_t xLength = absF(std::floor(x) - std::floor(oldx));
@@ -205,12 +211,35 @@ void Turtle::write(const char* string) {
 
 void Turtle::viewDidDisappear() { m_drawn = false; }
 
-bool Turtle::isOutOfBounds() const {
-  return absF(x()) > k_maxPosition || absF(y()) > k_maxPosition;
-};
-
 // Private functions
 
+void Turtle::nextPosition(mp_float_t length, mp_float_t* x,
+                          mp_float_t* y) const {
+  /* cos and sin use radians, we thus need to multiply m_heading by PI/180 to
+   * compute the new turtle position. This induces rounding errors that are
+   * really visible when one expects a horizontal/vertical line and it is not.
+   * We thus make special cases for angles in degrees creating vertical /
+   * horizontal lines. */
+  *x = m_x;
+  *y = m_y;
+  if (m_heading == 0) {
+    *x += length;
+  } else if (m_heading == 180 || m_heading == -180) {
+    *x -= length;
+  } else if (m_heading == 90 || m_heading == -270) {
+    *y += length;
+  } else if (m_heading == 270 || m_heading == -90) {
+    *y -= length;
+  } else {
+    *x += length * std::cos(m_heading * k_headingScale);
+    *y += length * std::sin(m_heading * k_headingScale);
+  }
+}
+
+bool Turtle::isOutOfBounds(mp_float_t x, mp_float_t y) {
+  return absF(x) > k_maxPosition || absF(y) > k_maxPosition;
+}
+
 void Turtle::setHeadingPrivate(mp_float_t angle) {
   // Put the angle in [0; 360[
   mp_float_t angleLimit = 360;
@@ -371,11 +400,7 @@ bool Turtle::dot(mp_float_t x, mp_float_t y) {
 
   // Draw the dot if the pen is down
   if (m_penDown && hasDotBuffers() && !isOutOfBounds()) {
-    KDContext* ctx = KDIonContext::SharedContext;
-    KDRect rect(
-        position(x, y).translatedBy(KDPoint(-m_penSize / 2, -m_penSize / 2)),
-        KDSize(m_penSize, m_penSize));
-    ctx->blendRectWithMask(rect, m_color, m_dotMask, m_dotWorkingPixelBuffer);
+    drawDot(position(x, y));
   }
 
   /* Increase the turtle's mileage. We need to make sure the mileage is not
@@ -393,6 +418,110 @@ bool Turtle::dot(mp_float_t x, mp_float_t y) {
   return micropython_port_vm_hook_loop();
 }
 
+bool Turtle::drawSegment(mp_float_t x, mp_float_t y) {
+  assert(isBatched(x, y));
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
+      ->displaySandbox();
+  KDPoint start = position();
+  KDPoint end = position(x, y);
+  m_x = x;
+  m_y = y;
+  if (!m_penDown || !hasDotBuffers()) {
+    return micropython_port_vm_hook_loop();
+  }
+
+  /* Rasterize the segment with Bresenham's algorithm, from the pixel after the
+   * start, which was drawn by the previous move, to the end. Like dot, the
+   * start is drawn if the turtle does not leave its pixel. */
+  int dx = end.x() - start.x();
+  int dy = end.y() - start.y();
+  bool xIsPrincipal = std::abs(dx) >= std::abs(dy);
+  int length = std::max(std::abs(dx), std::abs(dy));
+  int secondaryLength = std::min(std::abs(dx), std::abs(dy));
+  KDPoint principalStep =
+      xIsPrincipal ? KDPoint(dx < 0 ? -1 : 1, 0) : KDPoint(0, dy < 0 ? -1 : 1);
+  KDPoint secondaryStep =
+      xIsPrincipal ? KDPoint(0, dy < 0 ? -1 : 1) : KDPoint(dx < 0 ? -1 : 1, 0);
+  if (length == 0) {
+    drawDot(end);
+    return micropython_port_vm_hook_loop();
+  }
+
+  /* Batched moves can go far beyond the screen, only rasterize the pixels
+   * whose principal coordinate is on the screen, or close enough for the pen
+   * to reach it. This also keeps the size of the runs within KDCoordinate. */
+  int principalStart = xIsPrincipal ? start.x() : start.y();
+  int principalDirection = principalStep.x() + principalStep.y();
+  int screenLength = xIsPrincipal ? Ion::Display::Width : Ion::Display::Height;
+  int firstOnScreen = -m_penSize - principalStart;
+  int lastOnScreen = screenLength + m_penSize - principalStart;
+  if (principalDirection < 0) {
+    std::swap(firstOnScreen, lastOnScreen);
+    firstOnScreen = -firstOnScreen;
+    lastOnScreen = -lastOnScreen;
+  }
+  int first = std::max(1, firstOnScreen);
+  int last = std::min(length, lastOnScreen);
+  if (first > last) {
+    return micropython_port_vm_hook_loop();
+  }
+
+  /* Start from the pixel before the first one: the number of secondary steps
+   * taken after i pixels is the number of times the error went below 0. */
+  int skipped = first - 1;
+  int64_t secondaryProgress =
+      static_cast<int64_t>(skipped) * secondaryLength - length / 2;
+  int secondarySteps =
+      static_cast<int>((secondaryProgress + length - 1) / length);
+  int error = static_cast<int>(static_cast<int64_t>(secondarySteps) * length -
+                               secondaryProgress);
+
+  /* With the default pen, the pixels sharing their secondary coordinate are
+   * filled at once. Wider pens blend their mask at each pixel. */
+  bool drawsRuns = m_penSize == 1;
+  KDContext* ctx = KDIonContext::SharedContext;
+  KDPoint current(start.x() + principalStep.x() * skipped +
+                      secondaryStep.x() * secondarySteps,
+                  start.y() + principalStep.y() * skipped +
+                      secondaryStep.y() * secondarySteps);
+  KDPoint runStart = current.translatedBy(principalStep);
+  for (int i = first; i <= last; i++) {
+    KDPoint next = current.translatedBy(principalStep);
+    error -= secondaryLength;
+    if (error < 0) {
+      error += length;
+      next = next.translatedBy(secondaryStep);
+      if (drawsRuns && i > first) {
+        // The run ends at the current pixel
+        ctx->fillRect(rectBetween(runStart, current), m_color);
+        if (micropython_port_vm_hook_loop()) {
+          return true;
+        }
+      }
+      runStart = next;
+    }
+    current = next;
+    if (!drawsRuns) {
+      drawDot(current);
+      if (micropython_port_vm_hook_loop()) {
+        return true;
+      }
+    }
+  }
+  if (drawsRuns) {
+    ctx->fillRect(rectBetween(runStart, current), m_color);
+  }
+  return micropython_port_vm_hook_loop();
+}
+
+void Turtle::drawDot(KDPoint center) {
+  assert(m_dotMask != nullptr && m_dotWorkingPixelBuffer != nullptr);
+  KDRect rect(center.translatedBy(KDPoint(-m_penSize / 2, -m_penSize / 2)),
+              KDSize(m_penSize, m_penSize));
+  KDIonContext::SharedContext->blendRectWithMask(rect, m_color, m_dotMask,
+                                                 m_dotWorkingPixelBuffer);
+}
+
 void Turtle::drawPaw(PawType type, PawPosition pos) {
   assert(!m_drawn);
   assert(m_underneathPixelBuffer != nullptr);
@@ -82,7 +82,7 @@ class Turtle {
    * coordinate overflows. However, this solution makes the turtle go faster
    * when out of bound, and can prevent text that would have been visible to be
    * drawn. We use very large bounds to temper these effects. */
-  bool isOutOfBounds() const;
+  bool isOutOfBounds() const { return isOutOfBounds(m_x, m_y); }
 
  private:
   constexpr static mp_float_t k_headingScale = M_PI / 180;
@@ -115,6 +115,13 @@ class Turtle {
   };
 
   void setHeadingPrivate(mp_float_t angle);
+  void nextPosition(mp_float_t length, mp_float_t* x, mp_float_t* y) const;
+  static bool isOutOfBounds(mp_float_t x, mp_float_t y);
+  /* At speed 0, moves are not animated: segments are rasterized at once and
+   * the turtle icon is only drawn at the end of the command. */
+  bool isBatched(mp_float_t x, mp_float_t y) const {
+    return m_speed == 0 && !isOutOfBounds() && !isOutOfBounds(x, y);
+  }
   KDPoint position(mp_float_t x, mp_float_t y) const;
   KDPoint position() const { return position(m_x, m_y); }
 
@@ -127,6 +134,9 @@ class Turtle {
   // Interruptible methods that return true if they have been interrupted
   bool draw(bool force);
   bool dot(mp_float_t x, mp_float_t y);
+  bool drawSegment(mp_float_t x, mp_float_t y);
+
+  void drawDot(KDPoint center);
 
   void drawPaw(PawType type, PawPosition position);
   void erase();
@@ -391,6 +391,10 @@
 #define ULAB_LINALG_HAS_QR              (1)
 #endif
 
+#ifndef ULAB_LINALG_HAS_SOLVE
+#define ULAB_LINALG_HAS_SOLVE           (1)
+#endif
+
 // the FFT module; functions of the fft module still have
 // to be defined separately
 #ifndef ULAB_NUMPY_HAS_FFT_MODULE
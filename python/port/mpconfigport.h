@@ -23,9 +23,21 @@
 // Maximum length of a path in the filesystem
 #define MICROPY_ALLOC_PATH_MAX (32)
 
+/* Whether to load and save compiled scripts, which are cached in the storage.
+ * This changes the bytecode of all scripts: qstrs are encoded on two bytes and
+ * objects are read from the constant table of the function instead of being
+ * inlined. Measured on the simulator, the python code grows by about 5 KB,
+ * mostly persistentcode.c, and neither compiling nor running scripts is
+ * measurably slower. */
+#define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_SAVE (1)
+
 // Whether to include the garbage collector
 #define MICROPY_ENABLE_GC (1)
 
+// Whether the heap can be made of several regions, cf MicroPython::init
+#define MICROPY_GC_SPLIT_HEAP (1)
+
 // Whether to check C stack usage
 #define MICROPY_STACK_CHECK (1)
 
@@ -98,7 +110,7 @@
 #define MICROPY_PY_CMATH (1)
 
 // Whether to provide "gc" module
-#define MICROPY_PY_GC (0)
+#define MICROPY_PY_GC (1)
 
 // Whether to provide "io" module
 #define MICROPY_PY_IO (0)
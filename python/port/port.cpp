@@ -7,6 +7,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
 /* py/parsenum.h is a C header which uses C keyword restrict.
  * It does not exist in C++ so we define it here in order to be able to include
  * py/parsenum.h header. */
@@ -26,6 +28,7 @@ extern "C" {
 #include "py/mphal.h"
 #include "py/nlr.h"
 #include "py/parsenum.h"
+#include "py/persistentcode.h"
 #include "py/repl.h"
 #include "py/runtime.h"
 #include "py/stackctrl.h"
@@ -34,6 +37,7 @@ extern "C" {
 #include <escher/palette.h>
 
 static MicroPython::ScriptProvider *sScriptProvider = nullptr;
+static micropython_port_gc_stats_t sGCStats;
 static MicroPython::ExecutionEnvironment *sCurrentExecutionEnvironment =
     nullptr;
 
@@ -148,7 +152,8 @@ extern "C" {
 extern const void *_process_stack_end;
 }
 
-void MicroPython::init(void *heapStart, void *heapEnd) {
+void MicroPython::init(void *heapStart, void *heapEnd, void *heapExtensionStart,
+                       void *heapExtensionEnd) {
 #if __EMSCRIPTEN__
   static mp_obj_t pystack[1024];
   mp_pystack_init(pystack, &pystack[MP_ARRAY_SIZE(pystack)]);
@@ -176,6 +181,10 @@ void MicroPython::init(void *heapStart, void *heapEnd) {
   mp_stack_set_limit(29152);
 #endif
   gc_init(heapStart, heapEnd);
+  if (heapExtensionStart != nullptr) {
+    gc_add(heapExtensionStart, heapExtensionEnd);
+  }
+  sGCStats = micropython_port_gc_stats_t();
   mp_init();
 }
 
@@ -325,11 +334,25 @@ void gc_collect_regs_and_stack(void) {
 }
 
 void gc_collect(void) {
+  // The peak usage is sampled right before the heap is reclaimed
+  gc_info_t info;
+  gc_info(&info);
+  sGCStats.peak_used = std::max(sGCStats.peak_used, info.used);
+  uint64_t collectionStart = Ion::Timing::millis();
   gc_collect_start();
   modturtle_gc_collect();
   modpyplot_gc_collect();
   gc_collect_regs_and_stack();
   gc_collect_end();
+  uint32_t pause =
+      static_cast<uint32_t>(Ion::Timing::millis() - collectionStart);
+  sGCStats.collections++;
+  sGCStats.total_pause_ms += pause;
+  sGCStats.max_pause_ms = std::max(sGCStats.max_pause_ms, pause);
+}
+
+const micropython_port_gc_stats_t *micropython_port_gc_stats() {
+  return &sGCStats;
 }
 
 void nlr_jump_fail(void *val) {
@@ -352,6 +375,53 @@ mp_lexer_t *mp_lexer_new_from_file(const char *filename) {
   }
 }
 
+mp_raw_code_t *mp_raw_code_load_or_compile_file(const char *filename) {
+  if (sScriptProvider == nullptr) {
+    mp_raise_OSError(MP_ENOENT);
+  }
+  const char *script = sScriptProvider->contentOfScript(filename, true);
+  if (script == nullptr) {
+    mp_raise_OSError(MP_ENOENT);
+  }
+  size_t scriptLength = strlen(script);
+  uint32_t checksum = Ion::crc32Byte(
+      reinterpret_cast<const uint8_t *>(script), scriptLength);
+  size_t compiledSize;
+  const void *compiled =
+      sScriptProvider->compiledScript(filename, checksum, &compiledSize);
+  if (compiled != nullptr) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+      mp_raw_code_t *rawCode = mp_raw_code_load_mem(
+          static_cast<const byte *>(compiled), compiledSize);
+      nlr_pop();
+      return rawCode;
+    }
+    /* A ValueError means that the cached code was saved by another version of
+     * MicroPython, compile the script again to replace it. Other errors, such
+     * as a MemoryError or a KeyboardInterrupt, are the caller's concern. */
+    if (!mp_obj_exception_match(MP_OBJ_FROM_PTR(nlr.ret_val),
+                                MP_OBJ_FROM_PTR(&mp_type_ValueError))) {
+      nlr_jump(nlr.ret_val);
+    }
+  }
+  qstr sourceName = qstr_from_str(filename);
+  mp_lexer_t *lex =
+      mp_lexer_new_from_str_len(sourceName, script, scriptLength, 0);
+  mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+  mp_raw_code_t *rawCode =
+      mp_compile_to_raw_code(&parseTree, sourceName, false);
+  /* Storing the compiled code may move the records of the storage, script
+   * must not be used afterwards. */
+  vstr_t blob;
+  mp_print_t print;
+  vstr_init_print(&blob, 64, &print);
+  mp_raw_code_save(rawCode, &print);
+  sScriptProvider->storeCompiledScript(filename, checksum, blob.buf, blob.len);
+  vstr_clear(&blob);
+  return rawCode;
+}
+
 mp_import_stat_t mp_import_stat(const char *path) {
   if (sScriptProvider && sScriptProvider->contentOfScript(path, false)) {
     return MP_IMPORT_STAT_FILE;
@@ -15,6 +15,15 @@ class ScriptProvider {
  public:
   virtual const char* contentOfScript(const char* name,
                                       bool markAsFetched) const = 0;
+  /* Compiled scripts are cached as .mpy blobs tagged with the checksum of the
+   * content they were compiled from, so that editing a script invalidates its
+   * compiled code. Providers without a cache compile scripts on each import. */
+  virtual const void* compiledScript(const char* name, uint32_t checksum,
+                                     size_t* size) const {
+    return nullptr;
+  }
+  virtual void storeCompiledScript(const char* name, uint32_t checksum,
+                                   const void* data, size_t size) const {}
 };
 
 class ExecutionEnvironment {
@@ -42,7 +51,10 @@ class ExecutionEnvironment {
   void interrupt();
 };
 
-void init(void* heapStart, void* heapEnd);
+/* The heap can be extended with a second region, which does not need to be
+ * contiguous to the first one. */
+void init(void* heapStart, void* heapEnd, void* heapExtensionStart = nullptr,
+          void* heapExtensionEnd = nullptr);
 void deinit();
 void registerScriptProvider(ScriptProvider* s);
 void collectRootsAtAddress(char* address, int len);
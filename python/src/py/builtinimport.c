@@ -129,7 +129,8 @@ STATIC mp_import_stat_t find_file(const char *file_str, uint file_len, vstr_t *d
     return stat_dir_or_file(dest);
 }
 
-#if MICROPY_MODULE_FROZEN_STR || MICROPY_ENABLE_COMPILER
+/* Warning: this is a NumWorks change to MicroPython 1.17 */
+#if MICROPY_MODULE_FROZEN_STR || (MICROPY_ENABLE_COMPILER && !(MICROPY_PERSISTENT_CODE_LOAD && MICROPY_PERSISTENT_CODE_SAVE))
 STATIC void do_load_from_lexer(mp_obj_t module_obj, mp_lexer_t *lex) {
     #if MICROPY_PY___FILE__
     qstr source_name = lex->source_name;
@@ -142,7 +143,8 @@ STATIC void do_load_from_lexer(mp_obj_t module_obj, mp_lexer_t *lex) {
 }
 #endif
 
-#if (MICROPY_HAS_FILE_READER && MICROPY_PERSISTENT_CODE_LOAD) || MICROPY_MODULE_FROZEN_MPY
+/* Warning: this is a NumWorks change to MicroPython 1.17 */
+#if MICROPY_PERSISTENT_CODE_LOAD || MICROPY_MODULE_FROZEN_MPY
 STATIC void do_execute_raw_code(mp_obj_t module_obj, mp_raw_code_t *raw_code, const char *source_name) {
     (void)source_name;
 
@@ -219,8 +221,17 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     }
     #endif
 
+    /* Warning: this is a NumWorks change to MicroPython 1.17 */
+    // If the port caches compiled scripts, execute the cached code if the
+    // script has not changed since it was compiled.
+    #if MICROPY_ENABLE_COMPILER && MICROPY_PERSISTENT_CODE_LOAD && MICROPY_PERSISTENT_CODE_SAVE
+    {
+        mp_raw_code_t *raw_code = mp_raw_code_load_or_compile_file(file_str);
+        do_execute_raw_code(module_obj, raw_code, file_str);
+        return;
+    }
     // If we can compile scripts then load the file and compile and execute it.
-    #if MICROPY_ENABLE_COMPILER
+    #elif MICROPY_ENABLE_COMPILER
     {
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
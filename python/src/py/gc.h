@@ -29,8 +29,16 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "py/mpconfig.h"
+
 void gc_init(void *start, void *end);
 
+/* Warning: this is a NumWorks change to MicroPython 1.17 */
+#if MICROPY_GC_SPLIT_HEAP
+// Add an area to the heap, after gc_init
+void gc_add(void *start, void *end);
+#endif
+
 // These lock/unlock functions can be nested.
 // They can be used to prevent the GC from allocating/freeing.
 void gc_lock(void);
@@ -76,6 +76,37 @@ STATIC mp_obj_t gc_mem_alloc(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(gc_mem_alloc_obj, gc_mem_alloc);
 
+/* Warning: this is a NumWorks change to MicroPython 1.17 */
+// stats(): return a dict describing the heap and the collections so far
+STATIC mp_obj_t gc_stats(void) {
+    gc_info_t info;
+    gc_info(&info);
+    const micropython_port_gc_stats_t *stats = micropython_port_gc_stats();
+    size_t max_free = info.max_free * MICROPY_BYTES_PER_GC_BLOCK;
+    // the share of the free memory not in the largest free chunk, in percent
+    size_t fragmentation = info.free == 0 ? 0 : 100 - max_free * 100 / info.free;
+    mp_obj_t dict = mp_obj_new_dict(9);
+    const struct {
+        qstr key;
+        size_t value;
+    } entries[] = {
+        { MP_QSTR_collections, stats->collections },
+        { MP_QSTR_pause_ms, stats->total_pause_ms },
+        { MP_QSTR_max_pause_ms, stats->max_pause_ms },
+        { MP_QSTR_peak, MAX(stats->peak_used, info.used) },
+        { MP_QSTR_used, info.used },
+        { MP_QSTR_free, info.free },
+        { MP_QSTR_total, info.total },
+        { MP_QSTR_max_free, max_free },
+        { MP_QSTR_fragmentation, fragmentation },
+    };
+    for (size_t i = 0; i < MP_ARRAY_SIZE(entries); i++) {
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(entries[i].key), mp_obj_new_int_from_uint(entries[i].value));
+    }
+    return dict;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_stats_obj, gc_stats);
+
 #if MICROPY_GC_ALLOC_THRESHOLD
 STATIC mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
     if (n_args == 0) {
@@ -103,6 +134,7 @@ STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_isenabled), MP_ROM_PTR(&gc_isenabled_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_free), MP_ROM_PTR(&gc_mem_free_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_alloc), MP_ROM_PTR(&gc_mem_alloc_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&gc_stats_obj) },
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
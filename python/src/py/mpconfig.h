@@ -153,6 +153,13 @@
 #define MICROPY_GC_CONSERVATIVE_CLEAR (MICROPY_ENABLE_GC)
 #endif
 
+/* Warning: this is a NumWorks change to MicroPython 1.17 */
+// Whether the GC heap can be made of several areas, the first one given to
+// gc_init and the next ones added with gc_add.
+#ifndef MICROPY_GC_SPLIT_HEAP
+#define MICROPY_GC_SPLIT_HEAP (0)
+#endif
+
 // Support automatic GC when reaching allocation threshold,
 // configurable by gc.threshold().
 #ifndef MICROPY_GC_ALLOC_THRESHOLD
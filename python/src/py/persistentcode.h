@@ -108,6 +108,10 @@ mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len);
 mp_raw_code_t *mp_raw_code_load_file(const char *filename);
 
 void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print);
+
+/* Warning: this is a NumWorks change to MicroPython 1.17 */
+// Implemented by the port, which caches the compiled code of the scripts
+mp_raw_code_t *mp_raw_code_load_or_compile_file(const char *filename);
 void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename);
 
 void mp_native_relocate(void *reloc, uint8_t *text, uintptr_t reloc_text);
@@ -0,0 +1,41 @@
+#include <quiz.h>
+
+#include "execution_environment.h"
+
+QUIZ_CASE(python_gc) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import gc");
+  assert_command_execution_succeeds(env, "gc.collect()");
+  assert_command_execution_succeeds(env, "gc.stats()['collections']", "1\n");
+  assert_command_execution_succeeds(
+      env, "0 <= gc.stats()['fragmentation'] <= 100", "True\n");
+  assert_command_execution_fails(env,
+                                 "a = [str(i) * 8000 for i in range(9)]");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_gc_heap_extension) {
+  // The extension is not contiguous to the heap
+  static char heapExtension[32768];
+  MicroPython::init(TestExecutionEnvironment::s_pythonHeap,
+                    TestExecutionEnvironment::s_pythonHeap +
+                        TestExecutionEnvironment::s_pythonHeapSize,
+                    heapExtension, heapExtension + sizeof(heapExtension));
+  TestExecutionEnvironment env;
+  assert_command_execution_succeeds(env, "import gc");
+  assert_command_execution_succeeds(env, "gc.stats()['total'] > 90000",
+                                    "True\n");
+  // Objects are allocated in both regions
+  assert_command_execution_succeeds(
+      env, "a = [str(i) * 8000 for i in range(9)]");
+  assert_command_execution_succeeds(env, "gc.collect()");
+  assert_command_execution_succeeds(env, "gc.stats()['used'] > 72000",
+                                    "True\n");
+  /* Freed objects might still be referenced by stale pointers of the
+   * conservatively scanned stack, but the peak usage remains. */
+  assert_command_execution_succeeds(env, "a = None");
+  assert_command_execution_succeeds(env, "gc.collect()");
+  assert_command_execution_succeeds(env, "gc.stats()['peak'] > 72000",
+                                    "True\n");
+  deinit_environment();
+}
@@ -1,5 +1,9 @@
 #include <quiz.h>
 
+#include <kandinsky/ion_context.h>
+
+#include "../port/mod/matplotlib/pyplot/plot_store.h"
+#include "../port/mod/matplotlib/pyplot/pyplot_view.h"
 #include "execution_environment.h"
 
 QUIZ_CASE(python_matplotlib_pyplot_import) {
@@ -122,6 +126,8 @@ QUIZ_CASE(python_matplotlib_pyplot_plot) {
       env, "plot([2,3,4,5,6],[3,4,5,6,7], color=\"g\")");
   assert_command_execution_succeeds(env, "show()");
   assert_command_execution_fails(env, "plot([2,3,4,5,6],2)");
+  assert_command_execution_fails(env, "plot([1,2],['a','b'])");
+  assert_command_execution_succeeds(env, "show()");
   deinit_environment();
 #endif
 }
@@ -151,3 +157,74 @@ QUIZ_CASE(python_matplotlib_pyplot_text) {
   deinit_environment();
 #endif
 }
+
+QUIZ_CASE(python_matplotlib_pyplot_ndarray) {
+#ifndef PLATFORM_WINDOWS
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "x = np.linspace(0, 10, 2000)");
+  assert_command_execution_succeeds(env, "plot(x, x * x)");
+  assert_command_execution_succeeds(env,
+                                    "scatter(x[::2], np.array([1] * 1000))");
+  assert_command_execution_succeeds(env,
+                                    "bar(np.array([1, 2]), np.array([3, -4]))");
+  assert_command_execution_succeeds(env, "show()");
+  assert_command_execution_fails(env, "plot(x, np.array([1, 2]))");
+  assert_command_execution_fails(env, "scatter([1, 'a'], [1, 2])");
+  deinit_environment();
+#endif
+}
+
+QUIZ_CASE(python_matplotlib_plot_store) {
+  init_environement();
+  Matplotlib::PlotStore store;
+  constexpr size_t k_chunkLength = Matplotlib::PlotStore::k_chunkLength;
+  // A curve going right, then back to the left at the start of a chunk
+  store.startCurve(k_chunkLength + 2, KDColorBlack);
+  for (size_t i = 0; i < k_chunkLength; i++) {
+    store.addVertex(i, 0.0f);
+  }
+  quiz_assert(store.numberOfCurves() == 1);
+  Matplotlib::PlotStore::Bounds first = store.vertexChunkBounds(0);
+  quiz_assert(first.xMin == 0.0f && first.xMax == k_chunkLength - 1);
+  store.addVertex(-1.0f, 1.0f);
+  // The first chunk includes the segment starting at its last vertex
+  first = store.vertexChunkBounds(0);
+  quiz_assert(first.xMin == -1.0f && first.yMax == 1.0f);
+  // Undefined vertices are ignored by the bounds
+  store.addVertex(-2.0f, NAN);
+  quiz_assert(store.vertexChunkBounds(1).xMin == -1.0f);
+  quiz_assert(store.curveAtIndex(0).numberOfVertices == k_chunkLength + 2);
+  Matplotlib::PlotStore::Segment segment =
+      store.segmentOfCurve(store.curveAtIndex(0), k_chunkLength);
+  quiz_assert(segment.xStart() == -1.0f && std::isnan(segment.yEnd()));
+
+  store.reserveRects(1);
+  store.addRect(2.0f, 3.0f, 5.0f, 0.0f, KDColorBlack);
+  Matplotlib::PlotStore::Bounds visible = {
+      .xMin = 2.5f, .xMax = 10.0f, .yMin = 4.0f, .yMax = 10.0f};
+  quiz_assert(store.rectChunkBounds(0).intersects(visible));
+  visible.yMin = 6.0f;
+  quiz_assert(!store.rectChunkBounds(0).intersects(visible));
+
+  store.initRange();
+  quiz_assert(store.xMin() < -1.0f && store.xMax() > k_chunkLength - 1);
+  quiz_assert(store.yMin() < 0.0f && store.yMax() > 5.0f);
+  deinit_environment();
+}
+
+QUIZ_CASE(python_matplotlib_pyplot_view_incomplete_curves) {
+  init_environement();
+  Matplotlib::PlotStore store;
+  // Curves without any segment are not drawn
+  store.startCurve(2, KDColorBlack);
+  store.startCurve(2, KDColorBlack);
+  store.addVertex(1.0f, 2.0f);
+  store.addSegment(0.0f, 0.0f, 1.0f, 1.0f, KDColorRed);
+  store.initRange();
+  Matplotlib::PyplotView view(&store);
+  view.setSize(KDSize(Ion::Display::Width, Ion::Display::Height));
+  view.drawRect(KDIonContext::SharedContext, view.bounds());
+  deinit_environment();
+}
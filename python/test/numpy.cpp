@@ -67,3 +67,145 @@ QUIZ_CASE(python_numpy) {
   assert_command_execution_fails(env, "np.concatenate((0,0))");
 #endif
 }
+
+QUIZ_CASE(python_numpy_operators) {
+#ifndef PLATFORM_WINDOWS
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "a = np.array([1,2,3,4,5,6])");
+  assert_command_execution_succeeds(env, "b = np.array([6,5,4,3,2,1])");
+  // Dense operands
+  assert_command_execution_succeeds(
+      env, "a + b", "array([7.0, 7.0, 7.0, 7.0, 7.0, 7.0])\n");
+  assert_command_execution_succeeds(
+      env, "a - b", "array([-5.0, -3.0, -1.0, 1.0, 3.0, 5.0])\n");
+  assert_command_execution_succeeds(
+      env, "a * b", "array([6.0, 10.0, 12.0, 12.0, 10.0, 6.0])\n");
+  assert_command_execution_succeeds(
+      env, "b / a", "array([6.0, 2.5, 1.333333333333333, 0.75, 0.4, "
+                    "0.1666666666666667])\n");
+  assert_command_execution_succeeds(
+      env, "a ** 2", "array([1.0, 4.0, 9.0, 16.0, 25.0, 36.0])\n");
+  // Broadcast scalars
+  assert_command_execution_succeeds(
+      env, "np.array([2]) - a", "array([1.0, 0.0, -1.0, -2.0, -3.0, -4.0])\n");
+  assert_command_execution_succeeds(
+      env, "a / 2", "array([0.5, 1.0, 1.5, 2.0, 2.5, 3.0])\n");
+  assert_command_execution_succeeds(
+      env, "np.array([2]) ** a", "array([2.0, 4.0, 8.0, 16.0, 32.0, 64.0])\n");
+  // Strided and multidimensional operands
+  assert_command_execution_succeeds(env, "a[::2] + b[1::2]",
+                                    "array([6.0, 6.0, 6.0])\n");
+  assert_command_execution_succeeds(env, "m = a.reshape((2,3))");
+  assert_command_execution_succeeds(
+      env, "m * m", "array([[1.0, 4.0, 9.0],\n       [16.0, 25.0, 36.0]])\n");
+  // In-place operators
+  assert_command_execution_succeeds(env, "c = a + 0");
+  assert_command_execution_succeeds(env, "c += b");
+  assert_command_execution_succeeds(env, "c *= 2");
+  assert_command_execution_succeeds(env, "c -= a");
+  assert_command_execution_succeeds(env, "c /= 2");
+  assert_command_execution_succeeds(
+      env, "c", "array([6.5, 6.0, 5.5, 5.0, 4.5, 4.0])\n");
+  assert_command_execution_succeeds(env, "c[::2] += 1");
+  assert_command_execution_succeeds(
+      env, "c", "array([7.5, 6.0, 6.5, 5.0, 5.5, 4.0])\n");
+  assert_command_execution_succeeds(env, "c = a + 0");
+  assert_command_execution_succeeds(env, "c **= 2");
+  assert_command_execution_succeeds(
+      env, "c", "array([1.0, 4.0, 9.0, 16.0, 25.0, 36.0])\n");
+  deinit_environment();
+#endif
+}
+
+QUIZ_CASE(python_numpy_fft) {
+#ifndef PLATFORM_WINDOWS
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(
+      env, "def close(a, b):\n  return np.max(abs(a - np.array(b))) < 1e-9\n");
+  assert_command_execution_succeeds(env, "x = np.array([1,2,3,4,0,0,0,0])");
+  assert_command_execution_succeeds(env, "re, im = np.fft.fft(x)");
+  assert_command_execution_succeeds(
+      env,
+      "close(re, [10, 1 - 2 ** .5, -2, 1 + 2 ** .5, -2, 1 + 2 ** .5, -2, "
+      "1 - 2 ** .5])",
+      "True\n");
+  assert_command_execution_succeeds(
+      env,
+      "close(im, [0, -3 - 3 * 2 ** .5, 2, 3 - 3 * 2 ** .5, 0, "
+      "-3 + 3 * 2 ** .5, -2, 3 + 3 * 2 ** .5])",
+      "True\n");
+  // The real transform matches the complex one
+  assert_command_execution_succeeds(env,
+                                    "re2, im2 = np.fft.fft(x, np.zeros(8))");
+  assert_command_execution_succeeds(env, "close(re2, re) and close(im2, im)",
+                                    "True\n");
+  assert_command_execution_succeeds(env, "r, i = np.fft.ifft(re, im)");
+  assert_command_execution_succeeds(env, "close(r, x) and close(i, [0] * 8)",
+                                    "True\n");
+  assert_command_execution_succeeds(env, "y = np.sin(np.arange(64) ** 2)");
+  assert_command_execution_succeeds(env, "re, im = np.fft.fft(y)");
+  assert_command_execution_succeeds(env,
+                                    "re2, im2 = np.fft.fft(y, np.zeros(64))");
+  assert_command_execution_succeeds(env, "close(re2, re) and close(im2, im)",
+                                    "True\n");
+  assert_command_execution_succeeds(env, "r, i = np.fft.ifft(re, im)");
+  assert_command_execution_succeeds(env, "close(r, y) and close(i, [0] * 64)",
+                                    "True\n");
+  assert_command_execution_succeeds(env, "r, i = np.fft.ifft([1, 2])");
+  assert_command_execution_succeeds(env, "close(r, [1.5, -.5])", "True\n");
+  assert_command_execution_succeeds(env, "np.fft.fft([5])",
+                                    "(array([5.0]), array([0.0]))\n");
+  assert_command_execution_fails(env, "np.fft.fft(np.ones(6))");
+  assert_command_execution_fails(env, "np.fft.fft(np.ones(4), np.ones(2))");
+  deinit_environment();
+#endif
+}
+
+QUIZ_CASE(python_numpy_linalg) {
+#ifndef PLATFORM_WINDOWS
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(
+      env, "def close(a, b):\n  return np.max(abs(a - np.array(b))) < 1e-9\n");
+  assert_command_execution_succeeds(
+      env, "a = np.array([[0,2,1],[1,1,0],[3,0,1]])");
+  assert_command_execution_succeeds(env, "abs(np.linalg.det(a) + 5) < 1e-9",
+                                    "True\n");
+  assert_command_execution_succeeds(env, "np.linalg.det(np.ones((2,2)))",
+                                    "0.0\n");
+  assert_command_execution_succeeds(
+      env, "close(np.dot(a, np.linalg.inv(a)), [[1,0,0],[0,1,0],[0,0,1]])",
+      "True\n");
+  assert_command_execution_fails(env, "np.linalg.inv(np.ones((2,2)))");
+  assert_command_execution_fails(env, "np.linalg.inv(np.ones((2,3)))");
+  assert_command_execution_succeeds(
+      env, "close(np.linalg.solve(a, [3, 3, 7]), [2, 1, 1])", "True\n");
+  assert_command_execution_succeeds(
+      env,
+      "close(np.linalg.solve(a, np.array([[3,0],[3,0],[7,5]])), "
+      "[[2,1],[1,-1],[1,2]])",
+      "True\n");
+  assert_command_execution_fails(env, "np.linalg.solve(a, [1, 2])");
+  assert_command_execution_succeeds(env, "s = np.array([[2,1],[1,2]])");
+  assert_command_execution_succeeds(env, "w, v = np.linalg.eig(s)");
+  assert_command_execution_succeeds(env, "close(np.sort(w), [1, 3])",
+                                    "True\n");
+  assert_command_execution_succeeds(
+      env, "close(np.dot(s, v[:, 0]), v[:, 0] * w[0])", "True\n");
+  assert_command_execution_succeeds(
+      env, "close(np.dot(s, v[:, 1]), v[:, 1] * w[1])", "True\n");
+  assert_command_execution_fails(env, "np.linalg.eig(a)");
+  assert_command_execution_succeeds(env, "np.linalg.norm([3, 4])", "5.0\n");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(np.array([[3, 0], [4, 12]]))", "13.0\n");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(np.array([[3, 0], [4, 12]]), axis=0)",
+      "array([5.0, 12.0])\n");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(np.array([[3, 0], [4, 3]]), axis=1)",
+      "array([3.0, 5.0])\n");
+  deinit_environment();
+#endif
+}
@@ -1,5 +1,9 @@
 #include <quiz.h>
 
+#if !PLATFORM_DEVICE
+#include <ion/src/simulator/shared/framebuffer.h>
+#endif
+
 #include "execution_environment.h"
 
 // TODO: to be completed
@@ -60,3 +64,64 @@ QUIZ_CASE(python_turtle_distance) {
   deinit_environment();
 #endif
 }
+
+QUIZ_CASE(python_turtle_speed_zero) {
+#ifndef PLATFORM_WINDOWS
+  // At speed 0, moves are drawn at once and only end with the turtle drawn
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from turtle import *");
+  assert_command_execution_succeeds(env, "speed(0)");
+  assert_command_execution_succeeds(env, "goto(40,20)");
+  assert_command_execution_succeeds(env, "position()", "(40.0, 20.0)\n");
+  assert_command_execution_succeeds(env, "setheading(270)");
+  assert_command_execution_succeeds(env, "forward(30)");
+  assert_command_execution_succeeds(env, "position()", "(40.0, -10.0)\n");
+  assert_command_execution_succeeds(env, "pensize(3)");
+  assert_command_execution_succeeds(env, "circle(10)");
+  assert_command_execution_succeeds(env, "heading()", "270.0\n");
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(-100,50)");
+  assert_command_execution_succeeds(env, "position()", "(-100.0, 50.0)\n");
+  // Moves out of the drawable area are not batched
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "goto(30000,0)");
+  assert_command_execution_succeeds(env, "goto(0,0)");
+  assert_command_execution_succeeds(env, "position()", "(0.0, 0.0)\n");
+  deinit_environment();
+#endif
+}
+
+QUIZ_CASE(python_turtle_speed_zero_long_segments) {
+#ifndef PLATFORM_WINDOWS
+  // Batched moves can start and end far beyond the screen
+#if !PLATFORM_DEVICE
+  Ion::Simulator::Framebuffer::setActive(true);
+#endif
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from turtle import *");
+  assert_command_execution_succeeds(env, "from kandinsky import get_pixel");
+  assert_command_execution_succeeds(env, "speed(0)");
+  assert_command_execution_succeeds(env, "hideturtle()");
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(-20000,10)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "color('red')");
+  assert_command_execution_succeeds(env, "goto(20000,10)");
+  assert_command_execution_succeeds(env, "get_pixel(0,101)", "(255, 0, 0)\n");
+  assert_command_execution_succeeds(env, "get_pixel(160,101)",
+                                    "(255, 0, 0)\n");
+  assert_command_execution_succeeds(env, "get_pixel(319,101)",
+                                    "(255, 0, 0)\n");
+  // A steep segment crossing the whole screen
+  assert_command_execution_succeeds(env, "color('blue')");
+  assert_command_execution_succeeds(env, "goto(-20000,-20000)");
+  assert_command_execution_succeeds(env, "goto(20000,20000)");
+  assert_command_execution_succeeds(env, "get_pixel(160,111)",
+                                    "(0, 0, 255)\n");
+  assert_command_execution_succeeds(env, "get_pixel(200,71)", "(0, 0, 255)\n");
+  deinit_environment();
+#if !PLATFORM_DEVICE
+  Ion::Simulator::Framebuffer::setActive(false);
+#endif
+#endif
+}